@@ -1,14 +1,27 @@
 # Canonical production source inventory for MIDI Studio UI consumers.
 set(MS_UI_SOURCE_PATHS
+    src/ms/ui/InvalidationDebug.cpp
+    src/ms/ui/PerfCounters.cpp
     src/ms/ui/ViewContainer.cpp
+    src/ms/ui/ViewRegistry.cpp
+    src/ms/ui/component/BackdropSnapshot.cpp
+    src/ms/ui/component/LayoutBoundary.cpp
     src/ms/ui/component/LayoutOverlay.cpp
     src/ms/ui/component/LayoutView.cpp
+    src/ms/ui/component/Occlusion.cpp
     src/ms/ui/component/VirtualListOverlay.cpp
     src/ms/ui/font/CoreFonts.cpp
+    src/ms/ui/font/LazyBinFont.cpp
     src/ms/ui/widget/BaseSelector.cpp
+    src/ms/ui/widget/CoalescedSelection.cpp
     src/ms/ui/widget/CurvePreviewWidget.cpp
+    src/ms/ui/widget/HighlightStyles.cpp
+    src/ms/ui/widget/LabelBitmapMode.cpp
     src/ms/ui/widget/ListOverlay.cpp
+    src/ms/ui/widget/MarqueeEngine.cpp
     src/ms/ui/widget/MenuListView.cpp
+    src/ms/ui/widget/SlotMemoryPolicy.cpp
+    src/ms/ui/widget/SlotRowDock.cpp
     src/ms/ui/widget/StringListSelector.cpp
     src/ms/ui/widget/VirtualListKeyValueOverlay.cpp
     src/ms/ui/widget/VirtualListSelectorOverlay.cpp
@@ -0,0 +1,162 @@
+#include "InvalidationDebug.hpp"
+
+#include <config/PlatformCompat.hpp>
+
+namespace ms::ui {
+
+#if MS_UI_INVALIDATION_DEBUG
+
+namespace {
+
+using Heatmap = InvalidationHeatmap<MS_UI_INVALIDATION_GRID_COLS,
+                                    MS_UI_INVALIDATION_GRID_ROWS,
+                                    MS_UI_INVALIDATION_FRAME_RECTS,
+                                    PERF_WIDGETS>;
+
+constexpr lv_opa_t MAX_OVERLAY_OPA = LV_OPA_60;
+
+struct DebugState {
+    Heatmap heatmap{};
+    lv_display_t* display = nullptr;
+    lv_obj_t* overlay = nullptr;
+    lv_timer_t* decayTimer = nullptr;
+    InvalidationSink sink = nullptr;
+    void* sinkContext = nullptr;
+};
+
+DebugState g_debug{};
+
+void onRefreshReady(lv_event_t*) {
+    g_debug.heatmap.endFrame();
+}
+
+void onOverlayDraw(lv_event_t* event) {
+    lv_layer_t* layer = lv_event_get_layer(event);
+    if (!layer) return;
+    lv_draw_rect_dsc_t dsc;
+    lv_draw_rect_dsc_init(&dsc);
+    for (std::size_t row = 0; row < MS_UI_INVALIDATION_GRID_ROWS; ++row) {
+        for (std::size_t col = 0; col < MS_UI_INVALIDATION_GRID_COLS; ++col) {
+            const uint8_t heat = g_debug.heatmap.heat(col, row);
+            if (heat == 0U) continue;
+            const auto cell = g_debug.heatmap.cell(col, row);
+            const lv_area_t area{cell.x1, cell.y1, cell.x2, cell.y2};
+            // Cool cells yellow and faint, saturated ones red.
+            dsc.bg_color = lv_color_mix(lv_color_hex(0xFF0000), lv_color_hex(0xFFFF00), heat);
+            dsc.bg_opa = static_cast<lv_opa_t>(static_cast<uint32_t>(heat) * MAX_OVERLAY_OPA / 255U);
+            lv_draw_rect(layer, &dsc, &area);
+        }
+    }
+}
+
+// Repaint what was warm before cooling: covers cells heated since the
+// last tick as well as the ones fading out. A cold map costs nothing.
+void onDecay(lv_timer_t*) {
+    const auto bounds = g_debug.heatmap.warmBounds();
+    g_debug.heatmap.decay();
+    if (!bounds.valid() || !g_debug.overlay) return;
+    const lv_area_t area{bounds.x1, bounds.y1, bounds.x2, bounds.y2};
+    lv_obj_invalidate_area(g_debug.overlay, &area);
+}
+
+FLASHMEM void createOverlay() {
+    if (g_debug.overlay || !g_debug.display) return;
+    lv_obj_t* layer = lv_display_get_layer_sys(g_debug.display);
+    if (!layer) return;
+    g_debug.overlay = lv_obj_create(layer);
+    lv_obj_remove_style_all(g_debug.overlay);
+    lv_obj_set_size(g_debug.overlay, LV_PCT(100), LV_PCT(100));
+    lv_obj_add_flag(g_debug.overlay, LV_OBJ_FLAG_IGNORE_LAYOUT);
+    lv_obj_remove_flag(g_debug.overlay, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_remove_flag(g_debug.overlay, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_add_event_cb(g_debug.overlay, onOverlayDraw, LV_EVENT_DRAW_MAIN, nullptr);
+}
+
+}  // namespace
+
+FLASHMEM bool startInvalidationHeatmap(lv_display_t* display, bool showOverlay) {
+    stopInvalidationHeatmap();
+    g_debug.display = display ? display : lv_display_get_default();
+    if (!g_debug.display) return false;
+
+    g_debug.heatmap.configure(lv_display_get_horizontal_resolution(g_debug.display),
+                              lv_display_get_vertical_resolution(g_debug.display));
+    lv_display_add_event_cb(g_debug.display, onRefreshReady, LV_EVENT_REFR_READY, &g_debug);
+    g_debug.decayTimer = lv_timer_create(onDecay, MS_UI_INVALIDATION_DECAY_MS, nullptr);
+    showInvalidationHeatmap(showOverlay);
+    return true;
+}
+
+FLASHMEM void stopInvalidationHeatmap() {
+    if (g_debug.decayTimer) {
+        lv_timer_delete(g_debug.decayTimer);
+        g_debug.decayTimer = nullptr;
+    }
+    if (g_debug.overlay) {
+        lv_obj_delete(g_debug.overlay);
+        g_debug.overlay = nullptr;
+    }
+    if (g_debug.display) {
+        lv_display_remove_event_cb_with_user_data(g_debug.display, onRefreshReady, &g_debug);
+        g_debug.display = nullptr;
+    }
+}
+
+FLASHMEM void showInvalidationHeatmap(bool show) {
+    if (show) {
+        createOverlay();
+        if (g_debug.overlay) lv_obj_clear_flag(g_debug.overlay, LV_OBJ_FLAG_HIDDEN);
+    } else if (g_debug.overlay) {
+        lv_obj_add_flag(g_debug.overlay, LV_OBJ_FLAG_HIDDEN);
+    }
+}
+
+FLASHMEM const InvalidationStats& lastInvalidationFrame() {
+    return g_debug.heatmap.last();
+}
+
+FLASHMEM const InvalidationStats& worstInvalidationFrame() {
+    return g_debug.heatmap.worst();
+}
+
+FLASHMEM void resetWorstInvalidationFrame() {
+    g_debug.heatmap.resetWorst();
+}
+
+FLASHMEM void setInvalidationSink(InvalidationSink sink, void* context) {
+    g_debug.sink = sink;
+    g_debug.sinkContext = context;
+}
+
+void recordInvalidation(PerfWidget widget, const lv_area_t& area) {
+    if (!g_debug.display) return;
+    g_debug.heatmap.record(static_cast<std::size_t>(widget), area.x1, area.y1, area.x2, area.y2);
+    if (g_debug.sink) g_debug.sink(g_debug.sinkContext, widget, area);
+}
+
+#else
+
+FLASHMEM bool startInvalidationHeatmap(lv_display_t*, bool) {
+    return false;
+}
+
+FLASHMEM void stopInvalidationHeatmap() {}
+
+FLASHMEM void showInvalidationHeatmap(bool) {}
+
+FLASHMEM const InvalidationStats& lastInvalidationFrame() {
+    static const InvalidationStats empty{};
+    return empty;
+}
+
+FLASHMEM const InvalidationStats& worstInvalidationFrame() {
+    return lastInvalidationFrame();
+}
+
+FLASHMEM void resetWorstInvalidationFrame() {}
+
+FLASHMEM void setInvalidationSink(InvalidationSink, void*) {}
+
+#endif
+
+}  // namespace ms::ui
@@ -0,0 +1,73 @@
+#pragma once
+
+/**
+ * @file InvalidationDebug.hpp
+ * @brief Heatmap overlay and per-frame totals of the rects ms-ui invalidates
+ */
+
+#include <cstdint>
+
+#include <lvgl.h>
+
+#include <ms/ui/InvalidationHeatmap.hpp>
+#include <ms/ui/PerfCounterTable.hpp>
+
+// 1 = every MS_UI_PERF_INVALIDATE* site also reports its on-screen rect
+// here. Debug builds only: the union per frame costs O(rects^2).
+#ifndef MS_UI_INVALIDATION_DEBUG
+#define MS_UI_INVALIDATION_DEBUG 0
+#endif
+
+#ifndef MS_UI_INVALIDATION_GRID_COLS
+#define MS_UI_INVALIDATION_GRID_COLS 32
+#endif
+
+#ifndef MS_UI_INVALIDATION_GRID_ROWS
+#define MS_UI_INVALIDATION_GRID_ROWS 24
+#endif
+
+// Rects kept per frame for the exact redrawn-pixel union.
+#ifndef MS_UI_INVALIDATION_FRAME_RECTS
+#define MS_UI_INVALIDATION_FRAME_RECTS 64
+#endif
+
+#ifndef MS_UI_INVALIDATION_DECAY_MS
+#define MS_UI_INVALIDATION_DECAY_MS 100U
+#endif
+
+namespace ms::ui {
+
+/** One refresh: rect count, requested vs. unique pixels, pixels per widget. */
+using InvalidationStats = InvalidationFrame<PERF_WIDGETS>;
+
+/** Sees every recorded rect (already clipped to what is visible). */
+using InvalidationSink = void (*)(void* context, PerfWidget widget, const lv_area_t& area);
+
+constexpr bool invalidationDebugEnabled() { return MS_UI_INVALIDATION_DEBUG != 0; }
+
+/**
+ * Start recording on display (default display when nullptr): frames close
+ * on LV_EVENT_REFR_READY, and with showOverlay a click-through layer on
+ * the system layer paints warm cells red to yellow. The overlay repaints
+ * only while some cell is warm and its own redraws are not recorded.
+ * False when compiled out or there is no display.
+ */
+bool startInvalidationHeatmap(lv_display_t* display = nullptr, bool showOverlay = true);
+void stopInvalidationHeatmap();
+void showInvalidationHeatmap(bool show);
+
+/** Latest frame that invalidated anything, and the one with the most unique pixels. */
+const InvalidationStats& lastInvalidationFrame();
+const InvalidationStats& worstInvalidationFrame();
+void resetWorstInvalidationFrame();
+
+void setInvalidationSink(InvalidationSink sink, void* context);
+
+#if MS_UI_INVALIDATION_DEBUG
+
+/** Feed one visible rect; ignored until startInvalidationHeatmap(). */
+void recordInvalidation(PerfWidget widget, const lv_area_t& area);
+
+#endif
+
+}  // namespace ms::ui
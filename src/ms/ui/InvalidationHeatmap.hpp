@@ -0,0 +1,232 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace ms::ui {
+
+/** Invalidation totals of one refresh. */
+template <std::size_t Sources>
+struct InvalidationFrame {
+    uint32_t frame = 0;
+    uint32_t rects = 0;
+    // Sum of every rect (what the widgets asked for) vs. their union (what
+    // the display had to redraw at most). requested / unique is overdraw.
+    uint32_t requestedPx = 0;
+    uint32_t uniquePx = 0;
+    // More rects than the frame log holds: uniquePx covers the logged ones.
+    bool truncated = false;
+    std::array<uint32_t, Sources> sourcePx{};
+};
+
+/**
+ * Screen-space record of invalidated rects with a decaying heat grid.
+ *
+ * record() clips a rect to the screen, adds heat to every grid cell it
+ * touches and logs it for the frame; endFrame() turns the log into an
+ * InvalidationFrame (exact union via x strips). decay() cools every cell
+ * by a quarter, so a region invalidated each frame stays saturated while
+ * a one-off flash fades out in a few ticks. Pure arithmetic: the LVGL side
+ * feeds rects and reads cells back to draw them.
+ */
+template <std::size_t Cols, std::size_t Rows, std::size_t FrameRects, std::size_t Sources>
+class InvalidationHeatmap {
+public:
+    static_assert(Cols > 0U && Rows > 0U && FrameRects > 0U && Sources > 0U, "empty heatmap");
+
+    using Frame = InvalidationFrame<Sources>;
+
+    static constexpr uint8_t HEAT_STEP = 64U;
+
+    struct Rect {
+        int32_t x1 = 0;
+        int32_t y1 = 0;
+        int32_t x2 = -1;
+        int32_t y2 = -1;
+
+        [[nodiscard]] bool valid() const { return x2 >= x1 && y2 >= y1; }
+        [[nodiscard]] uint32_t pixels() const {
+            return valid() ? static_cast<uint32_t>(x2 - x1 + 1) * static_cast<uint32_t>(y2 - y1 + 1) : 0U;
+        }
+    };
+
+    /** Screen size; clears heat and the open frame. */
+    void configure(int32_t width, int32_t height) {
+        width_ = std::max<int32_t>(width, 1);
+        height_ = std::max<int32_t>(height, 1);
+        heat_.fill(0U);
+        current_ = Frame{};
+        last_ = Frame{};
+        worst_ = Frame{};
+        logged_ = 0U;
+        frames_ = 0U;
+    }
+
+    void record(std::size_t source, int32_t x1, int32_t y1, int32_t x2, int32_t y2) {
+        const Rect rect{std::max<int32_t>(x1, 0), std::max<int32_t>(y1, 0),
+                        std::min(x2, width_ - 1), std::min(y2, height_ - 1)};
+        if (!rect.valid()) return;
+
+        const uint32_t px = rect.pixels();
+        ++current_.rects;
+        current_.requestedPx = saturatingAdd(current_.requestedPx, px);
+        if (source < Sources) current_.sourcePx[source] = saturatingAdd(current_.sourcePx[source], px);
+        if (logged_ < FrameRects) {
+            log_[logged_++] = rect;
+        } else {
+            current_.truncated = true;
+        }
+
+        for (std::size_t row = rowOf(rect.y1); row <= rowOf(rect.y2); ++row) {
+            for (std::size_t col = colOf(rect.x1); col <= colOf(rect.x2); ++col) {
+                uint8_t& cell = heat_[row * Cols + col];
+                cell = cell > 255U - HEAT_STEP ? 255U : static_cast<uint8_t>(cell + HEAT_STEP);
+            }
+        }
+    }
+
+    /**
+     * Close the frame. Frames without rects only advance the counter and
+     * leave last() alone; returns whether this one had any.
+     */
+    bool endFrame() {
+        ++frames_;
+        if (current_.rects == 0U) return false;
+        current_.frame = frames_;
+        current_.uniquePx = unionPixels();
+        last_ = current_;
+        if (last_.uniquePx >= worst_.uniquePx) worst_ = last_;
+        current_ = Frame{};
+        logged_ = 0U;
+        return true;
+    }
+
+    /** Cool every cell; true while any cell is still warm. */
+    bool decay() {
+        bool warm = false;
+        for (auto& cell : heat_) {
+            cell = cell <= 4U ? 0U : static_cast<uint8_t>(cell - cell / 4U - 1U);
+            warm = warm || cell != 0U;
+        }
+        return warm;
+    }
+
+    void resetWorst() { worst_ = Frame{}; }
+
+    [[nodiscard]] const Frame& last() const { return last_; }
+    [[nodiscard]] const Frame& worst() const { return worst_; }
+    [[nodiscard]] uint32_t frames() const { return frames_; }
+
+    [[nodiscard]] uint8_t heat(std::size_t col, std::size_t row) const {
+        return col < Cols && row < Rows ? heat_[row * Cols + col] : 0U;
+    }
+
+    /** Screen rect of one grid cell. */
+    [[nodiscard]] Rect cell(std::size_t col, std::size_t row) const {
+        return Rect{edge(col, width_, Cols), edge(row, height_, Rows),
+                    edge(col + 1U, width_, Cols) - 1, edge(row + 1U, height_, Rows) - 1};
+    }
+
+    /** Bounding rect of every warm cell; invalid when the grid is cold. */
+    [[nodiscard]] Rect warmBounds() const {
+        Rect bounds{};
+        bool any = false;
+        for (std::size_t row = 0; row < Rows; ++row) {
+            for (std::size_t col = 0; col < Cols; ++col) {
+                if (heat_[row * Cols + col] == 0U) continue;
+                const Rect c = cell(col, row);
+                if (!any) {
+                    bounds = c;
+                    any = true;
+                    continue;
+                }
+                bounds.x1 = std::min(bounds.x1, c.x1);
+                bounds.y1 = std::min(bounds.y1, c.y1);
+                bounds.x2 = std::max(bounds.x2, c.x2);
+                bounds.y2 = std::max(bounds.y2, c.y2);
+            }
+        }
+        return bounds;
+    }
+
+private:
+    static constexpr uint32_t saturatingAdd(uint32_t a, uint32_t b) {
+        return a > UINT32_MAX - b ? UINT32_MAX : a + b;
+    }
+
+    static int32_t edge(std::size_t index, int32_t extent, std::size_t cells) {
+        return static_cast<int32_t>(static_cast<int64_t>(extent) * static_cast<int64_t>(index) /
+                                    static_cast<int64_t>(cells));
+    }
+
+    std::size_t colOf(int32_t x) const {
+        return std::min(static_cast<std::size_t>(static_cast<int64_t>(x) * Cols / width_), Cols - 1U);
+    }
+
+    std::size_t rowOf(int32_t y) const {
+        return std::min(static_cast<std::size_t>(static_cast<int64_t>(y) * Rows / height_), Rows - 1U);
+    }
+
+    // Insertion sort for the few logged rects. std::sort's 16-element fast
+    // path also trips GCC's -Warray-bounds on buffers this small.
+    template <typename T>
+    static void sortSmall(T* first, std::size_t count) {
+        for (std::size_t i = 1; i < count; ++i) {
+            const T value = first[i];
+            std::size_t j = i;
+            for (; j > 0U && value < first[j - 1U]; --j) first[j] = first[j - 1U];
+            first[j] = value;
+        }
+    }
+
+    // Area covered by the logged rects: sweep the distinct x edges and
+    // merge the y spans crossing each strip.
+    uint32_t unionPixels() const {
+        std::array<int32_t, FrameRects * 2U> xs{};
+        std::size_t edges = 0;
+        for (std::size_t i = 0; i < logged_; ++i) {
+            xs[edges++] = log_[i].x1;
+            xs[edges++] = log_[i].x2 + 1;
+        }
+        sortSmall(xs.data(), edges);
+
+        uint32_t total = 0U;
+        std::array<std::pair<int32_t, int32_t>, FrameRects> spans{};
+        for (std::size_t e = 0; e + 1U < edges; ++e) {
+            const int32_t left = xs[e];
+            const int32_t right = xs[e + 1U];
+            if (right <= left) continue;
+            std::size_t count = 0;
+            for (std::size_t i = 0; i < logged_; ++i) {
+                if (log_[i].x1 <= left && log_[i].x2 >= right - 1) {
+                    spans[count++] = {log_[i].y1, log_[i].y2 + 1};
+                }
+            }
+            sortSmall(spans.data(), count);
+            uint32_t covered = 0U;
+            int32_t open = INT32_MIN;
+            for (std::size_t i = 0; i < count; ++i) {
+                const int32_t from = std::max(spans[i].first, open);
+                if (spans[i].second > from) covered += static_cast<uint32_t>(spans[i].second - from);
+                open = std::max(open, spans[i].second);
+            }
+            total = saturatingAdd(total, covered * static_cast<uint32_t>(right - left));
+        }
+        return total;
+    }
+
+    int32_t width_ = 1;
+    int32_t height_ = 1;
+    std::array<uint8_t, Cols * Rows> heat_{};
+    std::array<Rect, FrameRects> log_{};
+    std::size_t logged_ = 0;
+    uint32_t frames_ = 0;
+    Frame current_{};
+    Frame last_{};
+    Frame worst_{};
+};
+
+}  // namespace ms::ui
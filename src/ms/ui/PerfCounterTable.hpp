@@ -0,0 +1,138 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace ms::ui {
+
+/** Widgets that report into the counter table. */
+enum class PerfWidget : uint8_t {
+    MenuList = 0,
+    ListOverlay,
+    KeyValueOverlay,
+    SelectorOverlay,
+    StringListSelector,
+    CurvePreview,
+    LayoutOverlay,
+    LayoutView,
+    ViewContainer,
+    Marquee,
+    LabelBitmap,
+    Fonts,  // one construction per core font loaded or mapped
+    Count,
+};
+
+enum class PerfCounter : uint8_t {
+    Renders = 0,
+    RowsBound,
+    // Rows moved into another slot by a window shift instead of rebound.
+    RowsDocked,
+    ProviderCalls,
+    LabelTextSets,
+    // Pixels handed to invalidation calls; overlapping areas count twice.
+    InvalidatedPixels,
+    DrawCallbacks,
+    ObjectsCreated,
+    Count,
+};
+
+constexpr std::size_t PERF_WIDGETS = static_cast<std::size_t>(PerfWidget::Count);
+constexpr std::size_t PERF_COUNTERS = static_cast<std::size_t>(PerfCounter::Count);
+
+constexpr const char* perfWidgetName(PerfWidget widget) {
+    switch (widget) {
+        case PerfWidget::MenuList: return "menu-list";
+        case PerfWidget::ListOverlay: return "list-overlay";
+        case PerfWidget::KeyValueOverlay: return "kv-overlay";
+        case PerfWidget::SelectorOverlay: return "selector-overlay";
+        case PerfWidget::StringListSelector: return "string-list-selector";
+        case PerfWidget::CurvePreview: return "curve-preview";
+        case PerfWidget::LayoutOverlay: return "layout-overlay";
+        case PerfWidget::LayoutView: return "layout-view";
+        case PerfWidget::ViewContainer: return "view-container";
+        case PerfWidget::Marquee: return "marquee";
+        case PerfWidget::LabelBitmap: return "label-bitmap";
+        case PerfWidget::Fonts: return "fonts";
+        case PerfWidget::Count: break;
+    }
+    return "?";
+}
+
+constexpr const char* perfCounterName(PerfCounter counter) {
+    switch (counter) {
+        case PerfCounter::Renders: return "renders";
+        case PerfCounter::RowsBound: return "rows-bound";
+        case PerfCounter::RowsDocked: return "rows-docked";
+        case PerfCounter::ProviderCalls: return "provider-calls";
+        case PerfCounter::LabelTextSets: return "label-text-sets";
+        case PerfCounter::InvalidatedPixels: return "invalidated-px";
+        case PerfCounter::DrawCallbacks: return "draw-callbacks";
+        case PerfCounter::ObjectsCreated: return "objects-created";
+        case PerfCounter::Count: break;
+    }
+    return "?";
+}
+
+/** Everything one widget kind reported since the last reset. */
+struct PerfWidgetCounters {
+    std::array<uint32_t, PERF_COUNTERS> values{};
+    uint32_t constructions = 0;
+    /// Summed and slowest constructor time (clock units of the caller, µs on target)
+    uint32_t constructUs = 0;
+    uint32_t maxConstructUs = 0;
+
+    [[nodiscard]] uint32_t operator[](PerfCounter counter) const {
+        return values[static_cast<std::size_t>(counter)];
+    }
+};
+
+/**
+ * Per-widget event counters.
+ *
+ * Plain saturating adds into a fixed table: no allocation, no clock, no
+ * LVGL. Counters stop at UINT32_MAX rather than wrap, so a long soak still
+ * reads as "at least this many" until reset().
+ */
+class PerfCounterTable {
+public:
+    void add(PerfWidget widget, PerfCounter counter, uint32_t n = 1U) {
+        if (!valid(widget) || counter >= PerfCounter::Count) return;
+        uint32_t& value = table_[index(widget)].values[static_cast<std::size_t>(counter)];
+        value = saturatingAdd(value, n);
+    }
+
+    void addConstruct(PerfWidget widget, uint32_t elapsedUs) {
+        if (!valid(widget)) return;
+        auto& entry = table_[index(widget)];
+        entry.constructions = saturatingAdd(entry.constructions, 1U);
+        entry.constructUs = saturatingAdd(entry.constructUs, elapsedUs);
+        if (elapsedUs > entry.maxConstructUs) entry.maxConstructUs = elapsedUs;
+    }
+
+    [[nodiscard]] const PerfWidgetCounters& get(PerfWidget widget) const {
+        static const PerfWidgetCounters empty{};
+        return valid(widget) ? table_[index(widget)] : empty;
+    }
+
+    /** Sum of one counter over every widget. */
+    [[nodiscard]] uint32_t total(PerfCounter counter) const {
+        uint32_t sum = 0U;
+        for (const auto& entry : table_) sum = saturatingAdd(sum, entry[counter]);
+        return sum;
+    }
+
+    void reset() { table_.fill(PerfWidgetCounters{}); }
+
+private:
+    static constexpr bool valid(PerfWidget widget) { return widget < PerfWidget::Count; }
+    static constexpr std::size_t index(PerfWidget widget) { return static_cast<std::size_t>(widget); }
+
+    static constexpr uint32_t saturatingAdd(uint32_t a, uint32_t b) {
+        return a > UINT32_MAX - b ? UINT32_MAX : a + b;
+    }
+
+    std::array<PerfWidgetCounters, PERF_WIDGETS> table_{};
+};
+
+}  // namespace ms::ui
@@ -0,0 +1,132 @@
+#include "PerfCounters.hpp"
+
+#include <config/PlatformCompat.hpp>
+
+namespace ms::ui {
+
+namespace {
+
+uint32_t tickClockUs() {
+    return lv_tick_get() * 1000U;
+}
+
+PerfClockUs g_clock = tickClockUs;
+
+#if MS_UI_PERF_COUNTERS
+
+PerfCounterTable g_counters{};
+
+FLASHMEM uint32_t countSubtree(lv_obj_t* obj) {
+    if (!obj) return 0U;
+    uint32_t count = 1U;
+    const uint32_t children = lv_obj_get_child_cnt(obj);
+    for (uint32_t i = 0; i < children; ++i) {
+        count += countSubtree(lv_obj_get_child(obj, static_cast<int32_t>(i)));
+    }
+    return count;
+}
+
+uint32_t areaPixels(const lv_area_t& area) {
+    const int32_t w = lv_area_get_width(&area);
+    const int32_t h = lv_area_get_height(&area);
+    return w > 0 && h > 0 ? static_cast<uint32_t>(w) * static_cast<uint32_t>(h) : 0U;
+}
+
+#endif
+
+#if MS_UI_PERF_TRACK_INVALIDATION
+
+// Same clipping lv_obj_invalidate_area() applies: hidden objects and
+// scrolled-out parts never reach the display.
+void noteInvalidated(PerfWidget widget, lv_obj_t* obj, const lv_area_t& area) {
+    lv_area_t visible = area;
+    if (!lv_obj_area_is_visible(obj, &visible)) return;
+#if MS_UI_PERF_COUNTERS
+    g_counters.add(widget, PerfCounter::InvalidatedPixels, areaPixels(visible));
+#endif
+#if MS_UI_INVALIDATION_DEBUG
+    recordInvalidation(widget, visible);
+#endif
+}
+
+#endif
+
+}  // namespace
+
+uint32_t perfClockUs() {
+    return g_clock();
+}
+
+FLASHMEM void setPerfClockUs(PerfClockUs clock) {
+    g_clock = clock ? clock : tickClockUs;
+}
+
+#if MS_UI_PERF_COUNTERS
+
+FLASHMEM const PerfWidgetCounters& perfCounters(PerfWidget widget) {
+    return g_counters.get(widget);
+}
+
+FLASHMEM uint32_t perfCounterTotal(PerfCounter counter) {
+    return g_counters.total(counter);
+}
+
+FLASHMEM void resetPerfCounters() {
+    g_counters.reset();
+}
+
+void perfCount(PerfWidget widget, PerfCounter counter, uint32_t n) {
+    g_counters.add(widget, counter, n);
+}
+
+FLASHMEM void perfCountObjects(PerfWidget widget, lv_obj_t* subtree) {
+    g_counters.add(widget, PerfCounter::ObjectsCreated, countSubtree(subtree));
+}
+
+FLASHMEM PerfConstructScope::PerfConstructScope(PerfWidget widget)
+    : widget_(widget), startUs_(g_clock()) {}
+
+FLASHMEM PerfConstructScope::~PerfConstructScope() {
+    g_counters.addConstruct(widget_, g_clock() - startUs_);
+}
+
+#else
+
+FLASHMEM const PerfWidgetCounters& perfCounters(PerfWidget) {
+    static const PerfWidgetCounters empty{};
+    return empty;
+}
+
+FLASHMEM uint32_t perfCounterTotal(PerfCounter) {
+    return 0U;
+}
+
+FLASHMEM void resetPerfCounters() {}
+
+#endif
+
+#if MS_UI_PERF_TRACK_INVALIDATION
+
+void perfInvalidate(PerfWidget widget, lv_obj_t* obj) {
+    if (!obj) return;
+    lv_area_t area;
+    lv_obj_get_coords(obj, &area);
+    const int32_t ext = lv_obj_get_ext_draw_size(obj);
+    lv_area_increase(&area, ext, ext);
+    noteInvalidated(widget, obj, area);
+    lv_obj_invalidate(obj);
+}
+
+void perfInvalidateArea(PerfWidget widget, lv_obj_t* obj, const lv_area_t* area) {
+    if (!obj || !area) return;
+    noteInvalidated(widget, obj, *area);
+    lv_obj_invalidate_area(obj, area);
+}
+
+void perfCountArea(PerfWidget widget, lv_obj_t* obj, const lv_area_t& area) {
+    if (obj) noteInvalidated(widget, obj, area);
+}
+
+#endif
+
+}  // namespace ms::ui
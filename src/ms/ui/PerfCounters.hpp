@@ -0,0 +1,110 @@
+#pragma once
+
+/**
+ * @file PerfCounters.hpp
+ * @brief Uniform per-widget counters, compiled out unless MS_UI_PERF_COUNTERS
+ */
+
+#include <cstdint>
+
+#include <lvgl.h>
+
+#include <ms/ui/InvalidationDebug.hpp>
+#include <ms/ui/PerfCounterTable.hpp>
+
+// 1 = widgets count renders, binds, provider calls, label sets, invalidated
+// pixels, draw callbacks, created objects and constructor time. 0 = every
+// MS_UI_PERF_* site compiles to the bare LVGL call (or nothing).
+#ifndef MS_UI_PERF_COUNTERS
+#define MS_UI_PERF_COUNTERS 0
+#endif
+
+// Invalidation sites go through perfInvalidate*() when either the counters
+// or the heatmap (InvalidationDebug.hpp) want their rects.
+#define MS_UI_PERF_TRACK_INVALIDATION (MS_UI_PERF_COUNTERS || MS_UI_INVALIDATION_DEBUG)
+
+namespace ms::ui {
+
+/** Microsecond clock for ms-ui's own timing; lv_tick_get() * 1000 by default. */
+using PerfClockUs = uint32_t (*)();
+
+// Always available: widgets that adapt to their measured cost read it too.
+uint32_t perfClockUs();
+void setPerfClockUs(PerfClockUs clock);
+
+// Query side exists in every build; with counters compiled out it reports
+// zeros, so host tools and device consoles need no #if of their own.
+constexpr bool perfCountersEnabled() { return MS_UI_PERF_COUNTERS != 0; }
+const PerfWidgetCounters& perfCounters(PerfWidget widget);
+uint32_t perfCounterTotal(PerfCounter counter);
+void resetPerfCounters();
+
+#if MS_UI_PERF_TRACK_INVALIDATION
+
+/** lv_obj_invalidate() that also reports the object's visible area. */
+void perfInvalidate(PerfWidget widget, lv_obj_t* obj);
+void perfInvalidateArea(PerfWidget widget, lv_obj_t* obj, const lv_area_t* area);
+
+/** Report area of obj invalidated through another helper. */
+void perfCountArea(PerfWidget widget, lv_obj_t* obj, const lv_area_t& area);
+
+#endif
+
+#if MS_UI_PERF_COUNTERS
+
+void perfCount(PerfWidget widget, PerfCounter counter, uint32_t n = 1U);
+
+/** Count subtree and all its descendants as created by widget. */
+void perfCountObjects(PerfWidget widget, lv_obj_t* subtree);
+
+/** Times the enclosing scope as one construction of widget. */
+class PerfConstructScope {
+public:
+    explicit PerfConstructScope(PerfWidget widget);
+    ~PerfConstructScope();
+
+    PerfConstructScope(const PerfConstructScope&) = delete;
+    PerfConstructScope& operator=(const PerfConstructScope&) = delete;
+
+private:
+    PerfWidget widget_;
+    uint32_t startUs_;
+};
+
+#endif
+
+}  // namespace ms::ui
+
+#if MS_UI_PERF_TRACK_INVALIDATION
+
+#define MS_UI_PERF_INVALIDATE(widget, obj) \
+    ::ms::ui::perfInvalidate(::ms::ui::PerfWidget::widget, (obj))
+#define MS_UI_PERF_INVALIDATE_AREA(widget, obj, area) \
+    ::ms::ui::perfInvalidateArea(::ms::ui::PerfWidget::widget, (obj), (area))
+#define MS_UI_PERF_AREA(widget, obj, area) \
+    ::ms::ui::perfCountArea(::ms::ui::PerfWidget::widget, (obj), (area))
+
+#else
+
+#define MS_UI_PERF_INVALIDATE(widget, obj) lv_obj_invalidate(obj)
+#define MS_UI_PERF_INVALIDATE_AREA(widget, obj, area) lv_obj_invalidate_area((obj), (area))
+#define MS_UI_PERF_AREA(widget, obj, area) ((void)0)
+
+#endif
+
+#if MS_UI_PERF_COUNTERS
+
+#define MS_UI_PERF_COUNT(widget, counter, n) \
+    ::ms::ui::perfCount(::ms::ui::PerfWidget::widget, ::ms::ui::PerfCounter::counter, (n))
+#define MS_UI_PERF_OBJECTS(widget, subtree) \
+    ::ms::ui::perfCountObjects(::ms::ui::PerfWidget::widget, (subtree))
+#define MS_UI_PERF_CONSTRUCT(widget) \
+    ::ms::ui::PerfConstructScope msUiPerfConstruct_(::ms::ui::PerfWidget::widget)
+
+#else
+
+#define MS_UI_PERF_COUNT(widget, counter, n) ((void)0)
+#define MS_UI_PERF_OBJECTS(widget, subtree) ((void)0)
+#define MS_UI_PERF_CONSTRUCT(widget) ((void)0)
+
+#endif
@@ -1,5 +1,9 @@
 #include "ViewContainer.hpp"
 
+#include <ms/ui/PerfCounters.hpp>
+#include <ms/ui/component/LayoutBoundary.hpp>
+#include <ms/ui/component/Occlusion.hpp>
+#include <ms/ui/font/CoreFonts.hpp>
 #include <oc/ui/lvgl/style/StyleBuilder.hpp>
 #include <oc/ui/lvgl/theme/BaseTheme.hpp>
 
@@ -9,6 +13,7 @@ namespace theme = oc::ui::lvgl::base_theme;
 namespace style = oc::ui::lvgl::style;
 
 ViewContainer::ViewContainer(lv_obj_t* parent) {
+    MS_UI_PERF_CONSTRUCT(ViewContainer);
     // Root container (full screen, flex column)
     container_ = lv_obj_create(parent);
     style::apply(container_).fullSize().pad(0).bgColor(theme::color::BACKGROUND);
@@ -17,10 +22,11 @@ ViewContainer::ViewContainer(lv_obj_t* parent) {
     lv_obj_set_style_pad_gap(container_, 0, LV_STATE_DEFAULT);
     lv_obj_set_style_border_width(container_, 0, LV_STATE_DEFAULT);
 
-    // Main zone (takes remaining space, with flex column for multi-view pattern)
+    // Main zone (takes remaining space, with flex column for multi-view pattern).
+    // Grows from a px base, so view content never re-lays the container.
     main_zone_ = lv_obj_create(container_);
-    lv_obj_set_size(main_zone_, LV_PCT(100), LV_SIZE_CONTENT);
-    lv_obj_set_flex_grow(main_zone_, 1);
+    lv_obj_set_width(main_zone_, LV_PCT(100));
+    growAsBoundary(main_zone_);
     lv_obj_set_layout(main_zone_, LV_LAYOUT_FLEX);
     lv_obj_set_flex_flow(main_zone_, LV_FLEX_FLOW_COLUMN);
     lv_obj_set_style_pad_gap(main_zone_, 0, LV_STATE_DEFAULT);
@@ -34,9 +40,51 @@ ViewContainer::ViewContainer(lv_obj_t* parent) {
     style::apply(bottom_zone_).transparent();
     lv_obj_set_style_pad_all(bottom_zone_, 0, LV_STATE_DEFAULT);
     lv_obj_set_style_border_width(bottom_zone_, 0, LV_STATE_DEFAULT);
+    // Pinned at its first resolved height: tempo/position text stays inside.
+    sealContentHeight(bottom_zone_);
+    MS_UI_PERF_OBJECTS(ViewContainer, container_);
+
+    views_ = std::make_unique<ViewRegistry>(main_zone_);
+    // That height may come from the fallback font while staged loading runs.
+    whenCoreFontsReady(CORE_FONTS_COMPLETE, onCoreFontsReady, this);
+}
+
+void ViewContainer::onCoreFontsReady(void* context) {
+    static_cast<ViewContainer*>(context)->reflowBottomZone();
+}
+
+void ViewContainer::reflowBottomZone() {
+    reflowContentHeight(bottom_zone_);
+}
+
+void ViewContainer::show() {
+    if (!container_ || !lv_obj_has_flag(container_, LV_OBJ_FLAG_HIDDEN)) return;
+    lv_obj_clear_flag(container_, LV_OBJ_FLAG_HIDDEN);
+    reveal(container_);
+}
+
+void ViewContainer::hide() {
+    if (!container_ || lv_obj_has_flag(container_, LV_OBJ_FLAG_HIDDEN)) return;
+    lv_obj_add_flag(container_, LV_OBJ_FLAG_HIDDEN);
+    occlude(container_);
+}
+
+void ViewContainer::setMainZoneOccluded(bool occluded) {
+    if (!main_zone_ || occluded == main_zone_occluded_) return;
+    main_zone_occluded_ = occluded;
+    if (occluded) {
+        occlude(main_zone_);
+    } else {
+        reveal(main_zone_);
+    }
 }
 
 ViewContainer::~ViewContainer() {
+    cancelCoreFontsReady(this);
+    // Registered views delete their own objects inside the main zone.
+    views_.reset();
+    setMainZoneOccluded(false);
+    if (container_ && lv_obj_has_flag(container_, LV_OBJ_FLAG_HIDDEN)) reveal(container_);
     if (container_) {
         lv_obj_delete(container_);
         container_ = nullptr;
@@ -10,16 +10,24 @@
  *
  * Pattern: Matches plugin-bitwig's ViewContainer (2-zone layout).
  * Views manage their own internal structure (e.g., MacroView has TopBar inside).
+ * Views registered with views() are built into mainZone on first activation.
  */
 
+#include <memory>
+
 #include <lvgl.h>
 
+#include <ms/ui/ViewRegistry.hpp>
+
 namespace ms::ui {
 
 /**
  * @brief Container managing main view and bottom zones
  *
- * Uses flex column layout with mainZone taking remaining space.
+ * Uses flex column layout with mainZone taking remaining space. Both zones
+ * are layout boundaries: mainZone grows from a fixed base and bottomZone is
+ * pinned to its height once its content has resolved, so a text change in
+ * either never re-lays the other.
  */
 class ViewContainer {
 public:
@@ -39,22 +47,42 @@ public:
     /// Get the main content zone (for views)
     lv_obj_t* getMainZone() const { return main_zone_; }
 
+    /// Lazily built views of the main zone
+    ViewRegistry& views() { return *views_; }
+
     /// Get the bottom zone (for TransportBar)
     lv_obj_t* getBottomZone() const { return bottom_zone_; }
 
+    /// Re-measure the bottom zone after its content changed height (also
+    /// done once every core font is loaded)
+    void reflowBottomZone();
+
     /// Get the root container
     lv_obj_t* getContainer() const { return container_; }
 
-    /// Show the container
-    void show() { lv_obj_clear_flag(container_, LV_OBJ_FLAG_HIDDEN); }
+    /// Show the container (uncovers every zone's widgets)
+    void show();
 
-    /// Hide the container
-    void hide() { lv_obj_add_flag(container_, LV_OBJ_FLAG_HIDDEN); }
+    /// Hide the container (covers every zone's widgets, see Occlusion.hpp)
+    void hide();
+
+    /**
+     * @brief Mark the main zone covered by something opaque it does not own
+     *
+     * Widgets in the zone pause timers and invalidation until uncovered.
+     * LayoutOverlay and ListOverlay need not call this: while open they
+     * cover their own scope (OverlayOcclusion in Occlusion.hpp).
+     */
+    void setMainZoneOccluded(bool occluded);
 
 private:
+    static void onCoreFontsReady(void* context);
+
     lv_obj_t* container_{nullptr};
     lv_obj_t* main_zone_{nullptr};
     lv_obj_t* bottom_zone_{nullptr};
+    std::unique_ptr<ViewRegistry> views_;
+    bool main_zone_occluded_{false};
 };
 
 }  // namespace ms::ui
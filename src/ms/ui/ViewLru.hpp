@@ -0,0 +1,87 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace ms::ui {
+
+/**
+ * Which lazily built views to keep: the most recently activated ones, up to
+ * a count and an optional byte budget. Pure bookkeeping; ViewRegistry does
+ * the building and destroying.
+ */
+template <std::size_t Capacity>
+class ViewLru {
+public:
+    static constexpr int NONE = -1;
+
+    /** keepBuilt 0 = no count limit, budgetBytes 0 = no byte limit. */
+    void setLimits(std::size_t keepBuilt, uint32_t budgetBytes) {
+        keepBuilt_ = keepBuilt;
+        budgetBytes_ = budgetBytes;
+    }
+
+    void markBuilt(std::size_t id, uint32_t bytes) {
+        auto& entry = entries_[id];
+        if (entry.built) builtBytes_ -= entry.bytes;
+        else ++builtCount_;
+        entry.built = true;
+        entry.bytes = bytes;
+        builtBytes_ += bytes;
+    }
+
+    void markDestroyed(std::size_t id) {
+        auto& entry = entries_[id];
+        if (!entry.built) return;
+        entry.built = false;
+        --builtCount_;
+        builtBytes_ -= entry.bytes;
+        entry.bytes = 0U;
+    }
+
+    void touch(std::size_t id) { entries_[id].lastUse = ++clock_; }
+
+    /** Pinned views (home screen, ...) are never evicted. */
+    void pin(std::size_t id, bool pinned) { entries_[id].pinned = pinned; }
+
+    /**
+     * Coldest built, unpinned view other than active while the limits are
+     * exceeded; NONE when within them or nothing can go.
+     */
+    [[nodiscard]] int nextEviction(int active) const {
+        const bool overCount = keepBuilt_ > 0U && builtCount_ > keepBuilt_;
+        const bool overBudget = budgetBytes_ > 0U && builtBytes_ > budgetBytes_;
+        if (!overCount && !overBudget) return NONE;
+        int coldest = NONE;
+        for (std::size_t id = 0; id < Capacity; ++id) {
+            const auto& entry = entries_[id];
+            if (!entry.built || entry.pinned || static_cast<int>(id) == active) continue;
+            if (coldest == NONE || entry.lastUse < entries_[static_cast<std::size_t>(coldest)].lastUse) {
+                coldest = static_cast<int>(id);
+            }
+        }
+        return coldest;
+    }
+
+    [[nodiscard]] bool built(std::size_t id) const { return entries_[id].built; }
+    [[nodiscard]] std::size_t builtCount() const { return builtCount_; }
+    [[nodiscard]] uint32_t builtBytes() const { return builtBytes_; }
+
+private:
+    struct Entry {
+        uint32_t lastUse = 0U;
+        uint32_t bytes = 0U;
+        bool built = false;
+        bool pinned = false;
+    };
+
+    std::array<Entry, Capacity> entries_{};
+    std::size_t keepBuilt_ = 0U;
+    uint32_t budgetBytes_ = 0U;
+    std::size_t builtCount_ = 0U;
+    uint32_t builtBytes_ = 0U;
+    uint32_t clock_ = 0U;
+};
+
+}  // namespace ms::ui
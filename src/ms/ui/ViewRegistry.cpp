@@ -0,0 +1,124 @@
+#include "ViewRegistry.hpp"
+
+#include <config/PlatformCompat.hpp>
+#include <oc/diagnostics/Performance.hpp>
+
+namespace ms::ui {
+
+namespace {
+
+const ViewStats EMPTY_STATS{};
+
+/** LVGL heap in use; 0 when the allocator cannot report it. */
+uint32_t lvglHeapUsed() {
+    lv_mem_monitor_t monitor{};
+    lv_mem_monitor(&monitor);
+    return monitor.total_size > monitor.free_size
+        ? static_cast<uint32_t>(monitor.total_size - monitor.free_size)
+        : 0U;
+}
+
+uint32_t elapsedMs(uint32_t startTick) {
+    const uint32_t elapsed = lv_tick_elaps(startTick);
+    return elapsed > 0U ? elapsed : 1U;
+}
+
+}  // namespace
+
+FLASHMEM ViewRegistry::ViewRegistry(lv_obj_t* zone) : zone_(zone) {
+    lru_.setLimits(MS_UI_VIEWS_KEEP_BUILT, MS_UI_VIEWS_BUDGET_BYTES);
+}
+
+FLASHMEM ViewRegistry::~ViewRegistry() {
+    // Views own LVGL objects inside zone_: destroy them while it exists.
+    for (std::size_t id = 0; id < count_; ++id) slots_[id].view.reset();
+}
+
+FLASHMEM int ViewRegistry::add(const ViewSpec& spec) {
+    if (!spec.factory || count_ >= MAX_VIEWS) return NONE;
+    const std::size_t id = count_++;
+    slots_[id].spec = spec;
+    lru_.pin(id, spec.pinned);
+    return static_cast<int>(id);
+}
+
+FLASHMEM oc::ui::lvgl::IComponent* ViewRegistry::activate(int id) {
+    if (!valid(id)) return nullptr;
+    const auto index = static_cast<std::size_t>(id);
+    auto& slot = slots_[index];
+    if (id == active_ && slot.view) return slot.view.get();
+
+    OC_PERF_SCOPE(perfSwitch, "ui.views.switch");
+    const uint32_t start = lv_tick_get();
+    if (!slot.view && !build(slot, index)) return nullptr;
+
+    if (valid(active_) && slots_[static_cast<std::size_t>(active_)].view) {
+        slots_[static_cast<std::size_t>(active_)].view->hide();
+    }
+    slot.view->show();
+    active_ = id;
+    lru_.touch(index);
+    trim();
+
+    slot.stats.lastSwitchMs = elapsedMs(start);
+    if (slot.stats.lastSwitchMs > slot.stats.maxSwitchMs) slot.stats.maxSwitchMs = slot.stats.lastSwitchMs;
+    return slot.view.get();
+}
+
+FLASHMEM bool ViewRegistry::build(Slot& slot, std::size_t id) {
+    OC_PERF_SCOPE(perfBuild, "ui.views.build");
+    const uint32_t start = lv_tick_get();
+    const uint32_t heapBefore = lvglHeapUsed();
+    slot.view = slot.spec.factory(zone_, slot.spec.context);
+    if (!slot.view) return false;
+    // Freshly built views start hidden; activate() shows the chosen one.
+    slot.view->hide();
+    const uint32_t heapAfter = lvglHeapUsed();
+
+    slot.stats.bytes = (heapAfter > heapBefore ? heapAfter - heapBefore : 0U) + slot.spec.extraBytes;
+    slot.stats.buildMs = elapsedMs(start);
+    ++slot.stats.builds;
+    lru_.markBuilt(id, slot.stats.bytes);
+    return true;
+}
+
+FLASHMEM void ViewRegistry::destroy(std::size_t id) {
+    auto& slot = slots_[id];
+    if (!slot.view) return;
+    slot.view.reset();
+    ++slot.stats.evictions;
+    lru_.markDestroyed(id);
+}
+
+FLASHMEM void ViewRegistry::trim() {
+    for (int cold = lru_.nextEviction(active_); cold != ViewLru<MAX_VIEWS>::NONE;
+         cold = lru_.nextEviction(active_)) {
+        destroy(static_cast<std::size_t>(cold));
+    }
+}
+
+FLASHMEM void ViewRegistry::setLimits(std::size_t keepBuilt, uint32_t budgetBytes) {
+    lru_.setLimits(keepBuilt, budgetBytes);
+    trim();
+}
+
+FLASHMEM void ViewRegistry::releaseCold() {
+    for (std::size_t id = 0; id < count_; ++id) {
+        if (static_cast<int>(id) == active_ || slots_[id].spec.pinned) continue;
+        destroy(id);
+    }
+}
+
+FLASHMEM oc::ui::lvgl::IComponent* ViewRegistry::view(int id) const {
+    return valid(id) ? slots_[static_cast<std::size_t>(id)].view.get() : nullptr;
+}
+
+FLASHMEM const char* ViewRegistry::name(int id) const {
+    return valid(id) ? slots_[static_cast<std::size_t>(id)].spec.name : "";
+}
+
+FLASHMEM const ViewStats& ViewRegistry::stats(int id) const {
+    return valid(id) ? slots_[static_cast<std::size_t>(id)].stats : EMPTY_STATS;
+}
+
+}  // namespace ms::ui
@@ -0,0 +1,116 @@
+#pragma once
+
+/**
+ * @file ViewRegistry.hpp
+ * @brief Views built on first activation, coldest ones destroyed under a budget
+ */
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <lvgl.h>
+#include <oc/ui/lvgl/IComponent.hpp>
+
+#include <ms/ui/ViewLru.hpp>
+
+#ifndef MS_UI_VIEWS_MAX
+#define MS_UI_VIEWS_MAX 16
+#endif
+
+// Views kept built, the active one included (0 = no count limit).
+#ifndef MS_UI_VIEWS_KEEP_BUILT
+#define MS_UI_VIEWS_KEEP_BUILT 3
+#endif
+
+// LVGL heap the built views may hold (0 = no byte limit).
+#ifndef MS_UI_VIEWS_BUDGET_BYTES
+#define MS_UI_VIEWS_BUDGET_BYTES 0
+#endif
+
+namespace ms::ui {
+
+/** Builds one view into zone; context is ViewSpec::context. */
+using ViewFactory = std::unique_ptr<oc::ui::lvgl::IComponent> (*)(lv_obj_t* zone, void* context);
+
+struct ViewSpec {
+    const char* name = "";
+    ViewFactory factory = nullptr;
+    void* context = nullptr;
+    // Heap the view holds outside LVGL (models, caches); added to the
+    // LVGL heap growth measured while it is built.
+    uint32_t extraBytes = 0;
+    // Never evicted (home view, views holding state that must survive).
+    bool pinned = false;
+};
+
+struct ViewStats {
+    uint32_t builds = 0;
+    uint32_t evictions = 0;
+    uint32_t bytes = 0;
+    /// Last construction, and last/slowest activate() including any build
+    uint32_t buildMs = 0;
+    uint32_t lastSwitchMs = 0;
+    uint32_t maxSwitchMs = 0;
+};
+
+/**
+ * Registry of the views shown in ViewContainer's main zone.
+ *
+ * Products register a factory per view at boot instead of building every
+ * view up front. activate() builds the view on first use, hides the
+ * previous one and keeps the MS_UI_VIEWS_KEEP_BUILT most recently used
+ * views alive, destroying colder ones while over the count or the byte
+ * budget. Construction and switch times are kept per view.
+ */
+class ViewRegistry {
+public:
+    static constexpr int NONE = -1;
+    static constexpr std::size_t MAX_VIEWS = MS_UI_VIEWS_MAX;
+
+    explicit ViewRegistry(lv_obj_t* zone);
+    ~ViewRegistry();
+
+    ViewRegistry(const ViewRegistry&) = delete;
+    ViewRegistry& operator=(const ViewRegistry&) = delete;
+
+    /** Register a view; returns its id, or NONE when full or invalid. */
+    int add(const ViewSpec& spec);
+
+    /** Show view id, building it first if needed; nullptr when it cannot be built. */
+    oc::ui::lvgl::IComponent* activate(int id);
+
+    /** Built view or nullptr; never builds. */
+    [[nodiscard]] oc::ui::lvgl::IComponent* view(int id) const;
+    [[nodiscard]] int active() const { return active_; }
+    [[nodiscard]] std::size_t count() const { return count_; }
+    [[nodiscard]] const char* name(int id) const;
+    [[nodiscard]] const ViewStats& stats(int id) const;
+    [[nodiscard]] std::size_t builtCount() const { return lru_.builtCount(); }
+    [[nodiscard]] uint32_t builtBytes() const { return lru_.builtBytes(); }
+
+    void setLimits(std::size_t keepBuilt, uint32_t budgetBytes);
+    /** Destroy every built view except the active and pinned ones. */
+    void releaseCold();
+
+private:
+    struct Slot {
+        ViewSpec spec{};
+        std::unique_ptr<oc::ui::lvgl::IComponent> view;
+        ViewStats stats{};
+    };
+
+    bool valid(int id) const { return id >= 0 && static_cast<std::size_t>(id) < count_; }
+    bool build(Slot& slot, std::size_t id);
+    void destroy(std::size_t id);
+    void trim();
+
+    lv_obj_t* zone_ = nullptr;
+    std::array<Slot, MAX_VIEWS> slots_{};
+    ViewLru<MAX_VIEWS> lru_{};
+    std::size_t count_ = 0;
+    int active_ = NONE;
+};
+
+}  // namespace ms::ui
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ms::ui {
+
+/** color over pixel at opa (0 keeps pixel, 255 gives color), per RGB565 channel. */
+[[nodiscard]] constexpr uint16_t blendRgb565(uint16_t pixel, uint16_t color, uint8_t opa) {
+    const uint32_t keep = 255U - opa;
+    auto channel = [&](uint32_t shift, uint32_t mask) {
+        const uint32_t under = (pixel >> shift) & mask;
+        const uint32_t over = (color >> shift) & mask;
+        return ((under * keep + over * opa + 127U) / 255U) << shift;
+    };
+    return static_cast<uint16_t>(channel(11U, 0x1FU) | channel(5U, 0x3FU) | channel(0U, 0x1FU));
+}
+
+/**
+ * Bake a backdrop's color and opacity into a captured RGB565 frame, once,
+ * so the frame can be shown opaque instead of alpha-blending the backdrop
+ * over live content every frame. strideBytes is the buffer row pitch.
+ */
+inline void dimRgb565(uint8_t* pixels, std::size_t strideBytes, uint32_t width, uint32_t height,
+                      uint16_t color, uint8_t opa) {
+    if (!pixels || opa == 0U) return;
+    for (uint32_t y = 0; y < height; ++y) {
+        auto* row = reinterpret_cast<uint16_t*>(pixels + y * strideBytes);
+        for (uint32_t x = 0; x < width; ++x) row[x] = blendRgb565(row[x], color, opa);
+    }
+}
+
+}  // namespace ms::ui
@@ -0,0 +1,123 @@
+#include "BackdropSnapshot.hpp"
+
+#include <config/PlatformCompat.hpp>
+#include <oc/diagnostics/Performance.hpp>
+
+#include <ms/ui/component/BackdropDim.hpp>
+#include <ms/ui/component/Occlusion.hpp>
+
+namespace ms::ui {
+
+FLASHMEM BackdropSnapshot::~BackdropSnapshot() {
+    // The overlay (and the image inside it) may already be gone.
+    reattachSiblings();
+    freeBuffer();
+}
+
+#if MS_UI_OVERLAY_SNAPSHOT && LV_USE_SNAPSHOT
+
+FLASHMEM bool BackdropSnapshot::capture(lv_obj_t* overlay) {
+    if (active()) return overlay == overlay_;
+    if (overlay != overlay_) image_ = nullptr;
+    overlay_ = overlay;
+    lv_obj_t* target = overlayScope(overlay_);
+    if (!overlay_ || !target) return false;
+
+    OC_PERF_SCOPE(perfCapture, "ui.overlay.snapshot");
+    // The capture must not contain the overlay itself.
+    const bool shown = !lv_obj_has_flag(overlay_, LV_OBJ_FLAG_HIDDEN);
+    if (shown) lv_obj_add_flag(overlay_, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_update_layout(target);
+    buffer_ = lv_snapshot_take(target, LV_COLOR_FORMAT_RGB565);
+    if (shown) lv_obj_clear_flag(overlay_, LV_OBJ_FLAG_HIDDEN);
+    if (!buffer_) return false;
+
+    backdrop_opa_ = lv_obj_get_style_bg_opa(overlay_, LV_PART_MAIN);
+    dimRgb565(buffer_->data, buffer_->header.stride, buffer_->header.w, buffer_->header.h,
+              lv_color_to_u16(lv_obj_get_style_bg_color(overlay_, LV_PART_MAIN)), backdrop_opa_);
+
+    if (!image_) {
+        image_ = lv_image_create(overlay_);
+        lv_obj_add_flag(image_, LV_OBJ_FLAG_IGNORE_LAYOUT);
+        lv_obj_remove_flag(image_, LV_OBJ_FLAG_CLICKABLE);
+        lv_obj_move_to_index(image_, 0);
+    }
+    lv_image_set_src(image_, buffer_);
+    // The capture covers the scope; place it at the scope's origin.
+    lv_area_t scopeArea;
+    lv_area_t overlayArea;
+    lv_obj_get_coords(target, &scopeArea);
+    lv_obj_get_coords(overlay_, &overlayArea);
+    lv_obj_set_pos(image_, scopeArea.x1 - overlayArea.x1, scopeArea.y1 - overlayArea.y1);
+    lv_obj_clear_flag(image_, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_set_style_bg_opa(overlay_, LV_OPA_TRANSP, LV_PART_MAIN);
+
+    // Timers beneath are already paused by the owner's OverlayOcclusion.
+    detachSiblings(target);
+    return true;
+}
+
+FLASHMEM void BackdropSnapshot::release() {
+    if (!active()) return;
+    reattachSiblings();
+    if (overlay_) lv_obj_set_style_bg_opa(overlay_, backdrop_opa_, LV_PART_MAIN);
+    if (image_) {
+        lv_obj_add_flag(image_, LV_OBJ_FLAG_HIDDEN);
+        lv_image_set_src(image_, nullptr);
+    }
+    freeBuffer();
+}
+
+FLASHMEM void BackdropSnapshot::freeBuffer() {
+    if (!buffer_) return;
+    lv_image_cache_drop(buffer_);
+    lv_draw_buf_destroy(buffer_);
+    buffer_ = nullptr;
+}
+
+#else
+
+FLASHMEM bool BackdropSnapshot::capture(lv_obj_t*) { return false; }
+
+FLASHMEM void BackdropSnapshot::release() {}
+
+FLASHMEM void BackdropSnapshot::freeBuffer() {}
+
+#endif
+
+FLASHMEM void BackdropSnapshot::detachSiblings(lv_obj_t* target) {
+    detached_count_ = 0;
+    const uint32_t count = lv_obj_get_child_cnt(target);
+    for (uint32_t i = 0; i < count && detached_count_ < detached_.size(); ++i) {
+        lv_obj_t* child = lv_obj_get_child(target, static_cast<int32_t>(i));
+        if (!child || child == overlay_ || lv_obj_has_flag(child, LV_OBJ_FLAG_HIDDEN)) continue;
+        detached_[detached_count_++] = child;
+    }
+    // Hide after collecting: hiding re-lays the scope, not the child order.
+    for (std::size_t i = 0; i < detached_count_; ++i) {
+        lv_obj_add_flag(detached_[i], LV_OBJ_FLAG_HIDDEN);
+        lv_obj_add_event_cb(detached_[i], onDetachedDelete, LV_EVENT_DELETE, this);
+    }
+}
+
+FLASHMEM void BackdropSnapshot::reattachSiblings() {
+    for (std::size_t i = 0; i < detached_count_; ++i) {
+        if (detached_[i]) {
+            lv_obj_remove_event_cb_with_user_data(detached_[i], onDetachedDelete, this);
+            lv_obj_clear_flag(detached_[i], LV_OBJ_FLAG_HIDDEN);
+        }
+        detached_[i] = nullptr;
+    }
+    detached_count_ = 0;
+}
+
+FLASHMEM void BackdropSnapshot::onDetachedDelete(lv_event_t* event) {
+    auto* self = static_cast<BackdropSnapshot*>(lv_event_get_user_data(event));
+    lv_obj_t* view = lv_event_get_current_target_obj(event);
+    if (!self) return;
+    for (std::size_t i = 0; i < self->detached_count_; ++i) {
+        if (self->detached_[i] == view) self->detached_[i] = nullptr;
+    }
+}
+
+}  // namespace ms::ui
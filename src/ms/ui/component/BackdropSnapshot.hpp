@@ -0,0 +1,74 @@
+#pragma once
+
+/**
+ * @file BackdropSnapshot.hpp
+ * @brief Static dimmed capture of the screen under a modal overlay
+ */
+
+#include <array>
+#include <cstddef>
+
+#include <lvgl.h>
+
+// Opt-in: 1 captures a frame-sized RGB565 backdrop per open overlay (about
+// 150 KB of LVGL heap at 320x240) while it is open. 0 keeps the live
+// alpha-blended backdrop.
+#ifndef MS_UI_OVERLAY_SNAPSHOT
+#define MS_UI_OVERLAY_SNAPSHOT 0
+#endif
+
+// Sibling views an overlay can detach from rendering while it is open.
+#ifndef MS_UI_OVERLAY_DETACHED_VIEWS
+#define MS_UI_OVERLAY_DETACHED_VIEWS 8
+#endif
+
+namespace ms::ui {
+
+/**
+ * Snapshot mode for a full-size semi-transparent overlay backdrop.
+ *
+ * capture() renders the overlay's parent (without the overlay) once into
+ * an RGB565 buffer, bakes the backdrop color and opacity into it and shows
+ * it as an opaque image behind the overlay's content. The parent's other
+ * children are hidden until release(), so meters, curves and the transport
+ * beneath stop invalidating and the open overlay redraws only itself.
+ * Pausing their timers is not done here: the owning overlay's
+ * OverlayOcclusion covers the same scope in every backdrop mode, and the
+ * snapshot relies on that. release() restores the visibility they had
+ * at capture time, so owners should not show or hide views beneath an
+ * open overlay. The image lives inside the overlay: owners release()
+ * before deleting it.
+ *
+ * Off unless the build sets MS_UI_OVERLAY_SNAPSHOT. When it is off, or the
+ * buffer cannot be allocated, capture() returns false before touching the
+ * overlay, and the live backdrop dims the screen as before.
+ */
+class BackdropSnapshot {
+public:
+    BackdropSnapshot() = default;
+    ~BackdropSnapshot();
+
+    BackdropSnapshot(const BackdropSnapshot&) = delete;
+    BackdropSnapshot& operator=(const BackdropSnapshot&) = delete;
+
+    /** overlay: the full-size backdrop object, normally still hidden. */
+    bool capture(lv_obj_t* overlay);
+    void release();
+
+    [[nodiscard]] bool active() const { return buffer_ != nullptr; }
+
+private:
+    void detachSiblings(lv_obj_t* scope);
+    void reattachSiblings();
+    void freeBuffer();
+    static void onDetachedDelete(lv_event_t* event);
+
+    lv_obj_t* overlay_ = nullptr;
+    lv_obj_t* image_ = nullptr;
+    lv_draw_buf_t* buffer_ = nullptr;
+    std::array<lv_obj_t*, MS_UI_OVERLAY_DETACHED_VIEWS> detached_{};
+    std::size_t detached_count_ = 0;
+    lv_opa_t backdrop_opa_ = LV_OPA_TRANSP;
+};
+
+}  // namespace ms::ui
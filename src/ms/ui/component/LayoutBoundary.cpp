@@ -0,0 +1,45 @@
+#include "LayoutBoundary.hpp"
+
+#include <config/PlatformCompat.hpp>
+
+namespace ms::ui {
+
+namespace {
+
+bool pinHeight(lv_obj_t* zone) {
+    const int32_t height = lv_obj_get_height(zone);
+    if (height <= 0) return false;
+    lv_obj_set_height(zone, height);
+    return true;
+}
+
+void onZoneResolved(lv_event_t* event) {
+    lv_obj_t* zone = lv_event_get_current_target_obj(event);
+    if (zone && pinHeight(zone)) lv_obj_remove_event_cb(zone, onZoneResolved);
+}
+
+}  // namespace
+
+FLASHMEM void sealContentHeight(lv_obj_t* zone) {
+    if (!zone) return;
+    lv_obj_remove_event_cb(zone, onZoneResolved);
+    if (pinHeight(zone)) return;
+    lv_obj_add_event_cb(zone, onZoneResolved, LV_EVENT_SIZE_CHANGED, nullptr);
+}
+
+FLASHMEM void reflowContentHeight(lv_obj_t* zone) {
+    if (!zone) return;
+    lv_obj_set_height(zone, LV_SIZE_CONTENT);
+    lv_obj_update_layout(zone);
+    sealContentHeight(zone);
+}
+
+FLASHMEM void growAsBoundary(lv_obj_t* slot) {
+    if (!slot) return;
+    // flex_grow sizes the slot; a px base (not LV_SIZE_CONTENT) means its
+    // children's sizes are never measured back up into the parent.
+    lv_obj_set_height(slot, 0);
+    lv_obj_set_flex_grow(slot, 1);
+}
+
+}  // namespace ms::ui
@@ -0,0 +1,32 @@
+#pragma once
+
+/**
+ * @file LayoutBoundary.hpp
+ * @brief Pin content-sized zones once resolved so they stop propagating layout
+ */
+
+#include <lvgl.h>
+
+namespace ms::ui {
+
+/**
+ * Make a content-height zone a layout boundary.
+ *
+ * An LV_SIZE_CONTENT child of a flex column re-runs its parent's layout
+ * (and every flex_grow sibling's) whenever its content changes size, e.g.
+ * on each tempo or position update in the transport bar. Once the zone has
+ * a height, it is pinned to that height in px; until then it pins itself
+ * on its first non-empty LV_EVENT_SIZE_CHANGED.
+ */
+void sealContentHeight(lv_obj_t* zone);
+
+/**
+ * Back to LV_SIZE_CONTENT for one layout (content legitimately changed
+ * height, e.g. a second transport row), then sealed again.
+ */
+void reflowContentHeight(lv_obj_t* zone);
+
+/** Flex-grow slot whose pixel base keeps content changes inside it. */
+void growAsBoundary(lv_obj_t* slot);
+
+}  // namespace ms::ui
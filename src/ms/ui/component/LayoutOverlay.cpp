@@ -1,6 +1,7 @@
 #include "LayoutOverlay.hpp"
 
 #include <config/PlatformCompat.hpp>
+#include <ms/ui/PerfCounters.hpp>
 #include <oc/ui/lvgl/style/StyleBuilder.hpp>
 #include <oc/ui/lvgl/theme/BaseTheme.hpp>
 
@@ -10,6 +11,7 @@ using namespace oc::ui::lvgl;
 namespace style = oc::ui::lvgl::style;
 
 FLASHMEM LayoutOverlay::LayoutOverlay(lv_obj_t* parent) : parent_(parent) {
+    MS_UI_PERF_CONSTRUCT(LayoutOverlay);
     // Fullscreen overlay with semi-transparent background
     overlay_ = lv_obj_create(parent_);
     lv_obj_add_flag(overlay_, LV_OBJ_FLAG_FLOATING);
@@ -44,9 +46,12 @@ FLASHMEM LayoutOverlay::LayoutOverlay(lv_obj_t* parent) : parent_(parent) {
     footer_ = lv_obj_create(container_);
     lv_obj_set_size(footer_, LV_PCT(100), LV_SIZE_CONTENT);
     style::apply(footer_).transparent().noScroll().pad(0);
+    MS_UI_PERF_OBJECTS(LayoutOverlay, overlay_);
 }
 
 FLASHMEM LayoutOverlay::~LayoutOverlay() {
+    backdrop_.release();
+    occlusion_.uncover();
     if (overlay_) {
         lv_obj_delete(overlay_);
         overlay_ = nullptr;
@@ -74,13 +79,23 @@ FLASHMEM void LayoutOverlay::showFooter(bool show) {
 }
 
 FLASHMEM void LayoutOverlay::setBackdropOpacity(lv_opa_t opacity) {
-    if (overlay_) {
+    if (!overlay_) return;
+    if (!backdrop_.active()) {
         lv_obj_set_style_bg_opa(overlay_, opacity, LV_STATE_DEFAULT);
+        return;
     }
+    // Re-bake the open snapshot with the new opacity.
+    backdrop_.release();
+    lv_obj_set_style_bg_opa(overlay_, opacity, LV_STATE_DEFAULT);
+    backdrop_.capture(overlay_);
 }
 
 FLASHMEM void LayoutOverlay::show() {
     if (overlay_) {
+        if (!visible_) {
+            occlusion_.cover(overlay_);
+            backdrop_.capture(overlay_);
+        }
         lv_obj_clear_flag(overlay_, LV_OBJ_FLAG_HIDDEN);
         visible_ = true;
     }
@@ -91,6 +106,8 @@ FLASHMEM void LayoutOverlay::hide() {
         lv_obj_add_flag(overlay_, LV_OBJ_FLAG_HIDDEN);
         visible_ = false;
     }
+    backdrop_.release();
+    occlusion_.uncover();
 }
 
 }  // namespace ms::ui
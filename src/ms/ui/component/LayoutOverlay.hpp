@@ -8,13 +8,18 @@
 #include <lvgl.h>
 #include <oc/ui/lvgl/IComponent.hpp>
 
+#include <ms/ui/component/BackdropSnapshot.hpp>
+#include <ms/ui/component/Occlusion.hpp>
+
 namespace ms::ui {
 
 /**
  * Base layout shell for modal overlays.
  *
  * Provides a pre-configured overlay structure with:
- * - Fullscreen semi-transparent background
+ * - Fullscreen semi-transparent background; with MS_UI_OVERLAY_SNAPSHOT it
+ *   is captured once on show() as a dimmed snapshot of the screen beneath
+ *   (see BackdropSnapshot)
  * - Flex column container with header/content/footer slots
  * - Auto-collapse: empty slots take no space
  * - Explicit show/hide control for each slot
@@ -61,6 +66,9 @@ private:
     lv_obj_t* header_ = nullptr;
     lv_obj_t* content_ = nullptr;
     lv_obj_t* footer_ = nullptr;
+    BackdropSnapshot backdrop_;
+    // Pauses widgets beneath while open, whatever the backdrop mode.
+    OverlayOcclusion occlusion_;
     bool visible_ = false;
 };
 
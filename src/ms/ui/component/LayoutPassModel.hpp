@@ -0,0 +1,79 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace ms::ui {
+
+/** How a node's height is decided, as far as layout propagation goes. */
+enum class LayoutSizing : uint8_t {
+    // LV_SIZE_CONTENT: follows its children, so their changes reach the parent.
+    Content = 0,
+    // Pixel size: a layout boundary, nothing inside it leaks out.
+    Fixed,
+    // flex_grow with a pixel base: sized by the parent, a boundary too.
+    Grow,
+};
+
+struct LayoutPassNode {
+    int16_t parent = -1;
+    LayoutSizing sizing = LayoutSizing::Content;
+};
+
+/**
+ * Host model of how far one content change (a label's text) spreads
+ * through a flex tree, counting the nodes whose layout runs again.
+ *
+ * The changed node re-lays itself. While the node whose size moved is
+ * Content-sized, its parent's flex pass runs, and every Grow sibling is
+ * resized and re-lays its whole subtree; the walk then continues with the
+ * parent. Fixed and Grow nodes stop it. This is the cost ViewContainer and
+ * LayoutView avoid by pinning their content-sized zones once resolved.
+ *
+ * The counts are outputs of this hand-written walk, not measurements: the
+ * model never runs LVGL's layout. Confirming them on target means counting
+ * LV_EVENT_LAYOUT_CHANGED on the zones.
+ */
+template <std::size_t N>
+class LayoutPassModel {
+public:
+    explicit LayoutPassModel(const std::array<LayoutPassNode, N>& nodes) : nodes_(nodes) {}
+
+    void setSizing(std::size_t node, LayoutSizing sizing) { nodes_[node].sizing = sizing; }
+
+    [[nodiscard]] uint32_t passesForContentChange(std::size_t changed) const {
+        uint32_t passes = 1U;
+        std::size_t node = changed;
+        while (nodes_[node].sizing == LayoutSizing::Content && nodes_[node].parent >= 0) {
+            const auto parent = static_cast<std::size_t>(nodes_[node].parent);
+            ++passes;
+            for (std::size_t sibling = 0; sibling < N; ++sibling) {
+                if (sibling == node || nodes_[sibling].parent != nodes_[node].parent) continue;
+                if (nodes_[sibling].sizing == LayoutSizing::Grow) passes += subtreeSize(sibling);
+            }
+            node = parent;
+        }
+        return passes;
+    }
+
+private:
+    [[nodiscard]] uint32_t subtreeSize(std::size_t root) const {
+        uint32_t size = 0U;
+        for (std::size_t node = 0; node < N; ++node) {
+            if (isWithin(node, root)) ++size;
+        }
+        return size;
+    }
+
+    [[nodiscard]] bool isWithin(std::size_t node, std::size_t root) const {
+        for (int16_t walk = static_cast<int16_t>(node); walk >= 0; walk = nodes_[static_cast<std::size_t>(walk)].parent) {
+            if (static_cast<std::size_t>(walk) == root) return true;
+        }
+        return false;
+    }
+
+    std::array<LayoutPassNode, N> nodes_{};
+};
+
+}  // namespace ms::ui
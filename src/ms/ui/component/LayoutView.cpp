@@ -1,5 +1,9 @@
 #include "LayoutView.hpp"
 
+#include <ms/ui/PerfCounters.hpp>
+#include <ms/ui/component/LayoutBoundary.hpp>
+#include <ms/ui/component/Occlusion.hpp>
+#include <ms/ui/font/CoreFonts.hpp>
 #include <oc/ui/lvgl/style/StyleBuilder.hpp>
 #include <oc/ui/lvgl/theme/BaseTheme.hpp>
 
@@ -9,6 +13,7 @@ namespace theme = oc::ui::lvgl::base_theme;
 namespace style = oc::ui::lvgl::style;
 
 LayoutView::LayoutView(lv_obj_t* parent) {
+    MS_UI_PERF_CONSTRUCT(LayoutView);
     if (!parent) return;
 
     container_ = lv_obj_create(parent);
@@ -20,14 +25,40 @@ LayoutView::LayoutView(lv_obj_t* parent) {
     header_ = lv_obj_create(container_);
     lv_obj_set_size(header_, LV_PCT(100), LV_SIZE_CONTENT);
     style::apply(header_).transparent().noScroll().pad(0).noBorder();
+    sealContentHeight(header_);
 
     content_ = lv_obj_create(container_);
     lv_obj_set_width(content_, LV_PCT(100));
-    lv_obj_set_flex_grow(content_, 1);
+    growAsBoundary(content_);
     style::apply(content_).transparent().noScroll().pad(0).noBorder();
+    MS_UI_PERF_OBJECTS(LayoutView, container_);
+    // The header may be pinned with the fallback font's line height.
+    whenCoreFontsReady(CORE_FONTS_COMPLETE, onCoreFontsReady, this);
+}
+
+void LayoutView::onCoreFontsReady(void* context) {
+    static_cast<LayoutView*>(context)->reflowHeader();
+}
+
+void LayoutView::reflowHeader() {
+    reflowContentHeight(header_);
+}
+
+void LayoutView::show() {
+    if (!container_ || !lv_obj_has_flag(container_, LV_OBJ_FLAG_HIDDEN)) return;
+    lv_obj_clear_flag(container_, LV_OBJ_FLAG_HIDDEN);
+    reveal(container_);
+}
+
+void LayoutView::hide() {
+    if (!container_ || lv_obj_has_flag(container_, LV_OBJ_FLAG_HIDDEN)) return;
+    lv_obj_add_flag(container_, LV_OBJ_FLAG_HIDDEN);
+    occlude(container_);
 }
 
 LayoutView::~LayoutView() {
+    cancelCoreFontsReady(this);
+    if (container_ && lv_obj_has_flag(container_, LV_OBJ_FLAG_HIDDEN)) reveal(container_);
     if (container_) {
         lv_obj_delete(container_);
         container_ = nullptr;
@@ -6,8 +6,11 @@
  *
  * Pure layout primitive (no state, no logic) used by views to get a consistent
  * structure:
- * - header: auto-height (typically a top bar)
+ * - header: auto-height (typically a top bar), pinned once resolved
  * - content: flex-grow (main view body)
+ *
+ * Both slots are layout boundaries (see LayoutBoundary.hpp): content
+ * changes inside one never re-lay the other or the view's parent.
  */
 
 #include <lvgl.h>
@@ -31,10 +34,17 @@ public:
     lv_obj_t* header() const { return header_; }
     lv_obj_t* content() const { return content_; }
 
-    void show() { if (container_) lv_obj_clear_flag(container_, LV_OBJ_FLAG_HIDDEN); }
-    void hide() { if (container_) lv_obj_add_flag(container_, LV_OBJ_FLAG_HIDDEN); }
+    /// Re-measure the header after its content changed height (also done
+    /// once every core font is loaded)
+    void reflowHeader();
+
+    /// Hidden views count as covered: their widgets' timers pause (Occlusion.hpp)
+    void show();
+    void hide();
 
 private:
+    static void onCoreFontsReady(void* context);
+
     lv_obj_t* container_ = nullptr;
     lv_obj_t* header_ = nullptr;
     lv_obj_t* content_ = nullptr;
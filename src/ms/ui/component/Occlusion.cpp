@@ -0,0 +1,71 @@
+#include "Occlusion.hpp"
+
+#include <cstddef>
+
+#include <config/PlatformCompat.hpp>
+
+namespace ms::ui {
+
+namespace {
+
+bool objWithin(const lv_obj_t* node, const lv_obj_t* ancestor) {
+    for (const lv_obj_t* walk = node; walk; walk = lv_obj_get_parent(walk)) {
+        if (walk == ancestor) return true;
+    }
+    return false;
+}
+
+using Registry = OcclusionRegistry<lv_obj_t, MS_UI_OCCLUSION_LISTENERS, MS_UI_OCCLUSION_SCOPES>;
+
+Registry& registry() {
+    static Registry instance(objWithin);
+    return instance;
+}
+
+}  // namespace
+
+FLASHMEM bool addOcclusionListener(lv_obj_t* root, OcclusionListener listener, void* context) {
+    return registry().add(root, listener, context);
+}
+
+FLASHMEM void removeOcclusionListener(void* context) {
+    registry().remove(context);
+}
+
+bool isOccluded(const void* context) {
+    return registry().occluded(context);
+}
+
+FLASHMEM void occlude(lv_obj_t* scope, lv_obj_t* except) {
+    const std::size_t overflows = registry().overflows();
+    if (!registry().occlude(scope, except) && registry().overflows() != overflows) {
+        LV_LOG_WARN("occlusion scope table full, raise MS_UI_OCCLUSION_SCOPES (%d)",
+                    MS_UI_OCCLUSION_SCOPES);
+    }
+}
+
+FLASHMEM void reveal(lv_obj_t* scope, lv_obj_t* except) {
+    registry().reveal(scope, except);
+}
+
+FLASHMEM lv_obj_t* overlayScope(lv_obj_t* overlay) {
+    lv_obj_t* parent = overlay ? lv_obj_get_parent(overlay) : nullptr;
+    if (parent == lv_layer_top() || parent == lv_layer_sys()) return lv_screen_active();
+    return parent;
+}
+
+FLASHMEM void OverlayOcclusion::cover(lv_obj_t* overlay) {
+    if (scope_ || !overlay) return;
+    scope_ = overlayScope(overlay);
+    overlay_ = overlay;
+    occlude(scope_, overlay_);
+}
+
+FLASHMEM void OverlayOcclusion::uncover() {
+    if (!scope_) return;
+    reveal(scope_, overlay_);
+    scope_ = nullptr;
+    overlay_ = nullptr;
+}
+
+}  // namespace ms::ui
@@ -0,0 +1,66 @@
+#pragma once
+
+/**
+ * @file Occlusion.hpp
+ * @brief Covered/uncovered signal from ms-ui containers to widgets with timers
+ */
+
+#include <lvgl.h>
+
+#include <ms/ui/component/OcclusionRegistry.hpp>
+
+// Widgets that can listen at once (curve previews, list overlays, menus).
+#ifndef MS_UI_OCCLUSION_LISTENERS
+#define MS_UI_OCCLUSION_LISTENERS 16
+#endif
+
+// Scopes covered at once: each hidden LayoutView, a hidden ViewContainer,
+// its main zone and each open overlay takes one. The default fits
+// MS_UI_VIEWS_MAX views kept built plus a few stacked overlays.
+#ifndef MS_UI_OCCLUSION_SCOPES
+#define MS_UI_OCCLUSION_SCOPES 24
+#endif
+
+namespace ms::ui {
+
+/**
+ * Tell context when root gets covered or uncovered. Widgets pause their
+ * timers and invalidation on true and resync once on false. Remove the
+ * listener before root is deleted.
+ */
+bool addOcclusionListener(lv_obj_t* root, OcclusionListener listener, void* context);
+void removeOcclusionListener(void* context);
+[[nodiscard]] bool isOccluded(const void* context);
+
+/**
+ * Cover every listener under scope except those under except. A full scope
+ * table (MS_UI_OCCLUSION_SCOPES) logs a warning and covers nothing.
+ */
+void occlude(lv_obj_t* scope, lv_obj_t* except = nullptr);
+void reveal(lv_obj_t* scope, lv_obj_t* except = nullptr);
+
+/** What a full-size overlay covers: its parent, or the screen for the top layer. */
+lv_obj_t* overlayScope(lv_obj_t* overlay);
+
+/**
+ * The cover a modal overlay casts while open: its overlayScope() minus its
+ * own subtree. Overlays cover() on show and uncover() on hide, whatever the
+ * backdrop mode; both are idempotent and destruction uncovers.
+ */
+class OverlayOcclusion {
+public:
+    OverlayOcclusion() = default;
+    ~OverlayOcclusion() { uncover(); }
+
+    OverlayOcclusion(const OverlayOcclusion&) = delete;
+    OverlayOcclusion& operator=(const OverlayOcclusion&) = delete;
+
+    void cover(lv_obj_t* overlay);
+    void uncover();
+
+private:
+    lv_obj_t* scope_ = nullptr;
+    lv_obj_t* overlay_ = nullptr;
+};
+
+}  // namespace ms::ui
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace ms::ui {
+
+/** occluded: true when the widget got covered, false when uncovered again. */
+using OcclusionListener = void (*)(void* context, bool occluded);
+
+/**
+ * Which registered widgets are currently covered, and the edge callbacks.
+ *
+ * Containers occlude() a scope (optionally minus the covering subtree,
+ * e.g. an overlay living inside the scope it covers) and reveal() it when
+ * done. Scopes nest: a listener hears true when its first covering scope
+ * appears and false when its last one goes, so a widget pauses once and
+ * resyncs once however many overlays were stacked over it. Node is the
+ * tree type (lv_obj_t on target); within() answers ancestry.
+ *
+ * Every hidden view and every open overlay holds one of the Scopes slots.
+ * When they are all taken occlude() fails and counts an overflow, and the
+ * widgets beneath keep running: size Scopes for the views a product keeps
+ * built plus the overlays it stacks.
+ */
+template <typename Node, std::size_t Listeners, std::size_t Scopes = 4U>
+class OcclusionRegistry {
+public:
+    using Within = bool (*)(const Node* node, const Node* ancestor);
+
+    explicit OcclusionRegistry(Within within) : within_(within) {}
+
+    /**
+     * Watch node for context; a node registered inside an active scope is
+     * told right away. False when every listener slot is taken.
+     */
+    bool add(const Node* node, OcclusionListener listener, void* context) {
+        if (!node || !listener) return false;
+        for (auto& entry : listeners_) {
+            if (entry.listener) continue;
+            entry = Entry{node, listener, context, 0U};
+            for (const auto& scope : scopes_) {
+                if (scope.node && covers(scope, node)) ++entry.depth;
+            }
+            if (entry.depth > 0U) listener(context, true);
+            return true;
+        }
+        return false;
+    }
+
+    void remove(void* context) {
+        for (auto& entry : listeners_) {
+            if (entry.listener && entry.context == context) entry = Entry{};
+        }
+    }
+
+    /**
+     * Cover scope except the except subtree; false when already covered or
+     * when the scope table is full (counted in overflows()).
+     */
+    bool occlude(const Node* scope, const Node* except = nullptr) {
+        if (!scope) return false;
+        Scope* free = nullptr;
+        for (auto& active : scopes_) {
+            if (active.node == scope && active.except == except) return false;
+            if (!active.node && !free) free = &active;
+        }
+        if (!free) {
+            ++overflows_;
+            return false;
+        }
+        *free = Scope{scope, except};
+        for (auto& entry : listeners_) {
+            if (!entry.listener || !covers(*free, entry.node)) continue;
+            if (entry.depth++ == 0U) entry.listener(entry.context, true);
+        }
+        return true;
+    }
+
+    /** Undo occlude(scope, except); false when it was not covered. */
+    bool reveal(const Node* scope, const Node* except = nullptr) {
+        for (auto& active : scopes_) {
+            if (!active.node || active.node != scope || active.except != except) continue;
+            const Scope revealed = active;
+            active = Scope{};
+            for (auto& entry : listeners_) {
+                if (!entry.listener || entry.depth == 0U || !covers(revealed, entry.node)) continue;
+                if (--entry.depth == 0U) entry.listener(entry.context, false);
+            }
+            return true;
+        }
+        return false;
+    }
+
+    [[nodiscard]] bool occluded(const void* context) const {
+        for (const auto& entry : listeners_) {
+            if (entry.listener && entry.context == context) return entry.depth > 0U;
+        }
+        return false;
+    }
+
+    /** occlude() calls dropped because every scope slot was taken. */
+    [[nodiscard]] std::size_t overflows() const { return overflows_; }
+
+private:
+    struct Entry {
+        const Node* node = nullptr;
+        OcclusionListener listener = nullptr;
+        void* context = nullptr;
+        uint8_t depth = 0U;
+    };
+
+    struct Scope {
+        const Node* node = nullptr;
+        const Node* except = nullptr;
+    };
+
+    bool covers(const Scope& scope, const Node* node) const {
+        if (!within_(node, scope.node)) return false;
+        return !scope.except || !within_(node, scope.except);
+    }
+
+    Within within_;
+    std::array<Entry, Listeners> listeners_{};
+    std::array<Scope, Scopes> scopes_{};
+    std::size_t overflows_ = 0U;
+};
+
+}  // namespace ms::ui
@@ -4,7 +4,9 @@
 #include <oc/ui/lvgl/style/StyleBuilder.hpp>
 #include <oc/ui/lvgl/theme/BaseTheme.hpp>
 
+#include <ms/ui/PerfCounters.hpp>
 #include <ms/ui/font/CoreFonts.hpp>
+#include <ms/ui/widget/LabelBitmapMode.hpp>
 
 namespace ms::ui {
 
@@ -25,10 +27,22 @@ FLASHMEM VirtualListOverlay::VirtualListOverlay(lv_obj_t* parent)
 
     createHeader();
     createList();
+    whenCoreFontsReady(CORE_FONTS_COMPLETE, onCoreFontsReady, this);
 
     hide();
 }
 
+FLASHMEM VirtualListOverlay::~VirtualListOverlay() { cancelCoreFontsReady(this); }
+
+FLASHMEM void VirtualListOverlay::onCoreFontsReady(void* context) {
+    static_cast<VirtualListOverlay*>(context)->applyFonts();
+}
+
+FLASHMEM void VirtualListOverlay::applyFonts() {
+    lv_obj_set_style_text_font(title_label_, coreFontOrDefault(fonts.inter_14_semibold), LV_STATE_DEFAULT);
+    lv_obj_set_style_text_font(meta_label_, coreFontOrDefault(fonts.inter_13_medium), LV_STATE_DEFAULT);
+}
+
 FLASHMEM void VirtualListOverlay::createHeader() {
     header_row_ = lv_obj_create(overlay_.header());
     lv_obj_set_size(header_row_, LV_PCT(100), LV_SIZE_CONTENT);
@@ -48,20 +62,18 @@ FLASHMEM void VirtualListOverlay::createHeader() {
     lv_obj_set_flex_grow(title_label_, 1);
     lv_label_set_long_mode(title_label_, LV_LABEL_LONG_DOT);
     lv_label_set_text(title_label_, "");
-    if (fonts.inter_14_semibold) {
-        lv_obj_set_style_text_font(title_label_, fonts.inter_14_semibold, LV_STATE_DEFAULT);
-    }
     style::apply(title_label_).textColor(base_theme::color::TEXT_PRIMARY);
+    enableLabelBitmapMode(title_label_);
 
     meta_label_ = lv_label_create(header_row_);
     lv_obj_set_width(meta_label_, LV_SIZE_CONTENT);
     lv_obj_set_style_text_align(meta_label_, LV_TEXT_ALIGN_RIGHT, LV_STATE_DEFAULT);
     lv_label_set_long_mode(meta_label_, LV_LABEL_LONG_DOT);
     lv_label_set_text(meta_label_, "");
-    if (fonts.inter_13_medium) {
-        lv_obj_set_style_text_font(meta_label_, fonts.inter_13_medium, LV_STATE_DEFAULT);
-    }
     style::apply(meta_label_).textColor(base_theme::color::TEXT_SECONDARY);
+    enableLabelBitmapMode(meta_label_);
+    applyFonts();
+    MS_UI_PERF_OBJECTS(LayoutOverlay, header_row_);
 }
 
 FLASHMEM void VirtualListOverlay::createList() {
@@ -79,21 +91,17 @@ FLASHMEM void VirtualListOverlay::configureList(int visibleCount, int itemHeight
 FLASHMEM void VirtualListOverlay::setTitle(const char* text) {
     if (!title_label_) return;
 
-    const char* next = text ? text : "";
-    if (title_cache_ == next) return;
-
-    title_cache_ = next;
+    if (!title_cache_.assign(text)) return;
     lv_label_set_text(title_label_, title_cache_.c_str());
+    MS_UI_PERF_COUNT(LayoutOverlay, LabelTextSets, 1U);
 }
 
 FLASHMEM void VirtualListOverlay::setMeta(const char* text) {
     if (!meta_label_) return;
 
-    const char* next = text ? text : "";
-    if (meta_cache_ == next) return;
-
-    meta_cache_ = next;
+    if (!meta_cache_.assign(text)) return;
     lv_label_set_text(meta_label_, meta_cache_.c_str());
+    MS_UI_PERF_COUNT(LayoutOverlay, LabelTextSets, 1U);
 }
 
 FLASHMEM void VirtualListOverlay::show() {
@@ -6,13 +6,14 @@
  */
 
 #include <memory>
-#include <string>
 
 #include <lvgl.h>
 
 #include <oc/ui/lvgl/IComponent.hpp>
 #include <oc/ui/lvgl/widget/VirtualList.hpp>
 
+#include <ms/ui/text/FixedText.hpp>
+
 #include "LayoutOverlay.hpp"
 
 namespace ms::ui {
@@ -20,7 +21,7 @@ namespace ms::ui {
 class VirtualListOverlay : public oc::ui::lvgl::IComponent {
 public:
     explicit VirtualListOverlay(lv_obj_t* parent);
-    ~VirtualListOverlay() override = default;
+    ~VirtualListOverlay() override;
 
     VirtualListOverlay(const VirtualListOverlay&) = delete;
     VirtualListOverlay& operator=(const VirtualListOverlay&) = delete;
@@ -29,6 +30,11 @@ public:
     lv_obj_t* headerRow() const { return header_row_; }
     oc::ui::lvgl::widget::VirtualList* list() const { return list_.get(); }
 
+    /**
+     * Header text is cached inline: anything past 63 bytes is cut on a
+     * UTF-8 boundary, and the label's long mode handles what still
+     * overflows the header width.
+     */
     void setTitle(const char* text);
     void setMeta(const char* text);
     void setBackdropOpacity(lv_opa_t opacity) {
@@ -47,14 +53,19 @@ public:
 private:
     void createHeader();
     void createList();
+    // Header fonts may still be loading at construction: re-applied once
+    // every core font is in.
+    void applyFonts();
+    static void onCoreFontsReady(void* context);
 
     LayoutOverlay overlay_;
 
     lv_obj_t* header_row_ = nullptr;
     lv_obj_t* title_label_ = nullptr;
     lv_obj_t* meta_label_ = nullptr;
-    std::string title_cache_;
-    std::string meta_cache_;
+    // Inline caches: setTitle()/setMeta() run on every render(props).
+    FixedText<64> title_cache_;
+    FixedText<64> meta_cache_;
 
     std::unique_ptr<oc::ui::lvgl::widget::VirtualList> list_;
 };
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <ms/ui/font/BinFont.hpp>
+
+namespace ms::ui {
+
+/**
+ * Direct-mapped descriptors for printable ASCII (0x20-0x7E).
+ *
+ * Built once when a font is mapped: lookups for row text skip the cmap
+ * search and the bit-packed glyf header and index a flat array instead.
+ * Codepoints outside the range (or glyphs the font lacks) fall back to
+ * BinFontView. Core fonts carry no kerning table, so there are no kerning
+ * classes to cache alongside.
+ */
+class AsciiGlyphTable {
+public:
+    static constexpr uint32_t FIRST = 0x20U;
+    static constexpr uint32_t LAST = 0x7EU;
+    static constexpr std::size_t COUNT = LAST - FIRST + 1U;
+
+    /** Fill from view; false (table left empty) if any entry does not fit. */
+    bool build(const BinFontView& view) {
+        clear();
+        if (!view.valid()) return false;
+        BinGlyph glyph{};
+        for (uint32_t codepoint = FIRST; codepoint <= LAST; ++codepoint) {
+            const uint32_t id = view.glyphIndex(codepoint);
+            Entry& entry = entries_[codepoint - FIRST];
+            if (id == 0U) continue;
+            if (!view.glyph(id, glyph) || !fits(id, glyph)) {
+                clear();
+                return false;
+            }
+            entry.id = static_cast<uint16_t>(id);
+            entry.advance16 = static_cast<uint16_t>(glyph.advance16);
+            entry.offsetX = static_cast<int8_t>(glyph.offsetX);
+            entry.offsetY = static_cast<int8_t>(glyph.offsetY);
+            entry.width = static_cast<uint8_t>(glyph.width);
+            entry.height = static_cast<uint8_t>(glyph.height);
+            entry.bitmapBit = glyph.bitmapBit;
+            entry.bitmapBits = static_cast<uint16_t>(glyph.bitmapBitEnd - glyph.bitmapBit);
+        }
+        built_ = true;
+        return true;
+    }
+
+    void clear() {
+        entries_.fill(Entry{});
+        built_ = false;
+    }
+
+    [[nodiscard]] bool built() const { return built_; }
+
+    static constexpr bool covers(uint32_t codepoint) {
+        return codepoint >= FIRST && codepoint <= LAST;
+    }
+
+    /**
+     * Glyph id and descriptor for a covered codepoint. Returns 0 (out left
+     * untouched) when the table is not built, the codepoint is outside the
+     * range or the font has no glyph for it.
+     */
+    uint32_t find(uint32_t codepoint, BinGlyph& out) const {
+        if (!built_ || !covers(codepoint)) return 0U;
+        const Entry& entry = entries_[codepoint - FIRST];
+        if (entry.id == 0U) return 0U;
+        out.advance16 = entry.advance16;
+        out.offsetX = entry.offsetX;
+        out.offsetY = entry.offsetY;
+        out.width = entry.width;
+        out.height = entry.height;
+        out.bitmapBit = entry.bitmapBit;
+        out.bitmapBitEnd = entry.bitmapBit + entry.bitmapBits;
+        return entry.id;
+    }
+
+    static constexpr std::size_t bytes() { return sizeof(std::array<Entry, COUNT>); }
+
+private:
+    struct Entry {
+        uint32_t bitmapBit = 0U;
+        uint16_t id = 0U;
+        uint16_t advance16 = 0U;
+        uint16_t bitmapBits = 0U;
+        int8_t offsetX = 0;
+        int8_t offsetY = 0;
+        uint8_t width = 0U;
+        uint8_t height = 0U;
+    };
+
+    static bool fits(uint32_t id, const BinGlyph& glyph) {
+        return id <= 0xFFFFU && glyph.advance16 <= 0xFFFFU && glyph.offsetX >= -128 &&
+            glyph.offsetX <= 127 && glyph.offsetY >= -128 && glyph.offsetY <= 127 &&
+            glyph.width <= 0xFFU && glyph.height <= 0xFFU &&
+            glyph.bitmapBitEnd - glyph.bitmapBit <= 0xFFFFU;
+    }
+
+    std::array<Entry, COUNT> entries_{};
+    bool built_ = false;
+};
+
+}  // namespace ms::ui
@@ -0,0 +1,401 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ms::ui {
+
+/**
+ * In-place reader for LVGL binary fonts (lv_font_conv `--format bin`).
+ *
+ * Nothing is copied: head, cmap, loca and glyf are read straight from the
+ * flash-resident blob, glyph descriptors are decoded from their bit-packed
+ * header on request and bitmaps are expanded into a caller buffer as 8-bit
+ * alpha. Fonts carrying a kerning table are rejected so callers fall back to
+ * the copying loader instead of silently losing kerning.
+ */
+struct BinFontInfo {
+    uint16_t fontSize = 0U;
+    uint16_t ascent = 0U;
+    int16_t descent = 0;
+    uint16_t defaultAdvance = 0U;
+    uint8_t bpp = 0U;
+    uint8_t compression = 0U;
+    int16_t underlinePosition = 0;
+    int16_t underlineThickness = 0;
+    uint32_t glyphCount = 0U;
+    /** Largest box_w * box_h of any glyph: the A8 bytes one glyph needs. */
+    uint32_t maxGlyphArea = 0U;
+
+    [[nodiscard]] int32_t lineHeight() const { return ascent - descent; }
+    [[nodiscard]] int32_t baseLine() const { return -descent; }
+};
+
+struct BinGlyph {
+    /** Advance in 1/16 px, as LVGL's fmt_txt descriptors store it. */
+    uint32_t advance16 = 0U;
+    int16_t offsetX = 0;
+    int16_t offsetY = 0;
+    uint16_t width = 0U;
+    uint16_t height = 0U;
+    /** Bitmap stream position inside the blob, in bits. */
+    uint32_t bitmapBit = 0U;
+    uint32_t bitmapBitEnd = 0U;
+
+    [[nodiscard]] uint32_t area() const {
+        return static_cast<uint32_t>(width) * height;
+    }
+};
+
+namespace binfont_detail {
+
+inline uint16_t u16(const uint8_t* p) {
+    return static_cast<uint16_t>(p[0] | (p[1] << 8));
+}
+
+inline uint32_t u32(const uint8_t* p) {
+    return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+        (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+/** MSB-first bit reader bounded to [bit, end). Reads past end yield 0. */
+class BitReader {
+public:
+    BitReader(const uint8_t* data, uint32_t bit, uint32_t end)
+        : data_(data), bit_(bit), end_(end) {}
+
+    uint32_t read(uint8_t count) {
+        uint32_t value = 0U;
+        while (count > 0U) {
+            if (bit_ >= end_) {
+                overrun_ = true;
+                value <<= count;
+                break;
+            }
+            const uint8_t offset = static_cast<uint8_t>(bit_ & 7U);
+            uint8_t take = static_cast<uint8_t>(8U - offset);
+            if (take > count) take = count;
+            if (bit_ + take > end_) take = static_cast<uint8_t>(end_ - bit_);
+            const uint32_t byte = data_[bit_ >> 3];
+            value = (value << take) |
+                ((byte >> (8U - offset - take)) & ((1U << take) - 1U));
+            bit_ += take;
+            count = static_cast<uint8_t>(count - take);
+        }
+        return value;
+    }
+
+    int32_t readSigned(uint8_t count) {
+        const uint32_t value = read(count);
+        if (count == 0U || (value & (1U << (count - 1U))) == 0U) {
+            return static_cast<int32_t>(value);
+        }
+        return static_cast<int32_t>(value) - static_cast<int32_t>(1U << count);
+    }
+
+    [[nodiscard]] uint32_t position() const { return bit_; }
+    [[nodiscard]] bool overrun() const { return overrun_; }
+
+private:
+    const uint8_t* data_;
+    uint32_t bit_;
+    uint32_t end_;
+    bool overrun_ = false;
+};
+
+/** lv_font_conv RLE: literal, repeat bit run, then a 6-bit counter. */
+class RleReader {
+public:
+    RleReader(BitReader& bits, uint8_t bpp) : bits_(bits), bpp_(bpp) {}
+
+    uint8_t next() {
+        uint8_t value = 0U;
+        switch (state_) {
+            case State::Single:
+                value = static_cast<uint8_t>(bits_.read(bpp_));
+                if (started_ && previous_ == value) {
+                    count_ = 0U;
+                    state_ = State::Repeat;
+                }
+                started_ = true;
+                previous_ = value;
+                break;
+            case State::Repeat:
+                ++count_;
+                if (bits_.read(1U) == 1U) {
+                    value = previous_;
+                    if (count_ == 11U) {
+                        count_ = static_cast<uint8_t>(bits_.read(6U));
+                        if (count_ != 0U) {
+                            state_ = State::Counter;
+                        } else {
+                            value = literal();
+                        }
+                    }
+                } else {
+                    value = literal();
+                }
+                break;
+            case State::Counter:
+                value = previous_;
+                if (--count_ == 0U) value = literal();
+                break;
+        }
+        return value;
+    }
+
+private:
+    enum class State : uint8_t { Single, Repeat, Counter };
+
+    uint8_t literal() {
+        previous_ = static_cast<uint8_t>(bits_.read(bpp_));
+        state_ = State::Single;
+        return previous_;
+    }
+
+    BitReader& bits_;
+    uint8_t bpp_;
+    State state_ = State::Single;
+    uint8_t previous_ = 0U;
+    uint8_t count_ = 0U;
+    bool started_ = false;
+};
+
+}  // namespace binfont_detail
+
+class BinFontView {
+public:
+    /** Map a font blob. Returns false for malformed or unsupported data. */
+    bool parse(const uint8_t* data, std::size_t size) {
+        using binfont_detail::u16;
+        using binfont_detail::u32;
+        *this = BinFontView{};
+        if (!data || size < HEAD_SIZE) return false;
+
+        std::size_t offset = 0U;
+        bool head = false;
+        while (offset + 8U <= size) {
+            const uint32_t length = u32(data + offset);
+            if (length < 8U || offset + length > size) return false;
+            const uint8_t* tag = data + offset + 4U;
+            if (tagIs(tag, "head")) {
+                if (length < HEAD_SIZE || !parseHead(data + offset)) return false;
+                head = true;
+            } else if (tagIs(tag, "cmap")) {
+                if (length < 12U) return false;
+                cmap_ = static_cast<uint32_t>(offset);
+                cmapCount_ = u32(data + offset + 8U);
+                if (12U + cmapCount_ * CMAP_SUBTABLE_SIZE > length) return false;
+            } else if (tagIs(tag, "loca")) {
+                if (length < 12U) return false;
+                loca_ = static_cast<uint32_t>(offset + 12U);
+                info_.glyphCount = u32(data + offset + 8U);
+                const std::size_t entry = locaWide_ ? 4U : 2U;
+                if (12U + info_.glyphCount * entry > length) return false;
+            } else if (tagIs(tag, "glyf")) {
+                glyf_ = static_cast<uint32_t>(offset);
+                glyfSize_ = length;
+            } else if (tagIs(tag, "kern")) {
+                return false;
+            }
+            offset += length;
+        }
+        if (!head || cmap_ == 0U || loca_ == 0U || glyf_ == 0U) return false;
+        data_ = data;
+        size_ = size;
+        // A8 expansion and lv_font_conv's 1..4 (or 8) bpp are supported;
+        // subpixel (LCD) fonts are not.
+        if (subpixel_ != 0U || info_.bpp == 0U || info_.bpp > 8U ||
+            info_.compression > 2U) {
+            data_ = nullptr;
+            return false;
+        }
+
+        BinGlyph glyph{};
+        for (uint32_t id = 1U; id < info_.glyphCount; ++id) {
+            if (!this->glyph(id, glyph)) {
+                data_ = nullptr;
+                return false;
+            }
+            if (glyph.area() > info_.maxGlyphArea) info_.maxGlyphArea = glyph.area();
+        }
+        return true;
+    }
+
+    [[nodiscard]] bool valid() const { return data_ != nullptr; }
+    [[nodiscard]] const BinFontInfo& info() const { return info_; }
+
+    /** Glyph id for a codepoint, 0 when the font does not cover it. */
+    [[nodiscard]] uint32_t glyphIndex(uint32_t codepoint) const {
+        using binfont_detail::u16;
+        using binfont_detail::u32;
+        if (!data_) return 0U;
+        for (uint32_t index = 0U; index < cmapCount_; ++index) {
+            const uint8_t* sub = data_ + cmap_ + 12U + index * CMAP_SUBTABLE_SIZE;
+            const uint32_t rangeStart = u32(sub + 4U);
+            const uint32_t rangeLength = u16(sub + 8U);
+            if (codepoint < rangeStart || codepoint >= rangeStart + rangeLength) continue;
+
+            const uint32_t delta = codepoint - rangeStart;
+            const uint32_t glyphStart = u16(sub + 10U);
+            const uint32_t entries = u16(sub + 12U);
+            const uint8_t* list = data_ + cmap_ + u32(sub);
+            switch (sub[14]) {
+                case CMAP_FORMAT0_TINY:
+                    return glyphStart + delta;
+                case CMAP_FORMAT0_FULL:
+                    if (delta >= entries) return 0U;
+                    return list[delta] != 0U ? glyphStart + list[delta] : 0U;
+                case CMAP_SPARSE_TINY:
+                case CMAP_SPARSE_FULL: {
+                    const int found = findSparse(list, entries, delta);
+                    if (found < 0) return 0U;
+                    if (sub[14] == CMAP_SPARSE_TINY) {
+                        return glyphStart + static_cast<uint32_t>(found);
+                    }
+                    const uint8_t* ids = list + entries * 2U;
+                    return glyphStart + u16(ids + static_cast<uint32_t>(found) * 2U);
+                }
+                default:
+                    return 0U;
+            }
+        }
+        return 0U;
+    }
+
+    /** Decode the bit-packed descriptor of glyph id. */
+    bool glyph(uint32_t id, BinGlyph& out) const {
+        out = BinGlyph{};
+        // Id 0 is the reserved "no glyph" entry: always empty.
+        if (id == 0U) return true;
+        if (!data_ || id >= info_.glyphCount) return false;
+
+        const uint32_t start = glyf_ + locaAt(id);
+        const uint32_t end = id + 1U < info_.glyphCount
+            ? glyf_ + locaAt(id + 1U)
+            : glyf_ + glyfSize_;
+        if (start < glyf_ + 8U || end < start || end > glyf_ + glyfSize_) return false;
+
+        binfont_detail::BitReader bits(data_, start * 8U, end * 8U);
+        out.advance16 = advanceBits_ == 0U ? info_.defaultAdvance : bits.read(advanceBits_);
+        if (advanceFormat_ == 0U) out.advance16 *= 16U;
+        out.offsetX = static_cast<int16_t>(bits.readSigned(xyBits_));
+        out.offsetY = static_cast<int16_t>(bits.readSigned(xyBits_));
+        out.width = static_cast<uint16_t>(bits.read(whBits_));
+        out.height = static_cast<uint16_t>(bits.read(whBits_));
+        out.bitmapBit = bits.position();
+        out.bitmapBitEnd = end * 8U;
+        return !bits.overrun();
+    }
+
+    /**
+     * Expand a glyph bitmap to 8-bit alpha rows of `stride` bytes. Fails if
+     * the buffer is too small or the stream ends before the last pixel.
+     */
+    bool decodeA8(const BinGlyph& glyph, uint8_t* out, std::size_t stride,
+                  std::size_t capacity) const {
+        if (!data_ || !out || stride < glyph.width) return false;
+        if (glyph.area() == 0U) return true;
+        if ((glyph.height - 1U) * stride + glyph.width > capacity) return false;
+
+        binfont_detail::BitReader bits(data_, glyph.bitmapBit, glyph.bitmapBitEnd);
+        binfont_detail::RleReader rle(bits, info_.bpp);
+        const bool compressed = info_.compression != 0U;
+        for (uint32_t y = 0U; y < glyph.height; ++y) {
+            uint8_t* row = out + y * stride;
+            for (uint32_t x = 0U; x < glyph.width; ++x) {
+                row[x] = static_cast<uint8_t>(compressed ? rle.next() : bits.read(info_.bpp));
+            }
+            // Compression 1 XORs each row with the one above before RLE.
+            if (info_.compression == 1U && y > 0U) {
+                const uint8_t* above = row - stride;
+                for (uint32_t x = 0U; x < glyph.width; ++x) row[x] ^= above[x];
+            }
+        }
+        if (bits.overrun()) return false;
+
+        if (info_.bpp != 8U) {
+            // Raw rows are still needed by the XOR pass; scale afterwards.
+            const uint32_t maxValue = (1U << info_.bpp) - 1U;
+            for (uint32_t y = 0U; y < glyph.height; ++y) {
+                uint8_t* row = out + y * stride;
+                for (uint32_t x = 0U; x < glyph.width; ++x) {
+                    row[x] = static_cast<uint8_t>((row[x] * 255U + maxValue / 2U) / maxValue);
+                }
+            }
+        }
+        return true;
+    }
+
+private:
+    static constexpr std::size_t HEAD_SIZE = 48U;
+    static constexpr std::size_t CMAP_SUBTABLE_SIZE = 16U;
+    static constexpr uint8_t CMAP_FORMAT0_FULL = 0U;
+    static constexpr uint8_t CMAP_SPARSE_FULL = 1U;
+    static constexpr uint8_t CMAP_FORMAT0_TINY = 2U;
+    static constexpr uint8_t CMAP_SPARSE_TINY = 3U;
+
+    static bool tagIs(const uint8_t* tag, const char* name) {
+        return tag[0] == static_cast<uint8_t>(name[0]) && tag[1] == static_cast<uint8_t>(name[1]) &&
+            tag[2] == static_cast<uint8_t>(name[2]) && tag[3] == static_cast<uint8_t>(name[3]);
+    }
+
+    bool parseHead(const uint8_t* head) {
+        using binfont_detail::u16;
+        using binfont_detail::u32;
+        if (u32(head + 8U) != 1U) return false;
+        info_.fontSize = u16(head + 14U);
+        info_.ascent = u16(head + 16U);
+        info_.descent = static_cast<int16_t>(u16(head + 18U));
+        info_.defaultAdvance = u16(head + 30U);
+        locaWide_ = head[34] != 0U;
+        advanceFormat_ = head[36];
+        info_.bpp = head[37];
+        xyBits_ = head[38];
+        whBits_ = head[39];
+        advanceBits_ = head[40];
+        info_.compression = head[41];
+        subpixel_ = head[42];
+        info_.underlinePosition = static_cast<int16_t>(u16(head + 44U));
+        info_.underlineThickness = static_cast<int16_t>(u16(head + 46U));
+        return xyBits_ <= 16U && whBits_ <= 16U && advanceBits_ <= 16U;
+    }
+
+    [[nodiscard]] uint32_t locaAt(uint32_t id) const {
+        return locaWide_ ? binfont_detail::u32(data_ + loca_ + id * 4U)
+                         : binfont_detail::u16(data_ + loca_ + id * 2U);
+    }
+
+    static int findSparse(const uint8_t* list, uint32_t entries, uint32_t delta) {
+        uint32_t low = 0U;
+        uint32_t high = entries;
+        while (low < high) {
+            const uint32_t mid = (low + high) / 2U;
+            const uint32_t value = binfont_detail::u16(list + mid * 2U);
+            if (value == delta) return static_cast<int>(mid);
+            if (value < delta) {
+                low = mid + 1U;
+            } else {
+                high = mid;
+            }
+        }
+        return -1;
+    }
+
+    const uint8_t* data_ = nullptr;
+    std::size_t size_ = 0U;
+    BinFontInfo info_{};
+    uint32_t cmap_ = 0U;
+    uint32_t cmapCount_ = 0U;
+    uint32_t loca_ = 0U;
+    uint32_t glyf_ = 0U;
+    uint32_t glyfSize_ = 0U;
+    bool locaWide_ = false;
+    uint8_t advanceFormat_ = 0U;
+    uint8_t xyBits_ = 0U;
+    uint8_t whBits_ = 0U;
+    uint8_t advanceBits_ = 0U;
+    uint8_t subpixel_ = 0U;
+};
+
+}  // namespace ms::ui
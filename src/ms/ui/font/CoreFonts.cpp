@@ -1,6 +1,10 @@
 #include "CoreFonts.hpp"
 
+#include <cstdio>
+#include <new>
+
 #include <config/PlatformCompat.hpp>
+#include <ms/ui/PerfCounters.hpp>
 
 // Some applications may embed ms-ui while also linking another library that
 // already provides the CoreFonts global symbols (fonts registry + entries).
@@ -25,43 +29,321 @@
 
 CoreFonts fonts;
 
+// field, binary, name, essential
+#define MS_UI_CORE_FONT_LIST(X)                                              \
+    /* Essential (splash) - loaded first during boot */                      \
+    X(splash_title, interdisplay_bold_20, "SplashTitle", true)               \
+    X(splash_version, jetbrainsmononl_medium_13, "SplashVersion", true)      \
+    /* Generic fonts - 12px */                                               \
+    X(inter_12_medium, interdisplay_medium_12, "Medium12", false)            \
+    /* Generic fonts - 13px */                                               \
+    X(inter_13_medium, interdisplay_medium_13, "Medium13", false)            \
+    X(inter_13_bold, interdisplay_bold_13, "Bold13", false)                  \
+    /* Generic fonts - 14px */                                               \
+    X(inter_14_light, interdisplay_light_14, "Light", false)                 \
+    X(inter_14_regular, interdisplay_regular_14, "Regular", false)           \
+    X(inter_14_medium, interdisplay_medium_14, "Medium", false)              \
+    X(inter_14_semibold, interdisplay_semibold_14, "SemiBold", false)        \
+    X(inter_14_bold, interdisplay_bold_14, "Bold", false)
+
+#define MS_UI_CORE_FONT_ENTRY(field, bin, name, essential) \
+    {&fonts.field, bin##_bin, bin##_bin_len, name, essential},
+
 const oc::ui::lvgl::font::Entry CORE_FONT_ENTRIES[] = {
-    // Essential (splash) - loaded first during boot
-    {&fonts.splash_title, interdisplay_bold_20_bin,
-     interdisplay_bold_20_bin_len, "SplashTitle", true},
-    {&fonts.splash_version, jetbrainsmononl_medium_13_bin,
-     jetbrainsmononl_medium_13_bin_len, "SplashVersion", true},
-
-    // Generic fonts - 12px
-    {&fonts.inter_12_medium, interdisplay_medium_12_bin,
-     interdisplay_medium_12_bin_len, "Medium12", false},
-
-    // Generic fonts - 13px
-    {&fonts.inter_13_medium, interdisplay_medium_13_bin,
-     interdisplay_medium_13_bin_len, "Medium13", false},
-    {&fonts.inter_13_bold, interdisplay_bold_13_bin,
-     interdisplay_bold_13_bin_len, "Bold13", false},
-
-    // Generic fonts - 14px
-    {&fonts.inter_14_light, interdisplay_light_14_bin,
-     interdisplay_light_14_bin_len, "Light", false},
-    {&fonts.inter_14_regular, interdisplay_regular_14_bin,
-     interdisplay_regular_14_bin_len, "Regular", false},
-    {&fonts.inter_14_medium, interdisplay_medium_14_bin,
-     interdisplay_medium_14_bin_len, "Medium", false},
-    {&fonts.inter_14_semibold, interdisplay_semibold_14_bin,
-     interdisplay_semibold_14_bin_len, "SemiBold", false},
-    {&fonts.inter_14_bold, interdisplay_bold_14_bin,
-     interdisplay_bold_14_bin_len, "Bold", false},
+    MS_UI_CORE_FONT_LIST(MS_UI_CORE_FONT_ENTRY)
 };
 
 const size_t CORE_FONT_COUNT = sizeof(CORE_FONT_ENTRIES) / sizeof(CORE_FONT_ENTRIES[0]);
 
+namespace {
+
+struct CoreFontSource {
+    lv_font_t** target;
+    const uint8_t* data;
+    uint32_t size;
+    const char* fileName;
+};
+
+#define MS_UI_CORE_FONT_SOURCE(field, bin, name, essential) \
+    {&fonts.field, bin##_bin, bin##_bin_len, #bin ".bin"},
+
+const CoreFontSource CORE_FONT_SOURCES[] = {
+    MS_UI_CORE_FONT_LIST(MS_UI_CORE_FONT_SOURCE)
+};
+
+constexpr size_t CORE_SOURCE_COUNT = sizeof(CORE_FONT_SOURCES) / sizeof(CORE_FONT_SOURCES[0]);
+
+// Mapped fonts (~1.5 KB each with the ASCII table), allocated by the first
+// lazy map: builds on the copying loader do not carry them. Lives for the
+// process, since LVGL keeps pointers into them.
+ms::ui::LazyBinFont* lazy_fonts = nullptr;
+
+FLASHMEM ms::ui::LazyBinFont* lazyFonts() {
+    if (!lazy_fonts) lazy_fonts = new (std::nothrow) ms::ui::LazyBinFont[CORE_SOURCE_COUNT];
+    return lazy_fonts;
+}
+
+}  // namespace
+
+FLASHMEM size_t mapCoreFontsLazy(ms::ui::GlyphStorage storage) {
+    MS_UI_PERF_CONSTRUCT(Fonts);
+    ms::ui::LazyBinFont* const lazy = lazyFonts();
+    size_t unmapped = 0;
+    for (size_t i = 0; i < CORE_SOURCE_COUNT; ++i) {
+        const CoreFontSource& source = CORE_FONT_SOURCES[i];
+        if (*source.target) continue;
+        if (lazy && lazy[i].map(source.data, source.size, storage)) {
+            *source.target = lazy[i].font();
+        } else {
+            ++unmapped;
+        }
+    }
+    return unmapped;
+}
+
+#if MS_UI_HAS_MMAP
+namespace {
+ms::ui::MappedFontFile font_files[CORE_SOURCE_COUNT];
+}  // namespace
+
+FLASHMEM size_t mapCoreFontFiles(const char* directory, ms::ui::GlyphStorage storage) {
+    MS_UI_PERF_CONSTRUCT(Fonts);
+    ms::ui::LazyBinFont* const lazy = lazyFonts();
+    size_t unmapped = 0;
+    char path[256];
+    for (size_t i = 0; i < CORE_SOURCE_COUNT; ++i) {
+        const CoreFontSource& source = CORE_FONT_SOURCES[i];
+        if (*source.target) continue;
+        std::snprintf(path, sizeof(path), "%s/%s", directory ? directory : ".", source.fileName);
+        auto& file = font_files[i];
+        if (lazy && file.open(path) && lazy[i].map(file.data(), file.size(), storage)) {
+            *source.target = lazy[i].font();
+        } else {
+            file.close();
+            ++unmapped;
+        }
+    }
+    return unmapped;
+}
+#endif
+
+// =============================================================================
+// Staged loading
+// =============================================================================
+
+namespace {
+
+constexpr size_t ALIAS_COUNT = static_cast<size_t>(CoreFontAlias::COUNT);
+constexpr ms::ui::FontAliasMask ALL_ALIASES = (ms::ui::FontAliasMask{1} << ALIAS_COUNT) - 1U;
+
+#define MS_UI_CORE_FONT_ALIAS_BACKING(field, alias, backing) &fonts.backing,
+
+lv_font_t** const ALIAS_BACKING[] = {
+    MS_UI_CORE_FONT_ALIASES(MS_UI_CORE_FONT_ALIAS_BACKING)
+};
+
+struct StagedLoad {
+    uint8_t order[CORE_SOURCE_COUNT] = {};
+    uint8_t count = 0;
+    uint8_t next = 0;
+    ms::ui::FontAliasMask firstScreen = 0;
+    uint32_t budgetMs = 0;
+    uint32_t startTick = 0;
+    lv_timer_t* timer = nullptr;
+    lv_display_t* frameDisplay = nullptr;
+    CoreFontLoadStats stats{};
+};
+
+StagedLoad staged;
+ms::ui::FontReadiness<MS_UI_FONT_READY_CALLBACKS> readiness;
+
+constexpr uint32_t STAGED_SLICE_PERIOD_MS = 1;
+
+void loadedFlags(bool* loaded) {
+    for (size_t i = 0; i < CORE_SOURCE_COUNT; ++i) loaded[i] = *CORE_FONT_SOURCES[i].target != nullptr;
+}
+
+bool allCoreFontsLoaded() {
+    for (const CoreFontSource& source : CORE_FONT_SOURCES) {
+        if (!*source.target) return false;
+    }
+    return true;
+}
+
+// Table index of the font backing each alias.
+const uint8_t* aliasFonts() {
+    static uint8_t indices[ALIAS_COUNT];
+    static bool resolved = false;
+    if (resolved) return indices;
+    for (size_t alias = 0; alias < ALIAS_COUNT; ++alias) {
+        indices[alias] = ms::ui::NO_FONT_INDEX;
+        for (size_t i = 0; i < CORE_SOURCE_COUNT; ++i) {
+            if (CORE_FONT_SOURCES[i].target == ALIAS_BACKING[alias]) {
+                indices[alias] = static_cast<uint8_t>(i);
+            }
+        }
+    }
+    resolved = true;
+    return indices;
+}
+
+ms::ui::FontAliasMask readyAliases() {
+    bool loaded[CORE_SOURCE_COUNT];
+    loadedFlags(loaded);
+    return ms::ui::readyFontAliases(aliasFonts(), ALIAS_COUNT, loaded, CORE_SOURCE_COUNT);
+}
+
+void publishReadiness() {
+    linkCoreFontAliases();
+    const ms::ui::FontAliasMask ready = readyAliases();
+    const uint32_t elapsed = lv_tick_elaps(staged.startTick);
+    if (staged.stats.firstScreenReadyMs == 0 && (ready & staged.firstScreen) == staged.firstScreen) {
+        staged.stats.firstScreenReadyMs = elapsed > 0 ? elapsed : 1;
+    }
+    if (staged.next < staged.count) {
+        readiness.markReady(ready);
+        return;
+    }
+    // Done: aliases whose font failed to load stay on the fallback font,
+    // which is as ready as they will get.
+    staged.stats.completeMs = elapsed > 0 ? elapsed : 1;
+    readiness.markReady(ALL_ALIASES | CORE_FONTS_COMPLETE);
+}
+
+FLASHMEM void loadNextStaged() {
+    const CoreFontSource& source = CORE_FONT_SOURCES[staged.order[staged.next++]];
+    if (!*source.target) {
+        MS_UI_PERF_CONSTRUCT(Fonts);
+        *source.target =
+            lv_binfont_create_from_buffer(const_cast<uint8_t*>(source.data), source.size);
+    }
+    if (*source.target) {
+        ++staged.stats.loaded;
+    } else {
+        ++staged.stats.failed;
+    }
+    staged.stats.pending = static_cast<uint8_t>(staged.count - staged.next);
+    publishReadiness();
+}
+
+void stopStagedTimer() {
+    if (!staged.timer) return;
+    lv_timer_delete(staged.timer);
+    staged.timer = nullptr;
+}
+
+void onFirstFrame(lv_event_t*) {
+    if (staged.stats.firstFrameMs != 0) return;
+    const uint32_t elapsed = lv_tick_elaps(staged.startTick);
+    staged.stats.firstFrameMs = elapsed > 0 ? elapsed : 1;
+}
+
+// Dropped from timer context rather than from inside the display event.
+void releaseFrameHook() {
+    if (!staged.frameDisplay) return;
+    lv_display_remove_event_cb_with_user_data(staged.frameDisplay, onFirstFrame, &staged);
+    staged.frameDisplay = nullptr;
+}
+
+void onStagedSlice(lv_timer_t*) {
+    const uint32_t begin = lv_tick_get();
+    do {
+        loadNextStaged();
+    } while (staged.next < staged.count && lv_tick_elaps(begin) < staged.budgetMs);
+
+    const uint32_t spent = lv_tick_elaps(begin);
+    ++staged.stats.slices;
+    if (spent > staged.stats.longestSliceMs) staged.stats.longestSliceMs = spent;
+    if (staged.stats.firstFrameMs != 0) releaseFrameHook();
+    if (staged.next >= staged.count) stopStagedTimer();
+}
+
+}  // namespace
+
+#define MS_UI_CORE_FONT_LINK(field, alias, backing) \
+    fonts.field = fonts.backing ? fonts.backing : fallback;
+
 void linkCoreFontAliases() {
-    fonts.parameter_label = fonts.inter_14_regular;
-    fonts.parameter_value_label = fonts.inter_14_medium;
-    fonts.tempo_label = fonts.inter_14_semibold;
-    fonts.list_item_label = fonts.inter_14_semibold;
+    lv_font_t* const fallback = const_cast<lv_font_t*>(LV_FONT_DEFAULT);
+    MS_UI_CORE_FONT_ALIASES(MS_UI_CORE_FONT_LINK)
+    // Loaders that link once at the end release waiters here as well.
+    if (!stagedCoreFontLoadPending()) {
+        readiness.markReady(readyAliases() | (allCoreFontsLoaded() ? CORE_FONTS_COMPLETE : 0U));
+    }
 }
 
+FLASHMEM void startStagedCoreFontLoad(const CoreFontAlias* firstScreen,
+                                      size_t count,
+                                      uint32_t sliceBudgetMs) {
+    stopStagedTimer();
+    releaseFrameHook();
+    staged = StagedLoad{};
+    staged.budgetMs = sliceBudgetMs;
+    staged.startTick = lv_tick_get();
+    staged.stats.startedAtMs = staged.startTick;
+    staged.frameDisplay = lv_display_get_default();
+    if (staged.frameDisplay) {
+        lv_display_add_event_cb(staged.frameDisplay, onFirstFrame, LV_EVENT_REFR_READY, &staged);
+    }
+
+    uint8_t wanted[ALIAS_COUNT];
+    size_t wantedCount = 0;
+    for (size_t i = 0; i < count && firstScreen; ++i) {
+        const auto alias = static_cast<uint8_t>(firstScreen[i]);
+        if (alias >= ALIAS_COUNT) continue;
+        staged.firstScreen |= coreFontAliasBit(firstScreen[i]);
+        if (wantedCount < ALIAS_COUNT) wanted[wantedCount++] = alias;
+    }
+    bool loaded[CORE_SOURCE_COUNT];
+    loadedFlags(loaded);
+    staged.count = static_cast<uint8_t>(ms::ui::planFontLoadOrder(aliasFonts(),
+                                                                  ALIAS_COUNT,
+                                                                  wanted,
+                                                                  wantedCount,
+                                                                  loaded,
+                                                                  CORE_SOURCE_COUNT,
+                                                                  staged.order));
+    staged.stats.pending = staged.count;
+
+    publishReadiness();
+    if (staged.count > 0) staged.timer = lv_timer_create(onStagedSlice, STAGED_SLICE_PERIOD_MS, nullptr);
+}
+
+FLASHMEM void finishStagedCoreFontLoad() {
+    stopStagedTimer();
+    while (staged.next < staged.count) loadNextStaged();
+}
+
+bool stagedCoreFontLoadPending() {
+    return staged.next < staged.count;
+}
+
+bool whenCoreFontsReady(ms::ui::FontAliasMask aliases, void (*callback)(void*), void* context) {
+    if (readiness.whenReady(aliases, callback, context)) return true;
+    if (!callback || !stagedCoreFontLoadPending()) return false;
+    // No free slot: load the rest now rather than leave a widget on the
+    // fallback font for good.
+    finishStagedCoreFontLoad();
+    return readiness.whenReady(aliases, callback, context);
+}
+
+void cancelCoreFontsReady(void* context) {
+    readiness.cancel(context);
+}
+
+CoreFontLoadStats coreFontLoadStats() {
+    return staged.stats;
+}
+
+#else
+
+// The external registry loads its fonts up front: they are always ready.
+bool whenCoreFontsReady(ms::ui::FontAliasMask, void (*callback)(void*), void* context) {
+    if (!callback) return false;
+    callback(context);
+    return true;
+}
+
+void cancelCoreFontsReady(void*) {}
+
 #endif  // MS_UI_EXTERNAL_CORE_FONTS
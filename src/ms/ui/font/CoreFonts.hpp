@@ -5,12 +5,42 @@
  * @brief Core font registry for the application
  *
  * Defines the font storage structure and entry descriptors.
- * Fonts are loaded from flash into RAM on demand.
+ * Fonts are loaded from flash into RAM on demand, or mapped in place with
+ * glyphs decoded lazily (mapCoreFontsLazy()). Non-essential fonts can load
+ * in idle slices after the splash (startStagedCoreFontLoad()).
  */
 
 #include <lvgl.h>
 #include <oc/ui/lvgl/FontLoader.hpp>
 
+#include <ms/ui/font/FontStaging.hpp>
+#include <ms/ui/font/LazyBinFont.hpp>
+#include <ms/ui/font/MappedFontFile.hpp>
+
+// alias field, CoreFontAlias, backing generic field
+#define MS_UI_CORE_FONT_ALIASES(X)                                  \
+    X(parameter_label, ParameterLabel, inter_14_regular)            \
+    X(parameter_value_label, ParameterValueLabel, inter_14_medium)  \
+    X(tempo_label, TempoLabel, inter_14_semibold)                   \
+    X(list_item_label, ListItemLabel, inter_14_semibold)
+
+#define MS_UI_CORE_FONT_ALIAS_ENUM(field, alias, backing) alias,
+
+/// Semantic font aliases, in MS_UI_CORE_FONT_ALIASES order
+enum class CoreFontAlias : uint8_t {
+    MS_UI_CORE_FONT_ALIASES(MS_UI_CORE_FONT_ALIAS_ENUM)
+    COUNT
+};
+
+#undef MS_UI_CORE_FONT_ALIAS_ENUM
+
+constexpr ms::ui::FontAliasMask coreFontAliasBit(CoreFontAlias alias) {
+    return ms::ui::FontAliasMask{1} << static_cast<uint8_t>(alias);
+}
+
+/// Readiness bit past the aliases: every core font, generic ones included, is in
+constexpr ms::ui::FontAliasMask CORE_FONTS_COMPLETE = coreFontAliasBit(CoreFontAlias::COUNT);
+
 /**
  * @brief Core font storage
  *
@@ -42,16 +72,111 @@ struct CoreFonts {
 /// Global core fonts instance
 extern CoreFonts fonts;
 
+/**
+ * `font`, or LV_FONT_DEFAULT while it is still loading. Generic fields stay
+ * nullptr until staged loading reaches them; never hand those to LVGL.
+ */
+inline const lv_font_t* coreFontOrDefault(const lv_font_t* font) {
+    return font ? font : LV_FONT_DEFAULT;
+}
+
 /// Font entry descriptors (stored in flash)
 extern const oc::ui::lvgl::font::Entry CORE_FONT_ENTRIES[];
 
 /// Number of core font entries
 extern const size_t CORE_FONT_COUNT;
 
+/**
+ * @brief Map core fonts in place instead of copying them
+ *
+ * Alternative to the copying loader: each font keeps its tables in flash and
+ * decodes glyphs on draw, either into a shared LRU or straight into LVGL's
+ * draw buffer (see LazyBinFont.hpp). Entries already loaded are skipped;
+ * entries that cannot be served in place stay nullptr for the copying
+ * loader. Returns the number of such entries.
+ */
+size_t mapCoreFontsLazy(ms::ui::GlyphStorage storage = ms::ui::GlyphStorage::Cached);
+
+#if MS_UI_HAS_MMAP
+/**
+ * @brief Map core fonts from external `<binary>.bin` files (desktop/host)
+ *
+ * Same contract as mapCoreFontsLazy(), reading e.g.
+ * `<directory>/interdisplay_medium_14.bin` through mmap instead of the
+ * linked PROGMEM arrays. Mappings stay open for the process lifetime.
+ */
+size_t mapCoreFontFiles(const char* directory,
+                        ms::ui::GlyphStorage storage = ms::ui::GlyphStorage::Cached);
+#endif
+
 /**
  * @brief Link semantic font aliases
  *
  * Call after fonts are loaded to set up semantic aliases
- * (parameter_label, tempo_label, etc.)
+ * (parameter_label, tempo_label, etc.). Aliases whose backing font is not
+ * loaded yet fall back to LV_FONT_DEFAULT.
  */
 void linkCoreFontAliases();
+
+// =============================================================================
+// Staged loading
+// =============================================================================
+
+#ifndef MS_UI_FONT_SLICE_BUDGET_MS
+#define MS_UI_FONT_SLICE_BUDGET_MS 4
+#endif
+
+#ifndef MS_UI_FONT_READY_CALLBACKS
+#define MS_UI_FONT_READY_CALLBACKS 16
+#endif
+
+struct CoreFontLoadStats {
+    uint8_t loaded = 0;
+    uint8_t pending = 0;
+    uint8_t failed = 0;
+    uint32_t slices = 0;
+    uint32_t longestSliceMs = 0;
+    /// Since start: first-screen aliases ready / every font loaded (0 = not yet)
+    uint32_t firstScreenReadyMs = 0;
+    uint32_t completeMs = 0;
+    /// LVGL tick at start (boot until the splash fonts were in)
+    uint32_t startedAtMs = 0;
+    /// Since start: first frame rendered. Boot to first interactive frame is
+    /// startedAtMs + firstFrameMs; compare against finishStagedCoreFontLoad()
+    /// called right after start to measure what staging saves.
+    uint32_t firstFrameMs = 0;
+};
+
+/**
+ * @brief Load non-essential fonts in idle slices after the splash
+ *
+ * Call once the essential (splash) fonts are loaded, instead of loading the
+ * remaining entries up front. Fonts backing the firstScreen aliases load
+ * first, the rest follow; each LVGL timer pass loads fonts until
+ * sliceBudgetMs is spent (at least one). Aliases are linked as their fonts
+ * arrive and point at LV_FONT_DEFAULT until then. Entries already set (e.g.
+ * by mapCoreFontsLazy()) are skipped.
+ */
+void startStagedCoreFontLoad(const CoreFontAlias* firstScreen,
+                             size_t count,
+                             uint32_t sliceBudgetMs = MS_UI_FONT_SLICE_BUDGET_MS);
+
+/// Load whatever is still pending right now (e.g. before a font-heavy screen)
+void finishStagedCoreFontLoad();
+
+bool stagedCoreFontLoadPending();
+
+/**
+ * @brief Run callback(context) once every alias in `aliases` is ready
+ *
+ * Runs immediately when they already are. Widgets built before their fonts
+ * re-apply them from the callback and must cancelCoreFontsReady(this) when
+ * destroyed first. Widgets using generic fonts wait for CORE_FONTS_COMPLETE.
+ * With every callback slot taken the staged load finishes on the spot, so
+ * the callback still runs (synchronously); returns false only when the
+ * fonts never become ready.
+ */
+bool whenCoreFontsReady(ms::ui::FontAliasMask aliases, void (*callback)(void*), void* context);
+void cancelCoreFontsReady(void* context);
+
+CoreFontLoadStats coreFontLoadStats();
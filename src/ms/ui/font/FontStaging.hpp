@@ -0,0 +1,130 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace ms::ui {
+
+/** One bit per semantic font alias (bit index = alias enum value). */
+using FontAliasMask = uint32_t;
+
+constexpr uint8_t NO_FONT_INDEX = 0xFFU;
+
+/**
+ * Order in which deferred fonts are loaded after the splash.
+ *
+ * Fonts backing the aliases the first screen asked for come first, in the
+ * order they were asked for; every other pending font follows in table
+ * order. Fonts already loaded (loaded[i]) are left out. aliasFont[a] is the
+ * table index backing alias a, or NO_FONT_INDEX. Returns the number of
+ * indices written to order (at most fontCount).
+ */
+inline std::size_t planFontLoadOrder(const uint8_t* aliasFont,
+                                     std::size_t aliasCount,
+                                     const uint8_t* wanted,
+                                     std::size_t wantedCount,
+                                     const bool* loaded,
+                                     std::size_t fontCount,
+                                     uint8_t* order) {
+    std::size_t count = 0;
+    auto push = [&](uint8_t font) {
+        if (font >= fontCount || loaded[font]) return;
+        for (std::size_t i = 0; i < count; ++i) {
+            if (order[i] == font) return;
+        }
+        order[count++] = font;
+    };
+    for (std::size_t i = 0; i < wantedCount; ++i) {
+        if (wanted[i] < aliasCount) push(aliasFont[wanted[i]]);
+    }
+    for (std::size_t font = 0; font < fontCount; ++font) push(static_cast<uint8_t>(font));
+    return count;
+}
+
+/**
+ * Aliases fully served once the given fonts are loaded: an alias is ready
+ * when its backing font is.
+ */
+inline FontAliasMask readyFontAliases(const uint8_t* aliasFont,
+                                      std::size_t aliasCount,
+                                      const bool* loaded,
+                                      std::size_t fontCount) {
+    FontAliasMask ready = 0U;
+    for (std::size_t alias = 0; alias < aliasCount; ++alias) {
+        const uint8_t font = aliasFont[alias];
+        if (font < fontCount && loaded[font]) ready |= FontAliasMask{1} << alias;
+    }
+    return ready;
+}
+
+/**
+ * Pending "fonts ready" notifications for widgets built before their fonts.
+ *
+ * A widget registers the alias set it renders with; the callback runs once,
+ * as soon as every alias in the set is ready (immediately if it already is).
+ * Widgets destroyed first must cancel() with their context. Fixed capacity,
+ * no allocation; whenReady() returns false when full.
+ */
+template <std::size_t Callbacks>
+class FontReadiness {
+public:
+    using Callback = void (*)(void* context);
+
+    bool whenReady(FontAliasMask aliases, Callback callback, void* context) {
+        if (!callback) return false;
+        if ((ready_ & aliases) == aliases) {
+            callback(context);
+            return true;
+        }
+        for (auto& waiter : waiters_) {
+            if (waiter.callback) continue;
+            waiter = Waiter{aliases, callback, context};
+            return true;
+        }
+        return false;
+    }
+
+    void cancel(void* context) {
+        for (auto& waiter : waiters_) {
+            if (waiter.context == context) waiter = Waiter{};
+        }
+    }
+
+    /** Add ready aliases and run every callback they satisfy. */
+    void markReady(FontAliasMask aliases) {
+        ready_ |= aliases;
+        for (auto& waiter : waiters_) {
+            if (!waiter.callback || (ready_ & waiter.aliases) != waiter.aliases) continue;
+            // Free the slot first: the callback may register again.
+            const Waiter fired = waiter;
+            waiter = Waiter{};
+            fired.callback(fired.context);
+        }
+    }
+
+    void reset() {
+        ready_ = 0U;
+        waiters_.fill(Waiter{});
+    }
+
+    [[nodiscard]] FontAliasMask ready() const { return ready_; }
+
+    [[nodiscard]] std::size_t waiting() const {
+        std::size_t count = 0;
+        for (const auto& waiter : waiters_) count += waiter.callback ? 1U : 0U;
+        return count;
+    }
+
+private:
+    struct Waiter {
+        FontAliasMask aliases = 0U;
+        Callback callback = nullptr;
+        void* context = nullptr;
+    };
+
+    std::array<Waiter, Callbacks> waiters_{};
+    FontAliasMask ready_ = 0U;
+};
+
+}  // namespace ms::ui
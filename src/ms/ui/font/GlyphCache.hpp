@@ -0,0 +1,178 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace ms::ui {
+
+struct GlyphCacheStats {
+    uint32_t hits = 0U;
+    uint32_t misses = 0U;
+    uint32_t evictions = 0U;
+    /** Glyphs larger than a slot, decoded straight to the caller. */
+    uint32_t bypasses = 0U;
+    std::size_t liveSlots = 0U;
+    std::size_t slots = 0U;
+    std::size_t slotBytes = 0U;
+};
+
+/**
+ * Bounded LRU of decoded glyph bitmaps shared by every lazily mapped font.
+ *
+ * Fixed-size slots keyed by (font, glyph id): a hash chain finds a slot, an
+ * intrusive list keeps recency, and a miss recycles the least recently used
+ * slot. RAM is Slots * SlotBytes regardless of how many fonts are mapped.
+ */
+template <std::size_t Slots, std::size_t SlotBytes>
+class GlyphCache {
+public:
+    static_assert(Slots > 1U && Slots < 0xFFFFU, "Slot indices are 16-bit");
+    static_assert(SlotBytes > 0U, "Slots need storage");
+
+    static constexpr std::size_t slotBytes() { return SlotBytes; }
+
+    static constexpr uint32_t key(uint16_t font, uint32_t glyph) {
+        return (static_cast<uint32_t>(font) << 16) | (glyph & 0xFFFFU);
+    }
+
+    GlyphCache() { clear(); }
+
+    /** Cached bitmap for key, promoted to most recently used; counts a hit. */
+    const uint8_t* find(uint32_t glyphKey) {
+        const uint16_t slot = lookup(glyphKey);
+        if (slot == NIL) return nullptr;
+        ++stats_.hits;
+        touch(slot);
+        return &pool_[slot * SlotBytes];
+    }
+
+    /**
+     * Slot to decode key into; counts a miss. The caller fills the bitmap
+     * and calls erase() if decoding fails.
+     */
+    uint8_t* insert(uint32_t glyphKey) {
+        ++stats_.misses;
+        uint16_t slot = free_;
+        if (slot != NIL) {
+            free_ = next_[slot];
+            ++stats_.liveSlots;
+        } else {
+            slot = tail_;
+            unlinkChain(slot);
+            unlinkRecency(slot);
+            ++stats_.evictions;
+        }
+        keys_[slot] = glyphKey;
+        const std::size_t bucket = bucketOf(glyphKey);
+        chain_[slot] = buckets_[bucket];
+        buckets_[bucket] = slot;
+        pushFront(slot);
+        return &pool_[slot * SlotBytes];
+    }
+
+    void erase(uint32_t glyphKey) {
+        const uint16_t slot = lookup(glyphKey);
+        if (slot != NIL) release(slot);
+    }
+
+    /** Drop every glyph of one font (font unmapped or replaced). */
+    void eraseFont(uint16_t font) {
+        uint16_t slot = head_;
+        while (slot != NIL) {
+            const uint16_t following = next_[slot];
+            if ((keys_[slot] >> 16) == font) release(slot);
+            slot = following;
+        }
+    }
+
+    void noteBypass() { ++stats_.bypasses; }
+
+    void clear() {
+        buckets_.fill(NIL);
+        head_ = NIL;
+        tail_ = NIL;
+        for (std::size_t index = 0; index < Slots; ++index) {
+            next_[index] = static_cast<uint16_t>(index + 1U < Slots ? index + 1U : NIL);
+        }
+        free_ = 0U;
+        stats_.liveSlots = 0U;
+    }
+
+    [[nodiscard]] GlyphCacheStats stats() const {
+        GlyphCacheStats stats = stats_;
+        stats.slots = Slots;
+        stats.slotBytes = SlotBytes;
+        return stats;
+    }
+
+private:
+    static constexpr uint16_t NIL = 0xFFFFU;
+    static constexpr std::size_t BUCKETS = Slots;
+
+    static std::size_t bucketOf(uint32_t glyphKey) {
+        return static_cast<std::size_t>((glyphKey * 2654435761U) >> 7) % BUCKETS;
+    }
+
+    uint16_t lookup(uint32_t glyphKey) const {
+        for (uint16_t slot = buckets_[bucketOf(glyphKey)]; slot != NIL; slot = chain_[slot]) {
+            if (keys_[slot] == glyphKey) return slot;
+        }
+        return NIL;
+    }
+
+    void release(uint16_t slot) {
+        unlinkChain(slot);
+        unlinkRecency(slot);
+        next_[slot] = free_;
+        free_ = slot;
+        --stats_.liveSlots;
+    }
+
+    void touch(uint16_t slot) {
+        if (head_ == slot) return;
+        unlinkRecency(slot);
+        pushFront(slot);
+    }
+
+    void pushFront(uint16_t slot) {
+        prev_[slot] = NIL;
+        next_[slot] = head_;
+        if (head_ != NIL) prev_[head_] = slot;
+        head_ = slot;
+        if (tail_ == NIL) tail_ = slot;
+    }
+
+    void unlinkRecency(uint16_t slot) {
+        if (prev_[slot] != NIL) {
+            next_[prev_[slot]] = next_[slot];
+        } else {
+            head_ = next_[slot];
+        }
+        if (next_[slot] != NIL) {
+            prev_[next_[slot]] = prev_[slot];
+        } else {
+            tail_ = prev_[slot];
+        }
+    }
+
+    void unlinkChain(uint16_t slot) {
+        uint16_t* link = &buckets_[bucketOf(keys_[slot])];
+        while (*link != NIL && *link != slot) link = &chain_[*link];
+        if (*link == slot) *link = chain_[slot];
+    }
+
+    std::array<uint8_t, Slots * SlotBytes> pool_{};
+    std::array<uint32_t, Slots> keys_{};
+    std::array<uint16_t, Slots> prev_{};
+    // Recency successor for live slots, free-list link otherwise.
+    std::array<uint16_t, Slots> next_{};
+    std::array<uint16_t, Slots> chain_{};
+    std::array<uint16_t, BUCKETS> buckets_{};
+    uint16_t head_ = NIL;
+    uint16_t tail_ = NIL;
+    uint16_t free_ = NIL;
+    GlyphCacheStats stats_{};
+};
+
+}  // namespace ms::ui
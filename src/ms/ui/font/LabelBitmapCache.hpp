@@ -0,0 +1,294 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace ms::ui {
+
+/** What a pre-rendered label bitmap depends on besides its color. */
+struct LabelBitmapKey {
+    uint32_t textHash = 0U;
+    uint32_t textLength = 0U;
+    const void* font = nullptr;
+    int16_t width = 0;
+    int16_t letterSpace = 0;
+    uint8_t longMode = 0U;
+
+    bool operator==(const LabelBitmapKey& other) const {
+        return textHash == other.textHash && textLength == other.textLength &&
+            font == other.font && width == other.width &&
+            letterSpace == other.letterSpace && longMode == other.longMode;
+    }
+};
+
+/** A8 bitmap, stride == width. */
+struct LabelBitmap {
+    const uint8_t* data = nullptr;
+    uint16_t width = 0U;
+    uint16_t height = 0U;
+    uint16_t index = 0U;
+    /** Changes whenever the slot's pixels or address change. */
+    uint32_t serial = 0U;
+};
+
+struct LabelBitmapCacheStats {
+    uint32_t hits = 0U;
+    uint32_t misses = 0U;
+    uint32_t evictions = 0U;
+    /** Bitmaps larger than the whole pool, drawn uncached. */
+    uint32_t bypasses = 0U;
+    uint32_t compactions = 0U;
+    /** Misses drawn uncached because pinned bitmaps left no room. */
+    uint32_t blocked = 0U;
+    std::size_t entries = 0U;
+    std::size_t bytes = 0U;
+    std::size_t peakBytes = 0U;
+    std::size_t capacityBytes = 0U;
+};
+
+/**
+ * Bounded LRU of rendered label/icon bitmaps.
+ *
+ * Bitmaps of any size share one Bytes pool; a miss that does not fit
+ * evicts least recently used entries, sliding the survivors down when
+ * the free space is fragmented. Entry slots are fixed, so LVGL-side image
+ * descriptors can live in a parallel array indexed by LabelBitmap::index.
+ * A pinned bitmap is neither evicted nor moved until unpinAll(): draw
+ * tasks that still read its pixels stay valid.
+ * The owner places the cache in the desired memory region (PSRAM on
+ * MIDI Studio hardware).
+ */
+template <std::size_t Bytes, std::size_t Entries>
+class LabelBitmapCache {
+public:
+    static_assert(Entries > 1U && Entries < 0xFFFFU, "Entry indices are 16-bit");
+    static_assert(Bytes > 0U && Bytes <= 0xFFFFFFFFU, "Pool offsets are 32-bit");
+
+    static constexpr std::size_t entries() { return Entries; }
+
+    LabelBitmapCache() { clear(); }
+
+    /** Cached bitmap for key, promoted to most recently used; counts a hit. */
+    bool find(const LabelBitmapKey& key, LabelBitmap& out) {
+        const uint16_t index = lookup(key);
+        if (index == NIL) return false;
+        ++stats_.hits;
+        touch(index);
+        out = bitmapOf(index);
+        return true;
+    }
+
+    /**
+     * Storage for a width x height bitmap under key; counts a miss. Returns
+     * nullptr when it cannot fit even in an empty pool (a bypass) or beside
+     * the pinned bitmaps (blocked). The caller fills every byte and calls
+     * erase() if rendering fails.
+     */
+    uint8_t* insert(const LabelBitmapKey& key, uint16_t width, uint16_t height, LabelBitmap& out) {
+        ++stats_.misses;
+        const uint32_t size = static_cast<uint32_t>(width) * height;
+        if (size == 0U || size > Bytes) {
+            ++stats_.bypasses;
+            return nullptr;
+        }
+        erase(key);
+        // Pinned bitmaps stay put, so a compaction may still leave the top
+        // short: evict and try again.
+        bool compacted = false;
+        while (free_ == NIL || Bytes - top_ < size) {
+            if (!compacted && free_ != NIL && Bytes - stats_.bytes >= size) {
+                compact();
+                compacted = true;
+                continue;
+            }
+            const uint16_t victim = oldestUnpinned();
+            if (victim == NIL) {
+                ++stats_.blocked;
+                return nullptr;
+            }
+            ++stats_.evictions;
+            release(victim);
+            compacted = false;
+        }
+
+        const uint16_t index = free_;
+        free_ = next_[index];
+        Entry& entry = entries_[index];
+        entry.key = key;
+        entry.offset = top_;
+        entry.width = width;
+        entry.height = height;
+        entry.serial = ++serial_;
+        live_[index] = true;
+        top_ += size;
+        stats_.bytes += size;
+        ++stats_.entries;
+        if (stats_.bytes > stats_.peakBytes) stats_.peakBytes = stats_.bytes;
+        pushFront(index);
+        out = bitmapOf(index);
+        return &pool_[entry.offset];
+    }
+
+    /** Keep bitmap's pixels in place until unpinAll() (end of the frame). */
+    void pin(const LabelBitmap& bitmap) {
+        if (bitmap.index < Entries && live_[bitmap.index] &&
+            entries_[bitmap.index].serial == bitmap.serial) {
+            pinned_[bitmap.index] = true;
+        }
+    }
+
+    void unpinAll() { pinned_.fill(false); }
+
+    /** Drops pinned bitmaps too: call outside rendering. */
+    void erase(const LabelBitmapKey& key) {
+        const uint16_t index = lookup(key);
+        if (index != NIL) release(index);
+    }
+
+    /** Drop every bitmap rendered with font (font unloaded or remapped). */
+    void eraseFont(const void* font) {
+        uint16_t index = head_;
+        while (index != NIL) {
+            const uint16_t following = next_[index];
+            if (entries_[index].key.font == font) release(index);
+            index = following;
+        }
+    }
+
+    void clear() {
+        live_.fill(false);
+        pinned_.fill(false);
+        head_ = NIL;
+        tail_ = NIL;
+        for (std::size_t index = 0; index < Entries; ++index) {
+            next_[index] = static_cast<uint16_t>(index + 1U < Entries ? index + 1U : NIL);
+        }
+        free_ = 0U;
+        top_ = 0U;
+        stats_.entries = 0U;
+        stats_.bytes = 0U;
+    }
+
+    [[nodiscard]] LabelBitmapCacheStats stats() const {
+        LabelBitmapCacheStats stats = stats_;
+        stats.capacityBytes = Bytes;
+        return stats;
+    }
+
+private:
+    static constexpr uint16_t NIL = 0xFFFFU;
+
+    struct Entry {
+        LabelBitmapKey key{};
+        uint32_t offset = 0U;
+        uint32_t serial = 0U;
+        uint16_t width = 0U;
+        uint16_t height = 0U;
+
+        [[nodiscard]] uint32_t size() const { return static_cast<uint32_t>(width) * height; }
+    };
+
+    LabelBitmap bitmapOf(uint16_t index) const {
+        const Entry& entry = entries_[index];
+        return LabelBitmap{&pool_[entry.offset], entry.width, entry.height, index, entry.serial};
+    }
+
+    uint16_t lookup(const LabelBitmapKey& key) const {
+        for (uint16_t index = head_; index != NIL; index = next_[index]) {
+            if (entries_[index].key == key) return index;
+        }
+        return NIL;
+    }
+
+    uint16_t oldestUnpinned() const {
+        for (uint16_t index = tail_; index != NIL; index = prev_[index]) {
+            if (!pinned_[index]) return index;
+        }
+        return NIL;
+    }
+
+    void release(uint16_t index) {
+        unlinkRecency(index);
+        live_[index] = false;
+        pinned_[index] = false;
+        stats_.bytes -= entries_[index].size();
+        --stats_.entries;
+        // Reclaim the top of the pool right away when it is the newest block.
+        if (entries_[index].offset + entries_[index].size() == top_) {
+            top_ = entries_[index].offset;
+        }
+        next_[index] = free_;
+        free_ = index;
+    }
+
+    /**
+     * Slide live bitmaps down in address order; moved entries get a new
+     * serial. Pinned ones stay and the next bitmap resumes past them.
+     */
+    void compact() {
+        ++stats_.compactions;
+        uint32_t cursor = 0U;
+        for (;;) {
+            uint16_t lowest = NIL;
+            for (uint16_t index = 0; index < Entries; ++index) {
+                if (!live_[index] || entries_[index].offset < cursor) continue;
+                if (lowest == NIL || entries_[index].offset < entries_[lowest].offset) lowest = index;
+            }
+            if (lowest == NIL) break;
+            Entry& entry = entries_[lowest];
+            if (entry.offset != cursor && !pinned_[lowest]) {
+                std::memmove(&pool_[cursor], &pool_[entry.offset], entry.size());
+                entry.offset = cursor;
+                entry.serial = ++serial_;
+            }
+            cursor = entry.offset + entry.size();
+            // Zero-sized entries never exist, so the scan always advances.
+        }
+        top_ = cursor;
+    }
+
+    void touch(uint16_t index) {
+        if (head_ == index) return;
+        unlinkRecency(index);
+        pushFront(index);
+    }
+
+    void pushFront(uint16_t index) {
+        prev_[index] = NIL;
+        next_[index] = head_;
+        if (head_ != NIL) prev_[head_] = index;
+        head_ = index;
+        if (tail_ == NIL) tail_ = index;
+    }
+
+    void unlinkRecency(uint16_t index) {
+        if (prev_[index] != NIL) {
+            next_[prev_[index]] = next_[index];
+        } else {
+            head_ = next_[index];
+        }
+        if (next_[index] != NIL) {
+            prev_[next_[index]] = prev_[index];
+        } else {
+            tail_ = prev_[index];
+        }
+    }
+
+    std::array<uint8_t, Bytes> pool_{};
+    std::array<Entry, Entries> entries_{};
+    std::array<uint16_t, Entries> prev_{};
+    // Recency successor for live entries, free-list link otherwise.
+    std::array<uint16_t, Entries> next_{};
+    std::array<bool, Entries> live_{};
+    std::array<bool, Entries> pinned_{};
+    uint16_t head_ = NIL;
+    uint16_t tail_ = NIL;
+    uint16_t free_ = NIL;
+    uint32_t top_ = 0U;
+    uint32_t serial_ = 0U;
+    LabelBitmapCacheStats stats_{};
+};
+
+}  // namespace ms::ui
@@ -0,0 +1,144 @@
+#include "LazyBinFont.hpp"
+
+#include <cstring>
+#include <new>
+
+#include <config/PlatformCompat.hpp>
+#include <oc/diagnostics/Performance.hpp>
+
+namespace ms::ui {
+
+namespace {
+
+using SharedGlyphCache = GlyphCache<MS_UI_GLYPH_CACHE_SLOTS, MS_UI_GLYPH_CACHE_SLOT_BYTES>;
+
+// Allocated by the first Cached map(): builds that never map a font lazily
+// do not carry it (~20 KB at the defaults). Lives for the process.
+SharedGlyphCache* g_glyphs = nullptr;
+uint16_t g_next_font_id = 0;
+
+FLASHMEM SharedGlyphCache* glyphCache() {
+    if (!g_glyphs) g_glyphs = new (std::nothrow) SharedGlyphCache();
+    return g_glyphs;
+}
+
+FLASHMEM void copyRows(const uint8_t* source, uint16_t width, uint16_t height,
+                       uint8_t* target, uint32_t stride) {
+    for (uint16_t y = 0; y < height; ++y) {
+        std::memcpy(target + y * stride, source + y * width, width);
+    }
+}
+
+}  // namespace
+
+FLASHMEM LazyBinFont::~LazyBinFont() {
+    unmap();
+}
+
+FLASHMEM bool LazyBinFont::map(const uint8_t* data, std::size_t size, GlyphStorage storage) {
+    unmap();
+    if (!view_.parse(data, size)) return false;
+
+    // Without room for the shared cache, decode on every draw instead.
+    storage_ = (storage == GlyphStorage::Cached && !glyphCache()) ? GlyphStorage::Direct : storage;
+#if MS_UI_ASCII_GLYPH_TABLE
+    ascii_.build(view_);
+#endif
+    const BinFontInfo& info = view_.info();
+    id_ = g_next_font_id++;
+    font_ = lv_font_t{};
+    font_.get_glyph_dsc = getGlyphDsc;
+    font_.get_glyph_bitmap = getGlyphBitmap;
+    font_.line_height = info.lineHeight();
+    font_.base_line = info.baseLine();
+    font_.subpx = 0;
+    font_.underline_position = static_cast<int8_t>(info.underlinePosition);
+    font_.underline_thickness = static_cast<int8_t>(info.underlineThickness);
+    font_.dsc = this;
+    return true;
+}
+
+FLASHMEM void LazyBinFont::unmap() {
+    if (!view_.valid()) return;
+    if (g_glyphs) g_glyphs->eraseFont(id_);
+    view_ = BinFontView{};
+#if MS_UI_ASCII_GLYPH_TABLE
+    ascii_.clear();
+#endif
+    font_ = lv_font_t{};
+}
+
+bool LazyBinFont::getGlyphDsc(const lv_font_t* font,
+                              lv_font_glyph_dsc_t* dsc,
+                              uint32_t letter,
+                              uint32_t letterNext) {
+    (void)letterNext;
+    const auto* self = static_cast<const LazyBinFont*>(font->dsc);
+    // Same convention as LVGL's fmt_txt fonts: a tab is two spaces wide.
+    const bool tab = letter == '\t';
+    const uint32_t codepoint = tab ? ' ' : letter;
+
+    BinGlyph glyph{};
+#if MS_UI_ASCII_GLYPH_TABLE
+    uint32_t id = self->ascii_.find(codepoint, glyph);
+#else
+    uint32_t id = 0U;
+#endif
+    if (id == 0U) {
+        id = self->view_.glyphIndex(codepoint);
+        if (id == 0U || !self->view_.glyph(id, glyph)) return false;
+    }
+    const uint32_t advance16 = tab ? glyph.advance16 * 2U : glyph.advance16;
+    dsc->adv_w = static_cast<uint16_t>((advance16 + 8U) >> 4);
+    dsc->box_w = tab ? 0 : glyph.width;
+    dsc->box_h = tab ? 0 : glyph.height;
+    dsc->ofs_x = glyph.offsetX;
+    dsc->ofs_y = glyph.offsetY;
+    dsc->format = LV_FONT_GLYPH_FORMAT_A8;
+    dsc->is_placeholder = 0;
+    dsc->gid.index = id;
+    return true;
+}
+
+const void* LazyBinFont::getGlyphBitmap(lv_font_glyph_dsc_t* dsc, lv_draw_buf_t* drawBuf) {
+    if (!dsc || !drawBuf || !dsc->resolved_font) return nullptr;
+    const auto* self = static_cast<const LazyBinFont*>(dsc->resolved_font->dsc);
+    const uint32_t id = dsc->gid.index;
+
+    BinGlyph glyph{};
+    if (!self->view_.glyph(id, glyph)) return nullptr;
+    const uint32_t stride = drawBuf->header.stride;
+    const std::size_t capacity = drawBuf->data_size;
+    if (glyph.area() == 0U) return drawBuf;
+
+    if (self->storage_ == GlyphStorage::Direct) {
+        OC_PERF_SCOPE(perfDecode, "ui.font.decode-glyph");
+        return self->view_.decodeA8(glyph, drawBuf->data, stride, capacity) ? drawBuf : nullptr;
+    }
+
+    const uint32_t key = SharedGlyphCache::key(self->id_, id);
+    if (const uint8_t* cached = g_glyphs->find(key)) {
+        copyRows(cached, glyph.width, glyph.height, drawBuf->data, stride);
+        return drawBuf;
+    }
+
+    OC_PERF_SCOPE(perfDecode, "ui.font.decode-glyph");
+    if (glyph.area() > SharedGlyphCache::slotBytes()) {
+        g_glyphs->noteBypass();
+        return self->view_.decodeA8(glyph, drawBuf->data, stride, capacity) ? drawBuf : nullptr;
+    }
+
+    uint8_t* slot = g_glyphs->insert(key);
+    if (!self->view_.decodeA8(glyph, slot, glyph.width, SharedGlyphCache::slotBytes())) {
+        g_glyphs->erase(key);
+        return nullptr;
+    }
+    copyRows(slot, glyph.width, glyph.height, drawBuf->data, stride);
+    return drawBuf;
+}
+
+FLASHMEM GlyphCacheStats lazyGlyphCacheStats() {
+    return g_glyphs ? g_glyphs->stats() : GlyphCacheStats{};
+}
+
+}  // namespace ms::ui
@@ -0,0 +1,97 @@
+#pragma once
+
+/**
+ * @file LazyBinFont.hpp
+ * @brief lv_font_t served in place from a binary font, glyphs decoded on demand
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+#include <lvgl.h>
+
+#include <ms/ui/font/AsciiGlyphTable.hpp>
+#include <ms/ui/font/BinFont.hpp>
+#include <ms/ui/font/GlyphCache.hpp>
+
+// Shared decoded-glyph cache, allocated by the first Cached map(). The default
+// slot fits every glyph of the 12-14 px core fonts (largest is 196 A8 bytes);
+// bigger glyphs decode uncached.
+#ifndef MS_UI_GLYPH_CACHE_SLOTS
+#define MS_UI_GLYPH_CACHE_SLOTS 96
+#endif
+
+#ifndef MS_UI_GLYPH_CACHE_SLOT_BYTES
+#define MS_UI_GLYPH_CACHE_SLOT_BYTES 208
+#endif
+
+// Per-font direct-mapped ASCII descriptors (AsciiGlyphTable, ~1.5 KB each)
+// built at map time; 0 trades layout speed back for RAM.
+#ifndef MS_UI_ASCII_GLYPH_TABLE
+#define MS_UI_ASCII_GLYPH_TABLE 1
+#endif
+
+namespace ms::ui {
+
+/**
+ * Where a mapped font keeps decoded glyph bitmaps.
+ *
+ * - Cached: expand once into the shared GlyphCache, copy on later draws.
+ * - Direct: expand straight into LVGL's draw buffer on every draw; the font
+ *   owns no RAM beyond its descriptor (zero-copy).
+ */
+enum class GlyphStorage : uint8_t {
+    Cached = 0,
+    Direct,
+};
+
+/**
+ * LVGL font whose tables stay in the (flash-resident) binary.
+ *
+ * Unlike the copying binfont loader, map() keeps only the lv_font_t and a
+ * BinFontView: descriptors are decoded from glyf per lookup (printable ASCII
+ * comes from a table built at map time) and bitmaps are
+ * expanded to A8 into the shared GlyphCache on first draw. Per-font RAM is
+ * this object; glyph RAM is the cache working set shared by all fonts.
+ */
+class LazyBinFont {
+public:
+    LazyBinFont() = default;
+    ~LazyBinFont();
+
+    LazyBinFont(const LazyBinFont&) = delete;
+    LazyBinFont& operator=(const LazyBinFont&) = delete;
+
+    /**
+     * Map data in place (PROGMEM array or a MappedFontFile); data must
+     * outlive the mapping. Returns false when the blob needs the copying
+     * loader. Cached falls back to Direct if the shared cache cannot be
+     * allocated.
+     */
+    bool map(const uint8_t* data, std::size_t size, GlyphStorage storage = GlyphStorage::Cached);
+    void unmap();
+
+    [[nodiscard]] bool mapped() const { return view_.valid(); }
+    [[nodiscard]] lv_font_t* font() { return mapped() ? &font_ : nullptr; }
+    [[nodiscard]] const BinFontView& view() const { return view_; }
+
+private:
+    static bool getGlyphDsc(const lv_font_t* font,
+                            lv_font_glyph_dsc_t* dsc,
+                            uint32_t letter,
+                            uint32_t letterNext);
+    static const void* getGlyphBitmap(lv_font_glyph_dsc_t* dsc, lv_draw_buf_t* drawBuf);
+
+    lv_font_t font_{};
+    BinFontView view_{};
+#if MS_UI_ASCII_GLYPH_TABLE
+    AsciiGlyphTable ascii_{};
+#endif
+    uint16_t id_ = 0;
+    GlyphStorage storage_ = GlyphStorage::Cached;
+};
+
+/** Hit/miss/eviction counters of the shared decoded-glyph cache. */
+GlyphCacheStats lazyGlyphCacheStats();
+
+}  // namespace ms::ui
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Desktop (SDL) and host builds read external .bin fonts through mmap; the
+// firmware links its fonts as PROGMEM arrays and never opens files.
+#ifndef MS_UI_HAS_MMAP
+#if defined(__has_include)
+#if __has_include(<sys/mman.h>) && __has_include(<unistd.h>)
+#define MS_UI_HAS_MMAP 1
+#endif
+#endif
+#endif
+
+#ifndef MS_UI_HAS_MMAP
+#define MS_UI_HAS_MMAP 0
+#endif
+
+#if MS_UI_HAS_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace ms::ui {
+
+/**
+ * Read-only memory mapping of a font file.
+ *
+ * The mapping is what a BinFontView / LazyBinFont reads in place, so it
+ * must outlive every font mapped from it. open() returns false on targets
+ * without mmap.
+ */
+class MappedFontFile {
+public:
+    MappedFontFile() = default;
+    ~MappedFontFile() { close(); }
+
+    MappedFontFile(const MappedFontFile&) = delete;
+    MappedFontFile& operator=(const MappedFontFile&) = delete;
+
+    bool open(const char* path) {
+        close();
+#if MS_UI_HAS_MMAP
+        if (!path) return false;
+        const int fd = ::open(path, O_RDONLY);
+        if (fd < 0) return false;
+        struct stat info {};
+        if (::fstat(fd, &info) != 0 || info.st_size <= 0) {
+            ::close(fd);
+            return false;
+        }
+        const auto size = static_cast<std::size_t>(info.st_size);
+        void* mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        // The mapping keeps the file referenced; the descriptor is not needed.
+        ::close(fd);
+        if (mapping == MAP_FAILED) return false;
+        data_ = static_cast<const uint8_t*>(mapping);
+        size_ = size;
+        return true;
+#else
+        (void)path;
+        return false;
+#endif
+    }
+
+    void close() {
+#if MS_UI_HAS_MMAP
+        if (data_) ::munmap(const_cast<uint8_t*>(data_), size_);
+#endif
+        data_ = nullptr;
+        size_ = 0U;
+    }
+
+    [[nodiscard]] const uint8_t* data() const { return data_; }
+    [[nodiscard]] std::size_t size() const { return size_; }
+    [[nodiscard]] bool isOpen() const { return data_ != nullptr; }
+
+private:
+    const uint8_t* data_ = nullptr;
+    std::size_t size_ = 0U;
+};
+
+}  // namespace ms::ui
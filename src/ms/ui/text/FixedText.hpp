@@ -0,0 +1,52 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstring>
+
+#include <ms/ui/text/TextArena.hpp>
+
+namespace ms::ui {
+
+/**
+ * Inline, fixed-capacity NUL-terminated text used as a change cache for
+ * label text pushed from render(props).
+ *
+ * Never touches the heap. Text longer than Capacity - 1 bytes is cut at the
+ * last complete UTF-8 sequence so a label never receives a split glyph.
+ */
+template <std::size_t Capacity>
+class FixedText {
+public:
+    static_assert(Capacity > 1U, "FixedText needs room for one byte and NUL");
+
+    static constexpr std::size_t capacity() { return Capacity - 1U; }
+
+    /** Copy text in; returns true when the stored value changed. */
+    bool assign(const char* text) {
+        const char* source = text ? text : "";
+        const std::size_t length = utf8PrefixLength(source, capacity());
+        if (length == size_ && std::memcmp(data_.data(), source, length) == 0) {
+            return false;
+        }
+        std::memcpy(data_.data(), source, length);
+        data_[length] = '\0';
+        size_ = length;
+        return true;
+    }
+
+    void clear() {
+        data_[0] = '\0';
+        size_ = 0U;
+    }
+
+    [[nodiscard]] const char* c_str() const { return data_.data(); }
+    [[nodiscard]] std::size_t size() const { return size_; }
+    [[nodiscard]] bool empty() const { return size_ == 0U; }
+
+private:
+    std::array<char, Capacity> data_{};
+    std::size_t size_ = 0U;
+};
+
+}  // namespace ms::ui
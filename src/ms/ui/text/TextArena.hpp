@@ -0,0 +1,194 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace ms::ui {
+
+/** 32-bit FNV-1a over the first length bytes of text. */
+[[nodiscard]] constexpr uint32_t textHash(const char* text, std::size_t length) {
+    uint32_t hash = 2166136261U;
+    for (std::size_t index = 0; index < length; ++index) {
+        hash ^= static_cast<uint8_t>(text[index]);
+        hash *= 16777619U;
+    }
+    return hash;
+}
+
+inline constexpr uint32_t EMPTY_TEXT_HASH = textHash("", 0U);
+
+/**
+ * Length of text capped at maxLength bytes, cut back to a UTF-8 sequence
+ * boundary when the cap splits a glyph.
+ */
+[[nodiscard]] inline std::size_t utf8PrefixLength(const char* text, std::size_t maxLength) {
+    std::size_t length = 0U;
+    while (length < maxLength && text[length] != '\0') ++length;
+    if (text[length] == '\0') return length;
+    while (length > 0U && (static_cast<uint8_t>(text[length]) & 0xC0U) == 0x80U) --length;
+    return length;
+}
+
+/**
+ * Fixed-capacity interning pool for widget text.
+ *
+ * Identical strings share one NUL-terminated copy and a reference count, so
+ * a row cache and the slot label showing it cost the bytes once. Released
+ * strings leave holes that are squeezed out by an in-place compaction the
+ * next time an insert does not fit; handles are entry indices and survive
+ * compaction. The empty string is never stored.
+ *
+ * With ReservedBytes, every entry is guaranteed that many bytes (NUL
+ * included) however long the other strings are: Bytes can be sized for
+ * typical text instead of the longest. A string that would eat into the
+ * reserve of the free entries is cut, on a UTF-8 boundary, to what is left
+ * over (never below ReservedBytes - 1). Without it, an insert either fits
+ * whole or fails.
+ */
+template <std::size_t Bytes, std::size_t Entries, std::size_t ReservedBytes = 0U>
+class TextArena {
+public:
+    static_assert(Bytes > 1U && Bytes <= 0xFFFFU, "Arena offsets are 16-bit");
+    static_assert(Entries > 0U && Entries < 0xFFFFU, "Arena handles are 16-bit");
+    static_assert(ReservedBytes != 1U, "a reserve must hold a byte of text");
+    static_assert(Entries * ReservedBytes <= Bytes, "reserves must fit the arena");
+
+    static constexpr uint16_t EMPTY = 0xFFFFU;
+
+    struct Stats {
+        std::size_t liveEntries = 0U;
+        std::size_t liveBytes = 0U;
+        std::size_t failures = 0U;
+        std::size_t truncations = 0U;
+    };
+
+    /**
+     * Reference text (length bytes, hash from textHash()). Returns EMPTY for
+     * an empty string; sets ok to false when neither an entry nor the bytes
+     * are available even after compaction. With ReservedBytes the bytes
+     * always are, and text longer than the unreserved space is cut.
+     */
+    uint16_t acquire(const char* text, std::size_t length, uint32_t hash, bool& ok) {
+        ok = true;
+        if (length == 0U) return EMPTY;
+
+        int freeEntry = -1;
+        std::size_t freeEntries = 0U;
+        for (std::size_t index = 0; index < Entries; ++index) {
+            Entry& entry = entries_[index];
+            if (entry.refs == 0U) {
+                if (freeEntry < 0) freeEntry = static_cast<int>(index);
+                ++freeEntries;
+                continue;
+            }
+            if (entry.hash == hash && entry.length == length &&
+                std::memcmp(&bytes_[entry.offset], text, length) == 0) {
+                ++entry.refs;
+                return static_cast<uint16_t>(index);
+            }
+        }
+
+        if (ReservedBytes > 0U && freeEntry >= 0) {
+            // Leave every other free entry its reserve; this one gets at
+            // least its own.
+            const std::size_t budget = Bytes - charged_ - (freeEntries - 1U) * ReservedBytes;
+            if (length + 1U > budget) {
+                length = utf8PrefixLength(text, budget - 1U);
+                hash = textHash(text, length);
+                ++truncations_;
+            }
+        }
+
+        const std::size_t need = length + 1U;
+        if (freeEntry >= 0 && top_ + need > Bytes) compact();
+        if (freeEntry < 0 || length == 0U || top_ + need > Bytes) {
+            ++failures_;
+            ok = false;
+            return EMPTY;
+        }
+
+        charged_ += charge(length);
+        Entry& entry = entries_[static_cast<std::size_t>(freeEntry)];
+        entry.hash = hash;
+        entry.offset = static_cast<uint16_t>(top_);
+        entry.length = static_cast<uint16_t>(length);
+        entry.refs = 1U;
+        std::memcpy(&bytes_[top_], text, length);
+        bytes_[top_ + length] = '\0';
+        top_ += need;
+        return static_cast<uint16_t>(freeEntry);
+    }
+
+    void release(uint16_t handle) {
+        if (handle >= Entries) return;
+        Entry& entry = entries_[handle];
+        if (entry.refs == 0U) return;
+        if (--entry.refs != 0U) return;
+        charged_ -= charge(entry.length);
+        if (entry.offset + entry.length + 1U == top_) {
+            // Last string on the stack: reclaim without a compaction.
+            top_ = entry.offset;
+        }
+    }
+
+    [[nodiscard]] const char* text(uint16_t handle) const {
+        if (handle >= Entries || entries_[handle].refs == 0U) return "";
+        return &bytes_[entries_[handle].offset];
+    }
+
+    [[nodiscard]] Stats stats() const {
+        Stats stats{};
+        for (const Entry& entry : entries_) {
+            if (entry.refs == 0U) continue;
+            ++stats.liveEntries;
+            stats.liveBytes += entry.length + 1U;
+        }
+        stats.failures = failures_;
+        stats.truncations = truncations_;
+        return stats;
+    }
+
+private:
+    struct Entry {
+        uint32_t hash = 0U;
+        uint16_t offset = 0U;
+        uint16_t length = 0U;
+        uint16_t refs = 0U;
+    };
+
+    /** Bytes a live string holds against the budget: at least its reserve. */
+    static constexpr std::size_t charge(std::size_t length) {
+        return length + 1U > ReservedBytes ? length + 1U : ReservedBytes;
+    }
+
+    /** Slide live strings down in offset order, closing released holes. */
+    void compact() {
+        std::size_t write = 0U;
+        for (;;) {
+            Entry* next = nullptr;
+            for (Entry& entry : entries_) {
+                if (entry.refs == 0U || entry.offset < write) continue;
+                if (!next || entry.offset < next->offset) next = &entry;
+            }
+            if (!next) break;
+            const std::size_t size = next->length + 1U;
+            if (next->offset != write) {
+                std::memmove(&bytes_[write], &bytes_[next->offset], size);
+                next->offset = static_cast<uint16_t>(write);
+            }
+            write += size;
+        }
+        top_ = write;
+    }
+
+    std::array<char, Bytes> bytes_{};
+    std::array<Entry, Entries> entries_{};
+    std::size_t top_ = 0U;
+    std::size_t charged_ = 0U;
+    std::size_t failures_ = 0U;
+    std::size_t truncations_ = 0U;
+};
+
+}  // namespace ms::ui
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <ms/ui/text/TextArena.hpp>
+
+namespace ms::ui {
+
+/** Longest text kept by a list text cache (bytes, excluding NUL). */
+inline constexpr std::size_t TEXT_CACHE_MAX_LENGTH = 47U;
+
+/**
+ * Arena bytes budgeted per list text cache: 15 bytes of text plus NUL on
+ * average, longer than most labels and values rows show. Short text leaves
+ * slack that longer text uses.
+ */
+inline constexpr std::size_t TEXT_CACHE_TYPICAL_BYTES = 16U;
+
+/**
+ * Bytes each cache is guaranteed however the slack is spent (7 bytes of
+ * text plus NUL): once long text has used it up, new text is cut to what
+ * is left rather than rendered blank.
+ */
+inline constexpr std::size_t TEXT_CACHE_RESERVED_BYTES = 8U;
+
+/**
+ * Arena bytes for `caches` TextCaches at the typical length: RAM follows
+ * what rows show rather than TEXT_CACHE_MAX_LENGTH, and with the reserve
+ * an intern never fails, so no row renders blank.
+ */
+[[nodiscard]] constexpr std::size_t textArenaBytesFor(std::size_t caches) {
+    return caches * TEXT_CACHE_TYPICAL_BYTES;
+}
+
+/** The arena a widget with `Caches` row text caches interns into. */
+template <std::size_t Caches>
+using TextCacheArena = TextArena<textArenaBytesFor(Caches), Caches, TEXT_CACHE_RESERVED_BYTES>;
+
+/**
+ * Change detector for text that is only written out (a label the widget
+ * never reads back). Stores length and hash, no bytes: the unchanged check
+ * is two integer compares, at the cost of trusting a 32-bit FNV-1a match.
+ * A default stamp matches the empty string.
+ */
+struct TextStamp {
+    uint32_t hash = EMPTY_TEXT_HASH;
+    uint32_t length = 0U;
+
+    /** Returns true when text differs from the last update. */
+    bool update(const char* text) {
+        const char* source = text ? text : "";
+        return update(source, std::strlen(source));
+    }
+
+    bool update(const char* text, std::size_t nextLength) {
+        const uint32_t nextHash = textHash(text, nextLength);
+        if (nextHash == hash && nextLength == length) return false;
+        hash = nextHash;
+        length = static_cast<uint32_t>(nextLength);
+        return true;
+    }
+};
+
+/**
+ * TextStamp plus a reference into a widget's TextArena, for text the widget
+ * has to read back later (row data bound after render(), a scroller that
+ * re-applies its text). Plain data: the owner calls release() before it
+ * drops or overwrites a cache that may hold a reference.
+ */
+struct TextCache {
+    TextStamp stamp{};
+    uint16_t handle = 0xFFFFU;
+
+    /**
+     * Intern text; returns true when it differs from the cached value. In a
+     * reserving arena (TextCacheArena) text longer than the space left is
+     * cut and stays cut until it changes. When an arena without reserves is
+     * exhausted the cache reads empty and reports a change on every call,
+     * so the text lands as soon as space frees up.
+     */
+    template <typename Arena>
+    bool assign(Arena& arena, const char* text) {
+        const char* source = text ? text : "";
+        const std::size_t length = utf8PrefixLength(source, TEXT_CACHE_MAX_LENGTH);
+        if (!stamp.update(source, length)) return false;
+
+        arena.release(handle);
+        bool ok = true;
+        handle = arena.acquire(source, length, stamp.hash, ok);
+        if (!ok) {
+            // Matches no text: the next assign retries the intern.
+            stamp.hash = 0U;
+            stamp.length = UINT32_MAX;
+        }
+        return true;
+    }
+
+    template <typename Arena>
+    void release(Arena& arena) {
+        arena.release(handle);
+        *this = TextCache{};
+    }
+
+    template <typename Arena>
+    [[nodiscard]] const char* c_str(const Arena& arena) const {
+        return arena.text(handle);
+    }
+
+    /** True when c_str() reads "", a failed intern included. */
+    [[nodiscard]] bool empty() const { return handle == 0xFFFFU; }
+};
+
+}  // namespace ms::ui
@@ -47,6 +47,8 @@ public:
     lv_obj_t* getElement() const override;
 
 protected:
+    // Style items through overlay().setItemFont()/removeLabel(): rows are
+    // virtual, so pointers from getButton()/getLabel() do not outlive a scroll.
     ListOverlay& overlay() { return overlay_; }
     const ListOverlay& overlay() const { return overlay_; }
 
@@ -0,0 +1,52 @@
+#include "CoalescedSelection.hpp"
+
+#include <config/PlatformCompat.hpp>
+
+namespace ms::ui {
+
+FLASHMEM CoalescedSelection::CoalescedSelection(Commit commit, void* context)
+    : commit_(commit), context_(context) {}
+
+FLASHMEM CoalescedSelection::~CoalescedSelection() {
+    if (timer_) {
+        lv_timer_delete(timer_);
+        timer_ = nullptr;
+    }
+}
+
+FLASHMEM void CoalescedSelection::request(int index) {
+    index_ = index;
+    if (pending_) return;
+
+    if (!timer_) {
+        // Period 0: due on the very next lv_timer_handler() pass, so input
+        // latency never exceeds one frame.
+        timer_ = lv_timer_create(onTimer, 0, this);
+        if (!timer_) {
+            // No timer available: degrade to the immediate path.
+            if (commit_) commit_(context_, index_);
+            return;
+        }
+    }
+    pending_ = true;
+    lv_timer_resume(timer_);
+}
+
+FLASHMEM void CoalescedSelection::flush() {
+    if (!pending_) return;
+    pending_ = false;
+    if (timer_) lv_timer_pause(timer_);
+    if (commit_) commit_(context_, index_);
+}
+
+FLASHMEM void CoalescedSelection::cancel() {
+    pending_ = false;
+    if (timer_) lv_timer_pause(timer_);
+}
+
+FLASHMEM void CoalescedSelection::onTimer(lv_timer_t* timer) {
+    auto* self = static_cast<CoalescedSelection*>(lv_timer_get_user_data(timer));
+    if (self) self->flush();
+}
+
+}  // namespace ms::ui
@@ -0,0 +1,47 @@
+#pragma once
+
+/**
+ * @file CoalescedSelection.hpp
+ * @brief Per-frame commit of VirtualList selection moves
+ */
+
+#include <lvgl.h>
+
+namespace ms::ui {
+
+/**
+ * Latest-wins selection request applied once on the next LVGL timer pass.
+ *
+ * Several encoder detents can arrive between two frames. Each render() only
+ * records the requested index; the owner's commit callback moves the window
+ * and binds slots once, before the next refresh, so intermediate windows are
+ * never materialized. Data changes must flush() or cancel() first so a stale
+ * index is never applied over a new list shape.
+ */
+class CoalescedSelection {
+public:
+    using Commit = void (*)(void* context, int index);
+
+    CoalescedSelection(Commit commit, void* context);
+    ~CoalescedSelection();
+
+    CoalescedSelection(const CoalescedSelection&) = delete;
+    CoalescedSelection& operator=(const CoalescedSelection&) = delete;
+
+    void request(int index);
+    void flush();
+    void cancel();
+
+    bool pending() const { return pending_; }
+
+private:
+    static void onTimer(lv_timer_t* timer);
+
+    Commit commit_ = nullptr;
+    void* context_ = nullptr;
+    lv_timer_t* timer_ = nullptr;
+    int index_ = 0;
+    bool pending_ = false;
+};
+
+}  // namespace ms::ui
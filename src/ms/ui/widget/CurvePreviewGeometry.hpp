@@ -158,15 +158,114 @@ struct CurvePreviewDamage {
     }
 };
 
+// Coarsest density the quality governor may fall back to (quarter).
+inline constexpr uint8_t CURVE_PREVIEW_MAX_DENSITY_SHIFT = 2U;
+
+/**
+ * One sample per drawable pixel at densityShift 0; each further shift
+ * doubles the spacing between samples. Both end columns are always
+ * sampled, and the line segments between samples interpolate the rest.
+ */
 [[nodiscard]] constexpr std::size_t curvePreviewSampleCountForWidth(
-    int32_t width
+    int32_t width,
+    uint8_t densityShift = 0U
 ) {
     if (width < 2) return 0U;
-    return std::clamp<std::size_t>(
+    const std::size_t full = std::clamp<std::size_t>(
         static_cast<std::size_t>(width),
         2U,
         CURVE_PREVIEW_MAX_SAMPLE_COUNT
     );
+    const uint8_t shift =
+        std::min(densityShift, CURVE_PREVIEW_MAX_DENSITY_SHIFT);
+    const std::size_t step = std::size_t{1} << shift;
+    return ((full - 1U) + step - 1U) / step + 1U;
+}
+
+struct CurvePreviewQualityBudget {
+    // Rebuild plus draw time one preview may spend per update; 0 keeps
+    // full density unconditionally.
+    uint32_t budgetUs = 0U;
+    // Quiet time before stepping one density level finer again.
+    uint32_t restoreAfterMs = 250U;
+};
+
+/**
+ * Picks the curve sample density from measured rebuild + draw cost.
+ *
+ * Provider and draw cost scale with the sample count, so a rebuild over
+ * budget halves density until the estimate fits (at most quarter density).
+ * While the next finer level would not fit in three quarters of the budget
+ * the level holds; after restoreAfterMs without such pressure restore()
+ * steps one level finer, and the wait starts again. The caller passes its
+ * clock (lv_tick_get() on target), so the decisions are reproducible.
+ */
+class CurvePreviewQualityGovernor {
+public:
+    void configure(const CurvePreviewQualityBudget& budget) {
+        budget_ = budget;
+        if (budget_.budgetUs == 0U) shift_ = 0U;
+    }
+
+    [[nodiscard]] const CurvePreviewQualityBudget& budget() const {
+        return budget_;
+    }
+
+    [[nodiscard]] uint8_t densityShift() const { return shift_; }
+
+    void observe(uint32_t costUs, uint32_t nowMs) {
+        if (budget_.budgetUs == 0U) return;
+        const uint64_t budget = budget_.budgetUs;
+        uint64_t estimate = costUs;
+        if (estimate > budget) {
+            while (estimate > budget &&
+                   shift_ < CURVE_PREVIEW_MAX_DENSITY_SHIFT) {
+                estimate /= 2U;
+                ++shift_;
+            }
+            lastPressureMs_ = nowMs;
+            return;
+        }
+        if (estimate * 2U > budget - budget / 4U) lastPressureMs_ = nowMs;
+    }
+
+    [[nodiscard]] bool restoreDue(uint32_t nowMs) const {
+        return shift_ > 0U &&
+            nowMs - lastPressureMs_ >= budget_.restoreAfterMs;
+    }
+
+    void restore(uint32_t nowMs) {
+        if (shift_ == 0U) return;
+        --shift_;
+        lastPressureMs_ = nowMs;
+    }
+
+    void reset() {
+        shift_ = 0U;
+        lastPressureMs_ = 0U;
+    }
+
+private:
+    CurvePreviewQualityBudget budget_{};
+    uint32_t lastPressureMs_ = 0U;
+    uint8_t shift_ = 0U;
+};
+
+/**
+ * Density a rebuild for `update` samples at. Rolling traces (PATCH_LAST,
+ * ADVANCE) keep one sample per pixel whatever the governor picked:
+ * advance() then samples only the newly exposed columns, which costs less
+ * than re-sampling the whole width at any reduced density. The governor's
+ * level applies to authored curves, whose every update is a full rebuild.
+ */
+[[nodiscard]] constexpr uint8_t curvePreviewDensityShiftFor(
+    CurvePreviewGeometryUpdate update,
+    uint8_t governorShift
+) {
+    return update == CurvePreviewGeometryUpdate::PATCH_LAST ||
+            update == CurvePreviewGeometryUpdate::ADVANCE
+        ? 0U
+        : governorShift;
 }
 
 [[nodiscard]] constexpr uint16_t curvePreviewPositionQ16(
@@ -341,10 +440,12 @@ struct CurvePreviewGeometry {
         int32_t width,
         int32_t height,
         CurvePreviewSampleProvider provider,
-        void* context
+        void* context,
+        uint8_t densityShift = 0U
     ) {
         clear();
-        const std::size_t count = curvePreviewSampleCountForWidth(width);
+        const std::size_t count =
+            curvePreviewSampleCountForWidth(width, densityShift);
         if (count == 0U || height < 2 || provider == nullptr) return false;
 
         for (std::size_t index = 0; index < count; ++index) {
@@ -370,8 +471,8 @@ struct CurvePreviewGeometry {
     /**
      * Re-sample retained geometry in place and report the old/new raster
      * envelope of every changed segment. The caller must only use this when
-     * width and provider identity are stable; false clears geometry exactly
-     * like rebuild() after a rejected sample.
+     * width, density and provider identity are stable; false clears geometry
+     * exactly like rebuild() after a rejected sample.
      */
     [[nodiscard]] bool rebuildWithDamage(
         int32_t width,
@@ -379,9 +480,11 @@ struct CurvePreviewGeometry {
         CurvePreviewSampleProvider provider,
         void* context,
         bool includeBaseAndImpact,
-        CurvePreviewDamage& damage
+        CurvePreviewDamage& damage,
+        uint8_t densityShift = 0U
     ) {
-        const std::size_t count = curvePreviewSampleCountForWidth(width);
+        const std::size_t count =
+            curvePreviewSampleCountForWidth(width, densityShift);
         if (count < 2U || count != sampleCount || height < 2 ||
             provider == nullptr) {
             damage.clear();
@@ -490,7 +593,9 @@ struct CurvePreviewGeometry {
     /**
      * Shift a rolling trace left and sample only the newly exposed columns.
      * The caller must request a full rebuild when the provider is not a
-     * pixel-aligned rolling trace or when advanceCount spans the full surface.
+     * pixel-aligned rolling trace, when the geometry was built below full
+     * density (see curvePreviewDensityShiftFor()), or when advanceCount
+     * spans the full surface.
      */
     [[nodiscard]] bool advance(
         uint16_t advanceCount,
@@ -7,6 +7,9 @@
 #include <oc/diagnostics/Performance.hpp>
 #include <oc/ui/lvgl/StaticSurfaceInvalidation.hpp>
 
+#include <ms/ui/PerfCounters.hpp>
+#include <ms/ui/component/Occlusion.hpp>
+
 namespace ms::ui {
 namespace {
 
@@ -243,11 +246,15 @@ FLASHMEM void drawMarker(
 }  // namespace
 
 FLASHMEM CurvePreviewWidget::CurvePreviewWidget(lv_obj_t* parent) {
+    MS_UI_PERF_CONSTRUCT(CurvePreview);
     createUi(parent);
+    MS_UI_PERF_OBJECTS(CurvePreview, surface_);
 }
 
 FLASHMEM CurvePreviewWidget::~CurvePreviewWidget() {
+    removeOcclusionListener(this);
     markerTimer_.reset();
+    qualityTimer_.reset();
     if (surface_ != nullptr) {
         lv_obj_delete(surface_);
         surface_ = nullptr;
@@ -274,6 +281,90 @@ FLASHMEM void CurvePreviewWidget::createUi(lv_obj_t* parent) {
         &CurvePreviewWidget::onMarkerTimer,
         this
     );
+    quality_.configure({
+        MS_UI_CURVE_PREVIEW_BUDGET_US,
+        MS_UI_CURVE_PREVIEW_RESTORE_MS,
+    });
+    qualityTimer_.emplace(
+        QUALITY_SERVICE_PERIOD_MS,
+        &CurvePreviewWidget::onQualityTimer,
+        this
+    );
+    qualityTimer_->pause();
+    addOcclusionListener(surface_, &CurvePreviewWidget::onOcclusion, this);
+}
+
+FLASHMEM void CurvePreviewWidget::setQualityBudget(
+    const CurvePreviewQualityBudget& budget
+) {
+    const uint8_t previous = quality_.densityShift();
+    quality_.configure(budget);
+    if (qualityTimer_ && quality_.densityShift() == 0U) {
+        qualityTimer_->pause();
+    }
+    if (previous != quality_.densityShift() && rendered_ && !occluded_ &&
+        !geometryDensityCurrent()) {
+        rebuildGeometry(
+            *renderedArea_,
+            *renderedProps_,
+            densityShiftFor(renderedProps_->geometryUpdate)
+        );
+        MS_UI_PERF_INVALIDATE(CurvePreview, surface_);
+    }
+}
+
+FLASHMEM void CurvePreviewWidget::rebuildGeometry(
+    const lv_area_t& area,
+    const CurvePreviewWidgetProps& props,
+    uint8_t densityShift
+) {
+    const uint32_t startUs = perfClockUs();
+    (void)geometry_.rebuild(
+        lv_area_get_width(&area),
+        lv_area_get_height(&area),
+        props.sampleProvider,
+        props.sampleContext,
+        densityShift
+    );
+    observeQuality(perfClockUs() - startUs);
+}
+
+FLASHMEM bool CurvePreviewWidget::geometryDensityCurrent() const {
+    return geometry_.sampleCount == curvePreviewSampleCountForWidth(
+        lv_area_get_width(&*renderedArea_),
+        densityShiftFor(renderedProps_->geometryUpdate)
+    );
+}
+
+// The draw that showed the previous geometry is charged to this update:
+// together they are what one update of the preview costs per frame.
+FLASHMEM void CurvePreviewWidget::observeQuality(uint32_t rebuildUs) {
+    quality_.observe(rebuildUs + drawUs_, lv_tick_get());
+    drawUs_ = 0U;
+    if (qualityTimer_ && quality_.densityShift() > 0U) {
+        qualityTimer_->resume();
+    }
+}
+
+FLASHMEM void CurvePreviewWidget::serviceQuality() {
+    if (quality_.densityShift() == 0U) {
+        if (qualityTimer_) qualityTimer_->pause();
+        return;
+    }
+    // Hidden or covered: nothing is sampled, so there is nothing to restore
+    // yet; the next visible rebuild measures again.
+    if (!visible_ || !rendered_ || occluded_ || !renderedProps_) return;
+    const uint32_t now = lv_tick_get();
+    if (!quality_.restoreDue(now)) return;
+    quality_.restore(now);
+    // Rolling traces already sample every column: only the level moves.
+    if (geometryDensityCurrent()) return;
+    rebuildGeometry(
+        *renderedArea_,
+        *renderedProps_,
+        densityShiftFor(renderedProps_->geometryUpdate)
+    );
+    MS_UI_PERF_INVALIDATE(CurvePreview, surface_);
 }
 
 FLASHMEM bool CurvePreviewWidget::staticStyleChanged(
@@ -319,15 +410,14 @@ FLASHMEM void CurvePreviewWidget::invalidateMarker(
         renderedProps_->markerRadius + 1
     );
     if (!rect.valid()) return;
-    oc::ui::lvgl::invalidateStaticSurfaceArea(
-        surface_,
-        {
-            .x1 = static_cast<lv_coord_t>(rect.x1),
-            .y1 = static_cast<lv_coord_t>(rect.y1),
-            .x2 = static_cast<lv_coord_t>(rect.x2),
-            .y2 = static_cast<lv_coord_t>(rect.y2),
-        }
-    );
+    const lv_area_t dirty{
+        .x1 = static_cast<lv_coord_t>(rect.x1),
+        .y1 = static_cast<lv_coord_t>(rect.y1),
+        .x2 = static_cast<lv_coord_t>(rect.x2),
+        .y2 = static_cast<lv_coord_t>(rect.y2),
+    };
+    MS_UI_PERF_AREA(CurvePreview, surface_, dirty);
+    oc::ui::lvgl::invalidateStaticSurfaceArea(surface_, dirty);
 }
 
 FLASHMEM bool CurvePreviewWidget::sameMarkerPixel(
@@ -373,15 +463,14 @@ void CurvePreviewWidget::invalidateTail() const {
         1,
         std::max(props.curveWidth, props.impactWidth)
     );
-    oc::ui::lvgl::invalidateStaticSurfaceArea(
-        surface_,
-        {
-            .x1 = static_cast<lv_coord_t>(firstX - margin),
-            .y1 = static_cast<lv_coord_t>(area.y1 - margin),
-            .x2 = static_cast<lv_coord_t>(area.x2 + margin),
-            .y2 = static_cast<lv_coord_t>(area.y2 + margin),
-        }
-    );
+    const lv_area_t dirty{
+        .x1 = static_cast<lv_coord_t>(firstX - margin),
+        .y1 = static_cast<lv_coord_t>(area.y1 - margin),
+        .x2 = static_cast<lv_coord_t>(area.x2 + margin),
+        .y2 = static_cast<lv_coord_t>(area.y2 + margin),
+    };
+    MS_UI_PERF_AREA(CurvePreview, surface_, dirty);
+    oc::ui::lvgl::invalidateStaticSurfaceArea(surface_, dirty);
 }
 
 FLASHMEM void CurvePreviewWidget::invalidateDamage(
@@ -416,15 +505,14 @@ FLASHMEM void CurvePreviewWidget::invalidateDamage(
                 margin
             );
             if (!rect.valid()) continue;
-            oc::ui::lvgl::invalidateStaticSurfaceArea(
-                surface_,
-                {
-                    .x1 = static_cast<lv_coord_t>(rect.x1),
-                    .y1 = static_cast<lv_coord_t>(rect.y1),
-                    .x2 = static_cast<lv_coord_t>(rect.x2),
-                    .y2 = static_cast<lv_coord_t>(rect.y2),
-                }
-            );
+            const lv_area_t dirty{
+                .x1 = static_cast<lv_coord_t>(rect.x1),
+                .y1 = static_cast<lv_coord_t>(rect.y1),
+                .x2 = static_cast<lv_coord_t>(rect.x2),
+                .y2 = static_cast<lv_coord_t>(rect.y2),
+            };
+            MS_UI_PERF_AREA(CurvePreview, surface_, dirty);
+            oc::ui::lvgl::invalidateStaticSurfaceArea(surface_, dirty);
         }
     }
 }
@@ -440,6 +528,13 @@ bool CurvePreviewWidget::updateRollingGeometry(
         return false;
     }
     if (renderedProps_->geometryRevision == geometryRevision) return true;
+    if (occluded_) {
+        // Covered: skip the column work; uncovering rebuilds once.
+        if (!pendingProps_) pendingProps_ = *renderedProps_;
+        pendingProps_->geometryRevision = geometryRevision;
+        pendingProps_->geometryUpdate = CurvePreviewGeometryUpdate::REBUILD;
+        return true;
+    }
     bool updated = false;
     {
         OC_PERF_SCOPE(perfGeometry, "ui.curve-preview.geometry-hot");
@@ -448,12 +543,23 @@ bool CurvePreviewWidget::updateRollingGeometry(
                 renderedProps_->sampleProvider,
                 renderedProps_->sampleContext
             );
+        } else if (update == CurvePreviewGeometryUpdate::ADVANCE &&
+                   geometry_.sampleCount != curvePreviewSampleCountForWidth(
+                       lv_area_get_width(&*renderedArea_))) {
+            // Built below full density (an authored update or a slow
+            // rebuild): rebuild once per pixel, then every later tick
+            // samples only its new columns.
+            rebuildGeometry(*renderedArea_, *renderedProps_, 0U);
+            updated = geometry_.sampleCount >= 2U;
         } else if (update == CurvePreviewGeometryUpdate::ADVANCE) {
+            const uint32_t startUs = perfClockUs();
             updated = geometry_.advance(
                 advanceCount,
                 renderedProps_->sampleProvider,
                 renderedProps_->sampleContext
             );
+            // Cheap ticks are what lets the governor step back up.
+            observeQuality(perfClockUs() - startUs);
         }
         OC_PERF_UNITS(
             perfGeometry,
@@ -470,13 +576,13 @@ bool CurvePreviewWidget::updateRollingGeometry(
     if (update == CurvePreviewGeometryUpdate::PATCH_LAST) {
         invalidateTail();
     } else {
-        lv_obj_invalidate(surface_);
+        MS_UI_PERF_INVALIDATE(CurvePreview, surface_);
     }
     return true;
 }
 
 FLASHMEM void CurvePreviewWidget::serviceMarker() {
-    if (!visible_ || !rendered_ || !renderedProps_ ||
+    if (!visible_ || !rendered_ || !renderedProps_ || occluded_ ||
         renderedProps_->markerProvider == nullptr) {
         if (markerTimer_) markerTimer_->pause();
         return;
@@ -595,7 +701,10 @@ FLASHMEM void CurvePreviewWidget::onDrawEvent(lv_event_t* event) {
         lv_event_get_user_data(event)
     );
     if (self == nullptr) return;
+    MS_UI_PERF_COUNT(CurvePreview, DrawCallbacks, 1U);
+    const uint32_t startUs = perfClockUs();
     self->draw(lv_event_get_layer(event));
+    self->drawUs_ = std::max(self->drawUs_, perfClockUs() - startUs);
 }
 
 FLASHMEM void CurvePreviewWidget::onSizeChangedEvent(lv_event_t* event) {
@@ -612,13 +721,56 @@ FLASHMEM void CurvePreviewWidget::onMarkerTimer(lv_timer_t* timer) {
     if (self != nullptr) self->serviceMarker();
 }
 
+FLASHMEM void CurvePreviewWidget::onQualityTimer(lv_timer_t* timer) {
+    auto* self = static_cast<CurvePreviewWidget*>(
+        lv_timer_get_user_data(timer)
+    );
+    if (self != nullptr) self->serviceQuality();
+}
+
+FLASHMEM void CurvePreviewWidget::onOcclusion(void* context, bool occluded) {
+    auto* self = static_cast<CurvePreviewWidget*>(context);
+    if (self != nullptr) self->setOccluded(occluded);
+}
+
+FLASHMEM void CurvePreviewWidget::setOccluded(bool occluded) {
+    if (occluded_ == occluded) return;
+    occluded_ = occluded;
+    if (occluded) {
+        if (markerTimer_) markerTimer_->pause();
+        if (qualityTimer_) qualityTimer_->pause();
+        return;
+    }
+    if (pendingProps_) {
+        // Bound the resync to one render of the latest state. Skipped
+        // rolling steps cannot be patched on: rebuild instead.
+        CurvePreviewWidgetProps props = *pendingProps_;
+        pendingProps_.reset();
+        if (rendered_ && renderedProps_ &&
+            props.geometryRevision != renderedProps_->geometryRevision) {
+            props.geometryUpdate = CurvePreviewGeometryUpdate::REBUILD;
+        }
+        render(props);
+    }
+    if (markerTimer_ && visible_ && rendered_ && renderedProps_ &&
+        renderedProps_->markerProvider != nullptr) {
+        markerTimer_->resume();
+    }
+    if (qualityTimer_ && quality_.densityShift() > 0U) {
+        qualityTimer_->resume();
+    }
+}
+
 FLASHMEM void CurvePreviewWidget::render(
     const CurvePreviewWidgetProps& props
 ) {
     if (surface_ == nullptr) return;
+    MS_UI_PERF_COUNT(CurvePreview, Renders, 1U);
     if (!props.visible) {
+        pendingProps_.reset();
         if (visible_) {
             if (markerTimer_) markerTimer_->pause();
+            if (qualityTimer_) qualityTimer_->pause();
             lv_obj_add_flag(surface_, LV_OBJ_FLAG_HIDDEN);
             visible_ = false;
             rendered_ = false;
@@ -626,6 +778,10 @@ FLASHMEM void CurvePreviewWidget::render(
         }
         return;
     }
+    if (occluded_ && visible_ && rendered_) {
+        pendingProps_ = props;
+        return;
+    }
     if (!visible_) {
         lv_obj_clear_flag(surface_, LV_OBJ_FLAG_HIDDEN);
         visible_ = true;
@@ -683,6 +839,9 @@ FLASHMEM void CurvePreviewWidget::render(
         const bool sameSampler = rendered_ && !areaChanged &&
             renderedProps_->sampleProvider == props.sampleProvider &&
             renderedProps_->sampleContext == props.sampleContext;
+        const uint8_t densityShift = quality_.densityShift();
+        const bool fullDensity = geometry_.sampleCount ==
+            curvePreviewSampleCountForWidth(lv_area_get_width(&area));
         bool updated = false;
         bool damageAttempted = false;
         if (sameSampler && props.geometryUpdate ==
@@ -692,40 +851,43 @@ FLASHMEM void CurvePreviewWidget::render(
                 props.sampleContext
             );
             tailPatched = updated;
-        } else if (sameSampler && props.geometryUpdate ==
+        } else if (sameSampler && fullDensity && props.geometryUpdate ==
                        CurvePreviewGeometryUpdate::ADVANCE) {
+            const uint32_t startUs = perfClockUs();
             updated = geometry_.advance(
                 props.geometryAdvance,
                 props.sampleProvider,
                 props.sampleContext
             );
+            observeQuality(perfClockUs() - startUs);
         } else if (
             sameSampler && !styleChanged &&
             props.geometryUpdate ==
                 CurvePreviewGeometryUpdate::REBUILD_DAMAGE &&
             geometry_.sampleCount ==
                 curvePreviewSampleCountForWidth(
-                    lv_area_get_width(&area)
+                    lv_area_get_width(&area),
+                    densityShift
                 )
         ) {
             damageAttempted = true;
+            const uint32_t startUs = perfClockUs();
             updated = geometry_.rebuildWithDamage(
                 lv_area_get_width(&area),
                 lv_area_get_height(&area),
                 props.sampleProvider,
                 props.sampleContext,
                 props.showImpactBand,
-                damage
+                damage,
+                densityShift
             );
+            observeQuality(perfClockUs() - startUs);
             damageRebuilt = updated;
         }
         if (!updated && !damageAttempted) {
-            (void)geometry_.rebuild(
-                lv_area_get_width(&area),
-                lv_area_get_height(&area),
-                props.sampleProvider,
-                props.sampleContext
-            );
+            // ADVANCE below full density lands here once and comes back
+            // at full density, so the following ticks take advance().
+            rebuildGeometry(area, props, densityShiftFor(props.geometryUpdate));
             tailPatched = false;
         }
         OC_PERF_UNITS(
@@ -753,7 +915,7 @@ FLASHMEM void CurvePreviewWidget::render(
     renderedProps_->marker = resolvedMarker;
     rendered_ = true;
     if (fullInvalidation) {
-        lv_obj_invalidate(surface_);
+        MS_UI_PERF_INVALIDATE(CurvePreview, surface_);
     } else {
         if (damageRebuilt) invalidateDamage(damage);
         if (tailPatched) invalidateTail();
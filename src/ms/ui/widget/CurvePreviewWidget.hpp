@@ -8,6 +8,16 @@
 
 #include <ms/ui/widget/CurvePreviewGeometry.hpp>
 
+// Rebuild + draw time one preview may spend before it samples at half or
+// quarter density; 0 always samples every pixel column.
+#ifndef MS_UI_CURVE_PREVIEW_BUDGET_US
+#define MS_UI_CURVE_PREVIEW_BUDGET_US 8000U
+#endif
+
+#ifndef MS_UI_CURVE_PREVIEW_RESTORE_MS
+#define MS_UI_CURVE_PREVIEW_RESTORE_MS 250U
+#endif
+
 namespace ms::ui {
 
 struct CurvePreviewMarker {
@@ -64,6 +74,16 @@ struct CurvePreviewWidgetProps {
  * The owner is responsible for allocating this object in the desired memory
  * region. MIDI Studio owners use makeExtmemUnique, so all fixed geometry stays
  * in PSRAM. render() never creates LVGL objects or allocates sample storage.
+ *
+ * While covered (Occlusion.hpp) the marker timer is paused and render() /
+ * updateRollingGeometry() only record the latest request, which is
+ * rendered once when the widget is uncovered.
+ *
+ * Full rebuilds and rolling advances are timed together with the slowest
+ * draw since the last one; over budget the governor (CurvePreviewGeometry.hpp)
+ * lowers sample density for the next rebuild and a slow timer steps it back
+ * up once there is headroom again. Rolling traces stay at full density so
+ * each advance samples only its new columns.
  */
 class CurvePreviewWidget {
 public:
@@ -89,15 +109,38 @@ public:
         return geometry_.sampleCount;
     }
 
+    /** Replaces the build-time budget; budgetUs 0 restores full density. */
+    void setQualityBudget(const CurvePreviewQualityBudget& budget);
+    /** 0 = every column, 1 = half, 2 = quarter density. */
+    [[nodiscard]] uint8_t densityShift() const {
+        return quality_.densityShift();
+    }
+
 private:
     static constexpr uint32_t MARKER_SERVICE_PERIOD_MS = 1U;
+    static constexpr uint32_t QUALITY_SERVICE_PERIOD_MS = 50U;
 
     void createUi(lv_obj_t* parent);
     void draw(lv_layer_t* layer);
     void invalidateDamage(const CurvePreviewDamage& damage) const;
     void invalidateTail() const;
     void invalidateMarker(const CurvePreviewMarker& marker) const;
+    void rebuildGeometry(
+        const lv_area_t& area,
+        const CurvePreviewWidgetProps& props,
+        uint8_t densityShift
+    );
+    [[nodiscard]] uint8_t densityShiftFor(
+        CurvePreviewGeometryUpdate update
+    ) const {
+        return curvePreviewDensityShiftFor(update, quality_.densityShift());
+    }
+    /** True when the rendered geometry already has the density its update wants. */
+    [[nodiscard]] bool geometryDensityCurrent() const;
+    void observeQuality(uint32_t rebuildUs);
     void serviceMarker();
+    void serviceQuality();
+    void setOccluded(bool occluded);
     [[nodiscard]] bool sameMarkerPixel(
         const CurvePreviewMarker& lhs,
         const CurvePreviewMarker& rhs
@@ -108,6 +151,8 @@ private:
     static void onDrawEvent(lv_event_t* event);
     static void onSizeChangedEvent(lv_event_t* event);
     static void onMarkerTimer(lv_timer_t* timer);
+    static void onQualityTimer(lv_timer_t* timer);
+    static void onOcclusion(void* context, bool occluded);
 
     lv_obj_t* surface_ = nullptr;
     CurvePreviewGeometry geometry_{};
@@ -119,8 +164,16 @@ private:
     std::optional<CurvePreviewWidgetProps> renderedProps_{};
     std::optional<lv_area_t> renderedArea_{};
     std::optional<oc::ui::lvgl::PausableTimer> markerTimer_{};
+    // Only runs while below full density, to step it back up.
+    std::optional<oc::ui::lvgl::PausableTimer> qualityTimer_{};
+    CurvePreviewQualityGovernor quality_{};
+    // Slowest draw callback since the last timed rebuild.
+    uint32_t drawUs_ = 0U;
+    // Latest state requested while covered; applied once when uncovered.
+    std::optional<CurvePreviewWidgetProps> pendingProps_{};
     bool rendered_ = false;
     bool visible_ = false;
+    bool occluded_ = false;
     bool layout_dirty_ = true;
 };
 
@@ -0,0 +1,94 @@
+#include "HighlightStyles.hpp"
+
+#include <config/PlatformCompat.hpp>
+#include <oc/ui/lvgl/theme/BaseTheme.hpp>
+
+namespace ms::ui {
+
+using namespace oc::ui::lvgl;
+
+namespace {
+
+struct HighlightStyleSet {
+    lv_style_t normal;
+    lv_style_t selected;
+    lv_style_t dimmed;
+};
+
+HighlightStyleSet g_label_styles;
+HighlightStyleSet g_value_styles;
+HighlightStyleSet g_icon_styles;
+bool g_styles_ready = false;
+
+FLASHMEM void initColorSet(HighlightStyleSet& set, HighlightRole role) {
+    lv_style_init(&set.normal);
+    lv_style_set_text_color(&set.normal, lv_color_hex(highlightTextColor(role, false, false)));
+    lv_style_init(&set.selected);
+    lv_style_set_text_color(&set.selected, lv_color_hex(highlightTextColor(role, true, false)));
+    lv_style_init(&set.dimmed);
+    lv_style_set_text_color(&set.dimmed, lv_color_hex(highlightTextColor(role, false, true)));
+}
+
+FLASHMEM void initStyles() {
+    if (g_styles_ready) return;
+    initColorSet(g_label_styles, HighlightRole::Label);
+    initColorSet(g_value_styles, HighlightRole::Value);
+    lv_style_init(&g_icon_styles.normal);
+    lv_style_set_text_opa(&g_icon_styles.normal, highlightTextOpa(HighlightRole::Icon, false, false));
+    lv_style_init(&g_icon_styles.selected);
+    lv_style_set_text_opa(&g_icon_styles.selected, highlightTextOpa(HighlightRole::Icon, true, false));
+    lv_style_init(&g_icon_styles.dimmed);
+    lv_style_set_text_opa(&g_icon_styles.dimmed, highlightTextOpa(HighlightRole::Icon, false, true));
+    g_styles_ready = true;
+}
+
+}  // namespace
+
+FLASHMEM void addHighlightStyles(lv_obj_t* obj, HighlightRole role) {
+    if (!obj) return;
+    initStyles();
+    const HighlightStyleSet& set = role == HighlightRole::Label ? g_label_styles
+        : role == HighlightRole::Value                          ? g_value_styles
+                                                                : g_icon_styles;
+    lv_obj_add_style(obj, &set.normal, LV_STATE_DEFAULT);
+    lv_obj_add_style(obj, &set.dimmed, HIGHLIGHT_DIMMED_STATE);
+    // LVGL prefers the higher state bit (USER_1 over CHECKED), so selected
+    // is also registered for selected+dimmed to keep it winning.
+    lv_obj_add_style(obj, &set.selected, HIGHLIGHT_SELECTED_STATE);
+    lv_obj_add_style(obj, &set.selected, HIGHLIGHT_SELECTED_STATE | HIGHLIGHT_DIMMED_STATE);
+}
+
+FLASHMEM void setHighlightState(lv_obj_t* obj, bool selected, bool dimmed) {
+    if (!obj) return;
+    const lv_state_t current = lv_obj_get_state(obj);
+    const lv_state_t mask = HIGHLIGHT_SELECTED_STATE | HIGHLIGHT_DIMMED_STATE;
+    const lv_state_t wanted = static_cast<lv_state_t>(
+        (selected ? HIGHLIGHT_SELECTED_STATE : 0) | (dimmed ? HIGHLIGHT_DIMMED_STATE : 0));
+    if ((current & mask) == wanted) return;
+    if (wanted & ~current) lv_obj_add_state(obj, static_cast<lv_state_t>(wanted & ~current));
+    if (current & mask & ~wanted) lv_obj_remove_state(obj, static_cast<lv_state_t>(current & mask & ~wanted));
+}
+
+FLASHMEM uint32_t highlightTextColor(HighlightRole role, bool selected, bool dimmed) {
+    switch (role) {
+        case HighlightRole::Label:
+            return selected ? base_theme::color::TEXT_PRIMARY
+                : dimmed    ? base_theme::color::INACTIVE
+                            : base_theme::color::TEXT_SECONDARY;
+        case HighlightRole::Value:
+            return selected ? base_theme::color::ACTIVE
+                : dimmed    ? base_theme::color::INACTIVE
+                            : base_theme::color::INACTIVE_LIGHTER;
+        case HighlightRole::Icon:
+            break;
+    }
+    return 0U;
+}
+
+FLASHMEM lv_opa_t highlightTextOpa(HighlightRole role, bool selected, bool dimmed) {
+    (void)dimmed;
+    if (role != HighlightRole::Icon) return LV_OPA_COVER;
+    return selected ? LV_OPA_COVER : LV_OPA_70;
+}
+
+}  // namespace ms::ui
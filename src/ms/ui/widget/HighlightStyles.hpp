@@ -0,0 +1,50 @@
+#pragma once
+
+/**
+ * @file HighlightStyles.hpp
+ * @brief Shared selected/unselected/dimmed styles for list row labels
+ */
+
+#include <cstdint>
+
+#include <lvgl.h>
+
+namespace ms::ui {
+
+/**
+ * Which highlight palette a row label follows.
+ *
+ * - Label: primary text (key, item name).
+ * - Value: accent text (value, index).
+ * - Icon: opacity only; the icon keeps its own color.
+ */
+enum class HighlightRole : uint8_t {
+    Label = 0,
+    Value,
+    Icon,
+};
+
+/** Object states the shared styles are selected by. */
+constexpr lv_state_t HIGHLIGHT_SELECTED_STATE = LV_STATE_CHECKED;
+constexpr lv_state_t HIGHLIGHT_DIMMED_STATE = LV_STATE_USER_1;
+
+/**
+ * Attach the role's shared lv_style_t set once, when the row is built.
+ *
+ * The styles are static and shared by every list overlay, so a label
+ * carries style pointers instead of local style storage, and a highlight
+ * move is a state flip (setHighlightState) rather than a restyle.
+ */
+void addHighlightStyles(lv_obj_t* obj, HighlightRole role);
+
+/** Selected wins over dimmed; a no-op when the state is unchanged. */
+void setHighlightState(lv_obj_t* obj, bool selected, bool dimmed);
+
+/**
+ * The palette behind the shared styles, for rows that draw their own text.
+ * Icon has no text color of its own (returns 0; use the icon's color).
+ */
+uint32_t highlightTextColor(HighlightRole role, bool selected, bool dimmed);
+lv_opa_t highlightTextOpa(HighlightRole role, bool selected, bool dimmed);
+
+}  // namespace ms::ui
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ms::ui {
+
+/**
+ * LVGL-free key lookup for incremental list item updates: keys let the
+ * selection and per-item state follow an item that moved when the item set
+ * is replaced (see ListItemStore).
+ */
+
+/**
+ * Index of `key` in keys[0, count), or -1. Linear: reconciliation already
+ * walks every item once, and lists are far below the size where an index
+ * pays for itself.
+ */
+[[nodiscard]] inline int findItemKey(const uint32_t* keys, std::size_t count, uint32_t key) {
+    if (!keys) return -1;
+    for (std::size_t i = 0; i < count; ++i) {
+        if (keys[i] == key) return static_cast<int>(i);
+    }
+    return -1;
+}
+
+}  // namespace ms::ui
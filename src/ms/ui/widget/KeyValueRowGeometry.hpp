@@ -0,0 +1,155 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace ms::ui {
+
+/** Columns of a key/value row, left to right. */
+enum class KeyValueRowColumn : uint8_t {
+    Icon = 0,
+    Key,
+    Detail,
+    Value,
+    Sparkline,
+};
+
+inline constexpr std::size_t KEY_VALUE_ROW_COLUMN_COUNT = 5U;
+
+/** One bit per KeyValueRowColumn, for per-column damage masks. */
+using KeyValueRowColumnMask = uint8_t;
+
+[[nodiscard]] constexpr KeyValueRowColumnMask keyValueRowColumnBit(KeyValueRowColumn column) {
+    return static_cast<KeyValueRowColumnMask>(1U << static_cast<uint8_t>(column));
+}
+
+inline constexpr KeyValueRowColumnMask KEY_VALUE_ROW_ALL_COLUMNS =
+    static_cast<KeyValueRowColumnMask>((1U << KEY_VALUE_ROW_COLUMN_COUNT) - 1U);
+
+/** Gutters and fixed column widths of one row style (default or compact facts). */
+struct KeyValueRowMetrics {
+    int16_t padH = 0;
+    int16_t gap = 0;
+    int16_t iconWidth = 0;
+    int16_t detailWidth = 0;
+    // Shared by the value text and the sparkline that replaces it.
+    int16_t valueWidth = 0;
+};
+
+/** Horizontal extent relative to the row's left edge; width 0 = hidden. */
+struct KeyValueRowSpan {
+    int16_t x = 0;
+    int16_t width = 0;
+
+    [[nodiscard]] constexpr bool visible() const { return width > 0; }
+    [[nodiscard]] constexpr bool operator==(const KeyValueRowSpan& other) const {
+        return x == other.x && width == other.width;
+    }
+    [[nodiscard]] constexpr bool operator!=(const KeyValueRowSpan& other) const {
+        return !(*this == other);
+    }
+};
+
+struct KeyValueRowColumns {
+    std::array<KeyValueRowSpan, KEY_VALUE_ROW_COLUMN_COUNT> spans{};
+
+    [[nodiscard]] constexpr const KeyValueRowSpan& operator[](KeyValueRowColumn column) const {
+        return spans[static_cast<std::size_t>(column)];
+    }
+};
+
+/**
+ * Column spans matching the flex row the widget implementation builds:
+ * fixed icon, growing key, optional fixed detail, then either the value
+ * text or the sparkline in the same fixed slot, with one gap between
+ * consecutive visible columns. A row too narrow for the fixed columns
+ * gives the key zero width rather than overlapping them.
+ */
+[[nodiscard]] constexpr KeyValueRowColumns keyValueRowColumns(const KeyValueRowMetrics& metrics,
+                                                              int rowWidth,
+                                                              bool hasDetail,
+                                                              bool hasSparkline) {
+    KeyValueRowColumns columns{};
+    const int detailWidth = hasDetail ? metrics.detailWidth : 0;
+    const int fixed = metrics.iconWidth + metrics.valueWidth + detailWidth +
+        metrics.gap * (hasDetail ? 3 : 2);
+    const int available = rowWidth - 2 * metrics.padH - fixed;
+    const int keyWidth = available > 0 ? available : 0;
+
+    int x = metrics.padH;
+    auto place = [&](KeyValueRowColumn column, int width) {
+        columns.spans[static_cast<std::size_t>(column)] =
+            KeyValueRowSpan{static_cast<int16_t>(x), static_cast<int16_t>(width)};
+        x += width + metrics.gap;
+    };
+    place(KeyValueRowColumn::Icon, metrics.iconWidth);
+    place(KeyValueRowColumn::Key, keyWidth);
+    if (hasDetail) place(KeyValueRowColumn::Detail, detailWidth);
+    place(hasSparkline ? KeyValueRowColumn::Sparkline : KeyValueRowColumn::Value,
+          metrics.valueWidth);
+    return columns;
+}
+
+/**
+ * The four column variants (detail x sparkline) of one row style, computed
+ * once per style and row width so binding a row never lays anything out.
+ */
+class KeyValueRowLayout {
+public:
+    /** Returns true when the spans changed. */
+    bool configure(const KeyValueRowMetrics& metrics, int rowWidth) {
+        if (configured_ && rowWidth == width_ && sameMetrics(metrics)) return false;
+        metrics_ = metrics;
+        width_ = rowWidth;
+        for (std::size_t variant = 0; variant < variants_.size(); ++variant) {
+            variants_[variant] = keyValueRowColumns(metrics, rowWidth, (variant & 1U) != 0U,
+                                                    (variant & 2U) != 0U);
+        }
+        configured_ = true;
+        return true;
+    }
+
+    void reset() { configured_ = false; }
+
+    [[nodiscard]] bool configured() const { return configured_; }
+    [[nodiscard]] int width() const { return width_; }
+
+    [[nodiscard]] const KeyValueRowColumns& columns(bool hasDetail, bool hasSparkline) const {
+        return variants_[(hasDetail ? 1U : 0U) | (hasSparkline ? 2U : 0U)];
+    }
+
+private:
+    bool sameMetrics(const KeyValueRowMetrics& other) const {
+        return metrics_.padH == other.padH && metrics_.gap == other.gap &&
+            metrics_.iconWidth == other.iconWidth && metrics_.detailWidth == other.detailWidth &&
+            metrics_.valueWidth == other.valueWidth;
+    }
+
+    std::array<KeyValueRowColumns, 4> variants_{};
+    KeyValueRowMetrics metrics_{};
+    int width_ = 0;
+    bool configured_ = false;
+};
+
+/**
+ * Columns to redraw after a rebind: those whose content changed plus any
+ * whose span moved or appeared/disappeared. The caller invalidates both
+ * the old and the new span of each.
+ */
+[[nodiscard]] constexpr KeyValueRowColumnMask keyValueRowDamage(const KeyValueRowColumns& before,
+                                                                const KeyValueRowColumns& after,
+                                                                KeyValueRowColumnMask contentChanged) {
+    KeyValueRowColumnMask damage = 0U;
+    for (std::size_t column = 0; column < KEY_VALUE_ROW_COLUMN_COUNT; ++column) {
+        const auto bit = static_cast<KeyValueRowColumnMask>(1U << column);
+        const bool visible = before.spans[column].visible() || after.spans[column].visible();
+        if (!visible) continue;
+        if ((contentChanged & bit) != 0U || before.spans[column] != after.spans[column]) {
+            damage = static_cast<KeyValueRowColumnMask>(damage | bit);
+        }
+    }
+    return damage;
+}
+
+}  // namespace ms::ui
@@ -0,0 +1,325 @@
+#include "LabelBitmapMode.hpp"
+
+#include <array>
+#include <cstring>
+
+#include <config/PlatformCompat.hpp>
+#include <oc/diagnostics/Performance.hpp>
+
+#include <ms/ui/PerfCounters.hpp>
+#include <ms/ui/text/TextArena.hpp>
+
+namespace ms::ui {
+
+#if MS_UI_LABEL_BITMAP_CACHE_BYTES > 0
+
+namespace {
+
+using SharedLabelBitmapCache =
+    LabelBitmapCache<MS_UI_LABEL_BITMAP_CACHE_BYTES, MS_UI_LABEL_BITMAP_CACHE_ENTRIES>;
+
+#ifdef EXTMEM
+EXTMEM
+#endif
+SharedLabelBitmapCache g_bitmaps;
+
+// One image descriptor per cache entry. Its address is what LVGL's image
+// cache keys on, so it is dropped there whenever the entry's pixels move or
+// change (serial mismatch) before being handed out again.
+struct SlotImage {
+    lv_image_dsc_t image;
+    uint32_t serial;
+};
+
+std::array<SlotImage, SharedLabelBitmapCache::entries()> g_images{};
+
+// Display whose REFR_READY unpins the bitmaps blitted during its frame.
+lv_display_t* g_pin_display = nullptr;
+
+// Scratch buffer glyph bitmaps are expanded into; grows to the largest glyph.
+lv_draw_buf_t* g_glyph_buf = nullptr;
+
+struct TextRun {
+    const char* text;
+    const lv_font_t* font;
+    int32_t letterSpace;
+};
+
+bool isA8Glyph(const lv_font_glyph_dsc_t& glyph) {
+    return glyph.format >= LV_FONT_GLYPH_FORMAT_A1 && glyph.format <= LV_FONT_GLYPH_FORMAT_A8;
+}
+
+/** Single-line advance width, or -1 when a glyph cannot be pre-rendered. */
+int32_t measure(const TextRun& run) {
+    int32_t width = 0;
+    uint32_t i = 0;
+    uint32_t letter = lv_text_encoded_next(run.text, &i);
+    while (letter != 0) {
+        if (letter == '\n' || letter == '\r') return -1;
+        const uint32_t next = lv_text_encoded_next(run.text, &i);
+        lv_font_glyph_dsc_t glyph{};
+        if (lv_font_get_glyph_dsc(run.font, &glyph, letter, next)) {
+            if (!isA8Glyph(glyph) && glyph.box_w > 0) return -1;
+            width += glyph.adv_w + run.letterSpace;
+        }
+        letter = next;
+    }
+    return width > 0 ? width - run.letterSpace : 0;
+}
+
+bool ensureGlyphBuffer(uint32_t width, uint32_t height) {
+    if (g_glyph_buf && g_glyph_buf->header.w >= width && g_glyph_buf->header.h >= height) return true;
+    uint32_t w = width;
+    uint32_t h = height;
+    if (g_glyph_buf) {
+        if (g_glyph_buf->header.w > w) w = g_glyph_buf->header.w;
+        if (g_glyph_buf->header.h > h) h = g_glyph_buf->header.h;
+        lv_draw_buf_destroy(g_glyph_buf);
+    }
+    g_glyph_buf = lv_draw_buf_create(w, h, LV_COLOR_FORMAT_A8, LV_STRIDE_AUTO);
+    return g_glyph_buf != nullptr;
+}
+
+/** Blend every glyph of run into an A8 target, clipped to its width. */
+FLASHMEM bool rasterize(const TextRun& run, uint8_t* target, uint16_t width, uint16_t height) {
+    OC_PERF_SCOPE(perfRasterize, "ui.label.rasterize");
+    std::memset(target, 0, static_cast<std::size_t>(width) * height);
+    const int32_t ascender = lv_font_get_line_height(run.font) - run.font->base_line;
+
+    int32_t pen = 0;
+    uint32_t i = 0;
+    uint32_t letter = lv_text_encoded_next(run.text, &i);
+    while (letter != 0 && pen < width) {
+        const uint32_t next = lv_text_encoded_next(run.text, &i);
+        lv_font_glyph_dsc_t glyph{};
+        if (lv_font_get_glyph_dsc(run.font, &glyph, letter, next) && glyph.box_w > 0 && glyph.box_h > 0) {
+            if (!ensureGlyphBuffer(glyph.box_w, glyph.box_h)) return false;
+            if (lv_font_get_glyph_bitmap(&glyph, g_glyph_buf)) {
+                const uint32_t stride = g_glyph_buf->header.stride;
+                const int32_t left = pen + glyph.ofs_x;
+                const int32_t top = ascender - glyph.box_h - glyph.ofs_y;
+                for (int32_t y = 0; y < glyph.box_h; ++y) {
+                    const int32_t row = top + y;
+                    if (row < 0 || row >= height) continue;
+                    const uint8_t* source = g_glyph_buf->data + y * stride;
+                    uint8_t* out = target + row * width;
+                    for (int32_t x = 0; x < glyph.box_w; ++x) {
+                        const int32_t column = left + x;
+                        if (column < 0 || column >= width) continue;
+                        // Neighbouring glyph boxes may overlap: keep the stronger coverage.
+                        if (source[x] > out[column]) out[column] = source[x];
+                    }
+                }
+            }
+            lv_font_glyph_release_draw_data(&glyph);
+        }
+        if (glyph.adv_w > 0) pen += glyph.adv_w + run.letterSpace;
+        letter = next;
+    }
+    return true;
+}
+
+// Key long mode of whole-line bitmaps drawn scrolled (never an lv_label mode).
+constexpr uint8_t SCROLLED_LONG_MODE = 0xFFU;
+
+/**
+ * Cached (or freshly rendered) bitmap for the label's current state. With
+ * contentWidth 0 the whole line is rendered, however wide (marquee).
+ */
+bool bitmapFor(lv_obj_t* label, const lv_draw_label_dsc_t& dsc, int32_t contentWidth, LabelBitmap& out) {
+    const char* text = lv_label_get_text(label);
+    const bool wholeLine = contentWidth == 0;
+    if (!text || text[0] == '\0' || !dsc.font || contentWidth < 0) return false;
+    if (dsc.flag & LV_TEXT_FLAG_RECOLOR) return false;
+
+    const lv_label_long_mode_t mode = lv_label_get_long_mode(label);
+    const bool clipped = mode == LV_LABEL_LONG_DOT || mode == LV_LABEL_LONG_CLIP;
+    if (!clipped && mode != LV_LABEL_LONG_WRAP) return false;
+    // DOT rewrites the label text; only CLIP keeps the whole line.
+    if (wholeLine && mode != LV_LABEL_LONG_CLIP) return false;
+
+    const auto length = static_cast<uint32_t>(std::strlen(text));
+    LabelBitmapKey key{};
+    key.textHash = textHash(text, length);
+    key.textLength = length;
+    key.font = dsc.font;
+    key.width = static_cast<int16_t>(contentWidth);
+    key.letterSpace = static_cast<int16_t>(dsc.letter_space);
+    key.longMode = wholeLine ? SCROLLED_LONG_MODE : static_cast<uint8_t>(mode);
+    if (g_bitmaps.find(key, out)) return true;
+
+    const TextRun run{text, dsc.font, dsc.letter_space};
+    int32_t width = measure(run);
+    if (width <= 0) return false;
+    if (!wholeLine && width > contentWidth) {
+        // Wrap mode would break the line; DOT text is already shortened by
+        // lv_label, CLIP just cuts at the content edge.
+        if (!clipped) return false;
+        width = contentWidth;
+    }
+    const int32_t height = lv_font_get_line_height(dsc.font);
+    if (width > 0xFFFF || height <= 0 || height > 0xFFFF) return false;
+
+    uint8_t* pixels = g_bitmaps.insert(key, static_cast<uint16_t>(width), static_cast<uint16_t>(height), out);
+    if (!pixels) return false;
+    if (!rasterize(run, pixels, out.width, out.height)) {
+        g_bitmaps.erase(key);
+        return false;
+    }
+    return true;
+}
+
+const lv_image_dsc_t* imageFor(const LabelBitmap& bitmap) {
+    SlotImage& slot = g_images[bitmap.index];
+    if (slot.serial != bitmap.serial || slot.image.data != bitmap.data) {
+        if (slot.image.data) lv_image_cache_drop(&slot.image);
+        slot.image = lv_image_dsc_t{};
+        slot.image.header.magic = LV_IMAGE_HEADER_MAGIC;
+        slot.image.header.cf = LV_COLOR_FORMAT_A8;
+        slot.image.header.w = bitmap.width;
+        slot.image.header.h = bitmap.height;
+        slot.image.header.stride = bitmap.width;
+        slot.image.data_size = static_cast<uint32_t>(bitmap.width) * bitmap.height;
+        slot.image.data = bitmap.data;
+        slot.serial = bitmap.serial;
+    }
+    return &slot.image;
+}
+
+void onRefreshReady(lv_event_t*) {
+    g_bitmaps.unpinAll();
+}
+
+/**
+ * lv_draw_image() only queues a task that reads the pixels (and the slot
+ * descriptor) later, on another thread with an OS, after later labels of
+ * the same frame could evict or compact them. Pin until the frame is done.
+ */
+void pinForFrame(lv_obj_t* label, const LabelBitmap& bitmap) {
+    lv_display_t* display = lv_obj_get_display(label);
+    if (display && display != g_pin_display) {
+        lv_display_remove_event_cb_with_user_data(display, onRefreshReady, nullptr);
+        lv_display_add_event_cb(display, onRefreshReady, LV_EVENT_REFR_READY, nullptr);
+        g_pin_display = display;
+    }
+    g_bitmaps.pin(bitmap);
+}
+
+/** Draw bitmap with its left edge at x, clipped to the label's content box. */
+void blit(lv_obj_t* label,
+          lv_layer_t* layer,
+          const lv_draw_label_dsc_t& dsc,
+          const LabelBitmap& bitmap,
+          const lv_area_t& content,
+          int32_t x) {
+    if (dsc.opa <= LV_OPA_MIN) return;
+    lv_area_t area = content;
+    area.x1 = x;
+    area.x2 = area.x1 + bitmap.width - 1;
+    area.y2 = area.y1 + bitmap.height - 1;
+
+    lv_area_t clip;
+    if (!lv_area_intersect(&clip, &content, &layer->_clip_area)) return;
+    const lv_area_t savedClip = layer->_clip_area;
+    layer->_clip_area = clip;
+
+    lv_draw_image_dsc_t image;
+    lv_draw_image_dsc_init(&image);
+    image.src = imageFor(bitmap);
+    image.recolor = dsc.color;  // A8 sources draw in their recolor
+    image.recolor_opa = LV_OPA_COVER;
+    image.opa = dsc.opa;
+    lv_draw_image(layer, &image, &area);
+    pinForFrame(label, bitmap);
+
+    layer->_clip_area = savedClip;
+}
+
+// Runs before lv_label's own DRAW_MAIN handler (LV_EVENT_PREPROCESS); a
+// cache hit draws the bitmap and stops the glyph-by-glyph path. The bitmap
+// stays pinned until the image task has run.
+void onDrawMain(lv_event_t* e) {
+    lv_obj_t* label = lv_event_get_current_target_obj(e);
+    lv_layer_t* layer = lv_event_get_layer(e);
+    if (!label || !layer) return;
+    MS_UI_PERF_COUNT(LabelBitmap, DrawCallbacks, 1U);
+
+    lv_draw_label_dsc_t dsc;
+    lv_draw_label_dsc_init(&dsc);
+    lv_obj_init_draw_label_dsc(label, LV_PART_MAIN, &dsc);
+
+    lv_area_t content;
+    lv_obj_get_content_coords(label, &content);
+    const int32_t contentWidth = lv_area_get_width(&content);
+    LabelBitmap bitmap{};
+    if (contentWidth <= 0 || !bitmapFor(label, dsc, contentWidth, bitmap)) return;
+    lv_event_stop_processing(e);
+
+    int32_t x = content.x1;
+    const int32_t spare = contentWidth - bitmap.width;
+    if (dsc.align == LV_TEXT_ALIGN_CENTER) {
+        x += spare / 2;
+    } else if (dsc.align == LV_TEXT_ALIGN_RIGHT) {
+        x += spare;
+    }
+    blit(label, layer, dsc, bitmap, content, x);
+}
+
+}  // namespace
+
+FLASHMEM void enableLabelBitmapMode(lv_obj_t* label) {
+    if (!label) return;
+    lv_obj_remove_event_cb(label, onDrawMain);
+    lv_obj_add_event_cb(label, onDrawMain,
+                        static_cast<lv_event_code_t>(LV_EVENT_DRAW_MAIN | LV_EVENT_PREPROCESS), nullptr);
+    MS_UI_PERF_INVALIDATE(LabelBitmap, label);
+}
+
+FLASHMEM void disableLabelBitmapMode(lv_obj_t* label) {
+    if (!label) return;
+    if (lv_obj_remove_event_cb(label, onDrawMain)) MS_UI_PERF_INVALIDATE(LabelBitmap, label);
+}
+
+FLASHMEM void dropLabelBitmaps(const lv_font_t* font) {
+    if (font) {
+        g_bitmaps.eraseFont(font);
+    } else {
+        g_bitmaps.clear();
+    }
+}
+
+FLASHMEM LabelBitmapCacheStats labelBitmapCacheStats() {
+    return g_bitmaps.stats();
+}
+
+bool drawLabelBitmapScrolled(lv_obj_t* label, lv_layer_t* layer, int32_t offset) {
+    if (!label || !layer) return false;
+    lv_draw_label_dsc_t dsc;
+    lv_draw_label_dsc_init(&dsc);
+    lv_obj_init_draw_label_dsc(label, LV_PART_MAIN, &dsc);
+
+    lv_area_t content;
+    lv_obj_get_content_coords(label, &content);
+    LabelBitmap bitmap{};
+    if (!bitmapFor(label, dsc, 0, bitmap)) return false;
+    blit(label, layer, dsc, bitmap, content, content.x1 - offset);
+    return true;
+}
+
+#else
+
+FLASHMEM void enableLabelBitmapMode(lv_obj_t*) {}
+FLASHMEM void disableLabelBitmapMode(lv_obj_t*) {}
+FLASHMEM void dropLabelBitmaps(const lv_font_t*) {}
+
+FLASHMEM LabelBitmapCacheStats labelBitmapCacheStats() {
+    return LabelBitmapCacheStats{};
+}
+
+bool drawLabelBitmapScrolled(lv_obj_t*, lv_layer_t*, int32_t) {
+    return false;
+}
+
+#endif  // MS_UI_LABEL_BITMAP_CACHE_BYTES > 0
+
+}  // namespace ms::ui
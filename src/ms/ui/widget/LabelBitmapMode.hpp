@@ -0,0 +1,56 @@
+#pragma once
+
+/**
+ * @file LabelBitmapMode.hpp
+ * @brief Opt-in pre-rendered drawing for rarely-changing labels and icons
+ */
+
+#include <lvgl.h>
+
+#include <ms/ui/font/LabelBitmapCache.hpp>
+
+// Shared pool for pre-rendered label bitmaps (PSRAM on Teensy builds).
+// 0 disables the mode: enableLabelBitmapMode() becomes a no-op.
+#ifndef MS_UI_LABEL_BITMAP_CACHE_BYTES
+#define MS_UI_LABEL_BITMAP_CACHE_BYTES (24U * 1024U)
+#endif
+
+#ifndef MS_UI_LABEL_BITMAP_CACHE_ENTRIES
+#define MS_UI_LABEL_BITMAP_CACHE_ENTRIES 48
+#endif
+
+namespace ms::ui {
+
+/**
+ * Draw an lv_label from a cached A8 bitmap instead of glyph by glyph.
+ *
+ * Meant for titles, header meta and icon glyphs that are redrawn far more
+ * often than they change (e.g. under a moving selection highlight). The
+ * bitmap is keyed by (text, font, content width, long mode, letter
+ * spacing); color and opacity are applied at blit time. Labels that need
+ * the regular path - multi-line, wrapping, scrolling modes, image glyphs
+ * or bitmaps larger than the pool - fall back to LVGL's own drawing.
+ * Blitted bitmaps stay pinned until the display's LV_EVENT_REFR_READY, so
+ * deferred draw tasks never read evicted or compacted pixels.
+ */
+void enableLabelBitmapMode(lv_obj_t* label);
+void disableLabelBitmapMode(lv_obj_t* label);
+
+/**
+ * Drop cached bitmaps of one font (before unloading it), or all with
+ * nullptr. Not from inside a draw callback: pending draw tasks may still
+ * read the pixels.
+ */
+void dropLabelBitmaps(const lv_font_t* font = nullptr);
+
+LabelBitmapCacheStats labelBitmapCacheStats();
+
+/**
+ * Draw a LONG_CLIP label's whole line from the cache, shifted left by
+ * offset px and clipped to its content box (marquee). Call from the
+ * label's DRAW_MAIN; returns false when the text cannot be pre-rendered
+ * and nothing was drawn.
+ */
+bool drawLabelBitmapScrolled(lv_obj_t* label, lv_layer_t* layer, int32_t offset);
+
+}  // namespace ms::ui
@@ -0,0 +1,188 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <ms/ui/widget/ItemReconcile.hpp>
+
+namespace ms::ui {
+
+/**
+ * Item model behind a list widget: text, key and per-item style for every
+ * item, with no bound on count or text length.
+ *
+ * Storage is rebuilt only on a real change. Unchanged text is compared, not
+ * copied, and containers keep their capacity, so an update that matches
+ * the previous one (or stays within the sizes seen before) never touches
+ * the heap. Style is whatever per-item state the owner re-applies on bind.
+ *
+ * Keyed updates move each item (text and style) to its key's new index, so
+ * an insert copies one string rather than rewriting every item after it.
+ * Unkeyed updates diff by index.
+ */
+template <typename Style>
+class ListItemStore {
+public:
+    using TextAt = const char* (*)(const void* source, std::size_t index);
+
+    struct Update {
+        std::size_t rewritten = 0U;  // items present before whose text changed
+        std::size_t copied = 0U;     // texts written: rewritten plus new items
+        int selected = -1;           // where the selection went, -1 if it left
+    };
+
+    /**
+     * Replace the items with textAt(source, 0..count). `changed(index)` runs
+     * for every index whose content differs from before: another key moved
+     * in, a new item arrived, or the text changed. With keys on both sides
+     * items and the selection follow their key; otherwise they stay on
+     * their index, clamped to the new count.
+     */
+    template <typename OnChanged>
+    Update reconcile(
+        const void* source,
+        TextAt textAt,
+        std::size_t count,
+        const uint32_t* keys,
+        int selected,
+        OnChanged&& changed
+    ) {
+        const std::size_t oldCount = size_;
+        const std::size_t oldTexts = has_text_ ? oldCount : 0U;
+        const bool followKeys = keyed_ && keys != nullptr;
+
+        Update update{};
+        update.selected = followSelection(selected, count, keys, followKeys);
+        origin_.assign(count, ARRIVED);
+        if (followKeys) {
+            moveItemsByKey(oldCount, count, keys);
+        } else {
+            // External items may hold styles for only the indices styled.
+            const std::size_t kept = items_.size() < count ? items_.size() : count;
+            for (std::size_t i = 0; i < kept; ++i) origin_[i] = SAME;
+            items_.resize(count);
+        }
+
+        for (std::size_t i = 0; i < count; ++i) {
+            const char* text = textAt(source, i);
+            const bool known = i < oldTexts && origin_[i] != ARRIVED;
+            const bool wrote = assignText(items_[i].text, text ? text : "");
+            if (wrote) {
+                ++update.copied;
+                if (known) ++update.rewritten;
+            }
+            if (wrote || !known || origin_[i] == MOVED) changed(i);
+        }
+        for (std::size_t i = 0; i < count; ++i) items_[i].key = keys ? keys[i] : 0U;
+
+        size_ = count;
+        keyed_ = keys != nullptr;
+        has_text_ = true;
+        return update;
+    }
+
+    /**
+     * Track `count` items whose text lives elsewhere (a static span): text
+     * and keys are dropped and every style resets. Style slots are created
+     * only for the indices that get styled.
+     */
+    void resetExternal(std::size_t count) {
+        items_.clear();
+        size_ = count;
+        keyed_ = false;
+        has_text_ = false;
+    }
+
+    [[nodiscard]] std::size_t size() const { return size_; }
+
+    /** Stored text, or "" past the end and for external items. */
+    [[nodiscard]] const char* text(std::size_t index) const {
+        return has_text_ && index < items_.size() ? items_[index].text.c_str() : "";
+    }
+
+    /** Style slot for an index, created on first use; nullptr past the end. */
+    [[nodiscard]] Style* style(std::size_t index) {
+        if (index >= size_) return nullptr;
+        if (index >= items_.size()) items_.resize(index + 1U);
+        return &items_[index].style;
+    }
+    /** Style of an index, or nullptr if it was never styled or is past the end. */
+    [[nodiscard]] const Style* style(std::size_t index) const {
+        return index < size_ && index < items_.size() ? &items_[index].style : nullptr;
+    }
+
+private:
+    struct Item {
+        std::string text;
+        uint32_t key = 0U;
+        Style style{};
+    };
+
+    static bool assignText(std::string& stored, const char* text) {
+        if (stored == text) return false;
+        stored.assign(text);
+        return true;
+    }
+
+    int followSelection(int selected, std::size_t count, const uint32_t* keys, bool followKeys) const {
+        if (count == 0U || selected < 0) return -1;
+        if (followKeys && static_cast<std::size_t>(selected) < size_) {
+            return findItemKey(keys, count, items_[static_cast<std::size_t>(selected)].key);
+        }
+        const int last = static_cast<int>(count) - 1;
+        return selected > last ? last : selected;
+    }
+
+    // Where the item now at an index came from.
+    static constexpr uint8_t SAME = 0U;     // unmoved (or moved onto itself)
+    static constexpr uint8_t MOVED = 1U;    // another index's key moved in
+    static constexpr uint8_t ARRIVED = 2U;  // no old item: text and style fresh
+
+    /**
+     * Permute items so each sits at its key's new index. Cycles are walked
+     * in place by swapping, so no text is copied; the only scratch is one
+     * index and one flag per old item.
+     */
+    void moveItemsByKey(std::size_t oldCount, std::size_t count, const uint32_t* keys) {
+        to_.resize(oldCount);
+        done_.assign(oldCount, 0U);
+        for (std::size_t i = 0; i < oldCount; ++i) {
+            to_[i] = findItemKey(keys, count, items_[i].key);
+        }
+        if (items_.size() < count) items_.resize(count);
+
+        for (std::size_t start = 0; start < oldCount; ++start) {
+            if (done_[start] != 0U || to_[start] < 0) continue;
+            done_[start] = 1U;
+            Item carry = std::move(items_[start]);
+            std::size_t from = start;
+            for (;;) {
+                const auto dest = static_cast<std::size_t>(to_[from]);
+                std::swap(carry, items_[dest]);
+                origin_[dest] = dest == from ? SAME : MOVED;
+                // carry now holds what dest held: stop once that was dropped,
+                // already placed, or unused storage past the old items.
+                if (dest >= oldCount || done_[dest] != 0U || to_[dest] < 0) break;
+                done_[dest] = 1U;
+                from = dest;
+            }
+        }
+        items_.resize(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            if (origin_[i] == ARRIVED) items_[i].style = Style{};
+        }
+    }
+
+    std::vector<Item> items_;
+    std::vector<int> to_;
+    std::vector<uint8_t> done_;
+    std::vector<uint8_t> origin_;
+    std::size_t size_ = 0U;
+    bool keyed_ = false;
+    bool has_text_ = false;
+};
+
+}  // namespace ms::ui
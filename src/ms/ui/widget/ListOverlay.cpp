@@ -1,9 +1,12 @@
 #include "ListOverlay.hpp"
 
+#include <algorithm>
 #include <cstring>
+#include <utility>
 
 #include <config/PlatformCompat.hpp>
 #include <oc/ui/lvgl/style/StyleBuilder.hpp>
+#include <ms/ui/PerfCounters.hpp>
 #include <ms/ui/font/CoreFonts.hpp>
 
 namespace ms::ui {
@@ -11,47 +14,122 @@ namespace ms::ui {
 using namespace oc::ui::lvgl;
 namespace style = oc::ui::lvgl::style;
 
+namespace {
+constexpr int ITEM_HEIGHT = 32;
+
+FLASHMEM const char* vectorItemAt(const void* source, size_t index) {
+    return (*static_cast<const std::vector<std::string>*>(source))[index].c_str();
+}
+
+FLASHMEM const char* spanItemAt(const void* source, size_t index) {
+    return static_cast<const char* const*>(source)[index];
+}
+}
+
 FLASHMEM ListOverlay::ListOverlay(lv_obj_t* parent) : parent_(parent) {
+    MS_UI_PERF_CONSTRUCT(ListOverlay);
     createOverlay();
+    MS_UI_PERF_OBJECTS(ListOverlay, overlay_);
     lv_obj_add_flag(overlay_, LV_OBJ_FLAG_HIDDEN);
     ui_created_ = true;
     visible_ = false;
+    whenCoreFontsReady(coreFontAliasBit(CoreFontAlias::TempoLabel) |
+                           coreFontAliasBit(CoreFontAlias::ListItemLabel),
+                       onCoreFontsReady,
+                       this);
 }
 
-FLASHMEM ListOverlay::~ListOverlay() { cleanup(); }
+FLASHMEM ListOverlay::~ListOverlay() {
+    cancelCoreFontsReady(this);
+    cleanup();
+}
+
+FLASHMEM void ListOverlay::onCoreFontsReady(void* context) {
+    static_cast<ListOverlay*>(context)->applyFonts();
+}
+
+FLASHMEM void ListOverlay::applyFonts() {
+    if (title_label_) title_label_->font(coreFontOrDefault(fonts.tempo_label));
+    // Rows pick the item font on bind: forget the one they hold.
+    for (auto& slot : slots_) slot.font = nullptr;
+    if (list_) list_->invalidate();
+}
 
 FLASHMEM void ListOverlay::setTitle(const std::string& title) {
-    title_ = title;
+    if (!title_.assign(title.c_str())) return;
 
     if (ui_created_ && title_label_) {
         if (title_.empty()) {
             lv_obj_add_flag(title_label_->getElement(), LV_OBJ_FLAG_HIDDEN);
         } else {
-            title_label_->setText(title_);
+            title_label_->setText(title_.c_str());
+            MS_UI_PERF_COUNT(ListOverlay, LabelTextSets, 1U);
             lv_obj_clear_flag(title_label_->getElement(), LV_OBJ_FLAG_HIDDEN);
         }
     }
 }
 
 FLASHMEM void ListOverlay::setItems(const std::vector<std::string>& items) {
-    if (!using_static_items_ && owned_items_ == items) { return; }
+    (void)reconcileItems(&items, vectorItemAt, items.size(), nullptr);
+}
+
+FLASHMEM void ListOverlay::updateItems(const char* const* items, size_t itemCount, const uint32_t* keys) {
+    if (!items) itemCount = 0;
+    (void)reconcileItems(items, spanItemAt, itemCount, keys);
+}
+
+FLASHMEM size_t ListOverlay::appendItemsIfPossible(const std::vector<std::string>& items) {
+    const bool wasOwned = !using_static_items_;
+    const size_t existing = item_count_;
+    const size_t rewritten = reconcileItems(&items, vectorItemAt, items.size(), nullptr);
+    if (!wasOwned || rewritten != 0 || item_count_ <= existing) return 0;
+    return item_count_ - existing;
+}
+
+FLASHMEM size_t ListOverlay::reconcileItems(
+    const void* source,
+    ItemStore::TextAt textAt,
+    size_t itemCount,
+    const uint32_t* keys
+) {
+    const int windowStart = list_ ? list_->getWindowStart() : 0;
+    std::array<int, VISIBLE_SLOTS> visibleDirty{};
+    int visibleDirtyCount = 0;
+
+    // Keyed items move with their text and styling, so an insert copies
+    // one string; the callback names each index whose row now shows
+    // something else (another key, a new item or new text).
+    const auto update = items_.reconcile(
+        source, textAt, itemCount, keys, selected_index_, [&](size_t item) {
+            forgetSlotText(item);
+            const int index = static_cast<int>(item);
+            if (index >= windowStart && index < windowStart + VISIBLE_SLOTS &&
+                visibleDirtyCount < VISIBLE_SLOTS) {
+                visibleDirty[static_cast<size_t>(visibleDirtyCount++)] = index;
+            }
+        });
 
-    owned_items_ = items;
     static_items_ = nullptr;
     using_static_items_ = false;
-    item_count_ = owned_items_.size();
+    item_count_ = items_.size();
+    if (update.selected >= 0) selected_index_ = update.selected;
+    clampSelection();
 
-    if (selected_index_ >= static_cast<int>(item_count_)) {
-        selected_index_ = item_count_ == 0 ? 0 : static_cast<int>(item_count_ - 1);
-    }
-    if (selected_index_ < 0) { selected_index_ = 0; }
+    if (!ui_created_ || !list_) return update.rewritten;
 
-    if (ui_created_ && list_) {
-        destroyList();
-        populateList();
-        updateHighlight();
-        scrollToSelected();
+    // A count change rebinds the window, and rows that kept their item and
+    // text skip the label update; otherwise patch only the changed rows.
+    if (!list_->setTotalCount(static_cast<int>(item_count_))) {
+        for (int i = 0; i < visibleDirtyCount; ++i) {
+            list_->invalidateIndex(visibleDirty[static_cast<size_t>(i)]);
+        }
     }
+    list_->setSelectedIndex(selected_index_);
+    return update.rewritten;
+}
+
+FLASHMEM void ListOverlay::forgetSlotText(size_t index) {
+    if (auto* slot = findBoundSlot(index)) slot->boundText = nullptr;
 }
 
 FLASHMEM void ListOverlay::setItems(const char* const* items, size_t itemCount) {
@@ -59,22 +137,35 @@ FLASHMEM void ListOverlay::setItems(const char* const* items, size_t itemCount)
         return;
     }
 
-    owned_items_.clear();
+    items_.resetExternal(itemCount);
     static_items_ = items;
     item_count_ = itemCount;
     using_static_items_ = true;
 
+    clampSelection();
+    applyItems();
+}
+
+FLASHMEM void ListOverlay::clampSelection() {
     if (selected_index_ >= static_cast<int>(item_count_)) {
         selected_index_ = item_count_ == 0 ? 0 : static_cast<int>(item_count_ - 1);
     }
     if (selected_index_ < 0) { selected_index_ = 0; }
+}
 
-    if (ui_created_ && list_) {
-        destroyList();
-        populateList();
-        updateHighlight();
-        scrollToSelected();
+FLASHMEM void ListOverlay::applyItems() {
+    // Item indices change meaning: styling was reset with the items, and
+    // row bindings go too.
+    for (auto& slot : slots_) {
+        slot.boundIndex = -1;
+        slot.boundText = nullptr;
     }
+    if (!ui_created_ || !list_) return;
+
+    if (!list_->setTotalCount(static_cast<int>(item_count_))) {
+        list_->invalidate();
+    }
+    list_->setSelectedIndex(selected_index_);
 }
 
 FLASHMEM void ListOverlay::setSelectedIndex(int index) {
@@ -84,27 +175,31 @@ FLASHMEM void ListOverlay::setSelectedIndex(int index) {
     }
 
     int size = static_cast<int>(item_count_);
-    int prev_index = selected_index_;
     index = ((index % size) + size) % size;
 
     if (selected_index_ != index) {
         selected_index_ = index;
 
-        if (ui_created_ && visible_) {
-            updateHighlight();
-            int delta = index - prev_index;
-            bool isWrap = (delta > 1) || (delta < -1);
-            scrollToSelected(!isWrap);
+        if (ui_created_ && visible_ && list_) {
+            // Wraps jump the window directly; VirtualList binds only the
+            // rows of the new window.
+            list_->setSelectedIndex(selected_index_);
         }
     }
 }
 
 FLASHMEM void ListOverlay::show() {
     if (overlay_) {
+        if (!visible_) {
+            occlusion_.cover(overlay_);
+            backdrop_.capture(overlay_);
+        }
         lv_obj_clear_flag(overlay_, LV_OBJ_FLAG_HIDDEN);
         visible_ = true;
-        updateHighlight();
-        scrollToSelected();
+        if (list_) {
+            list_->show();
+            list_->setSelectedIndex(selected_index_);
+        }
     }
 }
 
@@ -112,7 +207,10 @@ FLASHMEM void ListOverlay::hide() {
     if (overlay_) {
         lv_obj_add_flag(overlay_, LV_OBJ_FLAG_HIDDEN);
         visible_ = false;
+        if (list_) list_->hide();
     }
+    backdrop_.release();
+    occlusion_.uncover();
 }
 
 FLASHMEM bool ListOverlay::isVisible() const { return visible_ && ui_created_; }
@@ -121,31 +219,60 @@ FLASHMEM int ListOverlay::getSelectedIndex() const { return item_count_ == 0 ? -
 
 FLASHMEM int ListOverlay::getItemCount() const { return static_cast<int>(item_count_); }
 
+FLASHMEM const ListOverlay::SlotWidgets* ListOverlay::findBoundSlot(size_t index) const {
+    for (const auto& slot : slots_) {
+        if (slot.boundIndex >= 0 && static_cast<size_t>(slot.boundIndex) == index) return &slot;
+    }
+    return nullptr;
+}
+
+FLASHMEM ListOverlay::SlotWidgets* ListOverlay::findBoundSlot(size_t index) {
+    for (auto& slot : slots_) {
+        if (slot.boundIndex >= 0 && static_cast<size_t>(slot.boundIndex) == index) return &slot;
+    }
+    return nullptr;
+}
+
 FLASHMEM lv_obj_t* ListOverlay::getButton(size_t index) const {
-    return (index < buttons_.size()) ? buttons_[index] : nullptr;
+    const auto* slot = findBoundSlot(index);
+    return slot ? slot->button : nullptr;
 }
 
 FLASHMEM oc::ui::lvgl::Label* ListOverlay::getLabel(size_t index) const {
-    return (index < labels_.size()) ? labels_[index].get() : nullptr;
+    const auto* slot = findBoundSlot(index);
+    return (slot && !slot->labelHidden) ? slot->label.get() : nullptr;
 }
 
 FLASHMEM void ListOverlay::setItemFont(size_t index, const lv_font_t* font) {
-    if (!font) return;
-
-    auto* label = getLabel(index);
-    if (label) {
-        label->font(font);
+    auto* style = index < item_count_ ? items_.style(index) : nullptr;
+    if (!font || !style) return;
+
+    style->font = font;
+    auto* slot = findBoundSlot(index);
+    if (slot && slot->label && slot->font != font) {
+        slot->label->font(font);
+        slot->font = font;
     }
 }
 
 FLASHMEM void ListOverlay::removeLabel(size_t index) {
-    if (index < labels_.size() && labels_[index]) {
-        // Manually delete LVGL container since ownsLvglObjects is false
-        if (labels_[index]->getElement()) {
-            lv_obj_delete(labels_[index]->getElement());
-        }
-        labels_[index].reset();
+    auto* style = index < item_count_ ? items_.style(index) : nullptr;
+    if (!style) return;
+
+    style->labelHidden = true;
+    auto* slot = findBoundSlot(index);
+    if (slot && slot->label && !slot->labelHidden) {
+        lv_obj_add_flag(slot->label->getElement(), LV_OBJ_FLAG_HIDDEN);
+        slot->labelHidden = true;
+    }
+}
+
+FLASHMEM const char* ListOverlay::itemText(size_t index) const {
+    if (index >= item_count_) return "";
+    if (using_static_items_) {
+        return (static_items_ != nullptr && static_items_[index] != nullptr) ? static_items_[index] : "";
     }
+    return items_.text(index);
 }
 
 FLASHMEM void ListOverlay::createOverlay() {
@@ -168,7 +295,6 @@ FLASHMEM void ListOverlay::createOverlay() {
 
     createTitleLabel();
     createList();
-    populateList();
 }
 
 FLASHMEM void ListOverlay::createTitleLabel() {
@@ -184,102 +310,30 @@ FLASHMEM void ListOverlay::createTitleLabel() {
     lv_obj_set_style_margin_right(elem, base_theme::layout::MARGIN_MD, LV_STATE_DEFAULT);
     lv_obj_set_style_margin_top(elem, base_theme::layout::MARGIN_MD, LV_STATE_DEFAULT);
 
-    if (fonts.tempo_label) {
-        title_label_->font(fonts.tempo_label);
-    }
+    title_label_->font(coreFontOrDefault(fonts.tempo_label));
 
     if (title_.empty()) {
         lv_obj_add_flag(elem, LV_OBJ_FLAG_HIDDEN);
     } else {
-        title_label_->setText(title_);
+        title_label_->setText(title_.c_str());
+        MS_UI_PERF_COUNT(ListOverlay, LabelTextSets, 1U);
     }
 }
 
 FLASHMEM void ListOverlay::createList() {
-    list_ = lv_list_create(container_);
-    lv_obj_set_size(list_, LV_PCT(100), LV_PCT(100));
-    lv_obj_set_flex_grow(list_, 1);
-    lv_obj_set_style_bg_opa(list_, base_theme::opacity::OPA_TRANSP, LV_STATE_DEFAULT);
-    lv_obj_set_style_border_width(list_, 0, LV_STATE_DEFAULT);
-    lv_obj_set_style_pad_all(list_, base_theme::layout::LIST_PAD, LV_STATE_DEFAULT);
-    lv_obj_set_style_pad_row(list_, base_theme::layout::LIST_ITEM_GAP, LV_STATE_DEFAULT);
-    lv_obj_set_style_margin_left(list_, base_theme::layout::MARGIN_MD, LV_STATE_DEFAULT);
-    lv_obj_set_style_margin_right(list_, base_theme::layout::MARGIN_MD, LV_STATE_DEFAULT);
-
-    lv_obj_set_style_width(list_, base_theme::layout::SCROLLBAR_WIDTH, LV_PART_SCROLLBAR);
-    lv_obj_set_style_bg_color(list_, lv_color_hex(base_theme::color::INACTIVE_LIGHTER), LV_PART_SCROLLBAR);
-    lv_obj_set_style_bg_opa(list_, base_theme::opacity::OPA_30, LV_PART_SCROLLBAR);
-
-    lv_obj_add_event_cb(
-        list_,
-        [](lv_event_t* e) {
-            if (lv_event_get_code(e) == LV_EVENT_SCROLL_BEGIN) {
-                lv_anim_t* anim = lv_event_get_scroll_anim(e);
-                if (anim) { anim->duration = base_theme::animation::SCROLL_ANIM_MS; }
-            }
-        },
-        LV_EVENT_SCROLL_BEGIN, nullptr);
-}
-
-FLASHMEM void ListOverlay::populateList() {
-    if (!list_) return;
-
-    buttons_.clear();
-    labels_.clear();
-    previous_index_ = -1;  // Reset for optimized highlight tracking
-
-    const auto addItem = [this](const char* itemText) {
-        lv_obj_t* btn = lv_obj_create(list_);
-        lv_obj_set_width(btn, LV_PCT(100));
-        lv_obj_set_height(btn, LV_SIZE_CONTENT);
-
-        lv_obj_set_style_bg_opa(btn, base_theme::opacity::OPA_TRANSP, LV_STATE_DEFAULT);
-        lv_obj_set_style_bg_opa(btn, base_theme::opacity::OPA_TRANSP, LV_STATE_CHECKED);
-
-        lv_obj_set_style_pad_left(btn, base_theme::layout::PAD_BUTTON_H, LV_STATE_DEFAULT);
-        lv_obj_set_style_pad_right(btn, base_theme::layout::MARGIN_LG, LV_STATE_DEFAULT);
-        lv_obj_set_style_pad_top(btn, base_theme::layout::PAD_BUTTON_V, LV_STATE_DEFAULT);
-        lv_obj_set_style_pad_bottom(btn, base_theme::layout::PAD_BUTTON_V, LV_STATE_DEFAULT);
-        lv_obj_set_style_pad_column(btn, base_theme::layout::MARGIN_MD, LV_STATE_DEFAULT);
-
-        lv_obj_set_style_radius(btn, LV_RADIUS_CIRCLE, LV_STATE_DEFAULT);
-        lv_obj_set_style_border_width(btn, 0, LV_STATE_DEFAULT);
-
-        lv_obj_set_flex_flow(btn, LV_FLEX_FLOW_ROW);
-        lv_obj_set_flex_align(btn, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
-
-        // Use framework Label widget with auto-scroll for overflow text
-        // ownsLvglObjects(false) lets LVGL parent-child handle deletion
-        auto label = std::make_unique<Label>(btn);
-        label->flexGrow(true)
-              .alignment(LV_TEXT_ALIGN_LEFT)
-              .color(base_theme::color::INACTIVE_LIGHTER)
-              .ownsLvglObjects(false);
-
-        if (fonts.list_item_label) {
-            label->font(fonts.list_item_label);
-        }
-
-        // Apply styles for focused state on the inner label element
-        lv_obj_set_style_text_color(label->getLabel(), lv_color_hex(base_theme::color::TEXT_PRIMARY), LV_STATE_FOCUSED);
-
-        label->setText(itemText != nullptr ? itemText : "");
-
-        labels_.push_back(std::move(label));
-        buttons_.push_back(btn);
-    };
-
-    if (using_static_items_) {
-        for (size_t i = 0; i < item_count_; ++i) {
-            addItem(static_items_ != nullptr ? static_items_[i] : "");
-        }
-    } else {
-        for (const auto& item : owned_items_) {
-            addItem(item.c_str());
-        }
-    }
-
-    updateHighlight();
+    list_ = std::make_unique<widget::VirtualList>(container_);
+    list_->visibleCount(VISIBLE_SLOTS)
+        .itemHeight(ITEM_HEIGHT)
+        .scrollMode(widget::ScrollMode::CenterLocked)
+        .padding(base_theme::layout::LIST_PAD)
+        .itemGap(base_theme::layout::LIST_ITEM_GAP)
+        .marginH(base_theme::layout::MARGIN_MD)
+        .onBindSlot([this](widget::VirtualSlot& slot, int index, bool isSelected) {
+            bindSlot(slot, index, isSelected);
+        })
+        .onUpdateHighlight([this](widget::VirtualSlot& slot, bool isSelected) {
+            updateSlotHighlight(slot, isSelected);
+        });
 }
 
 FLASHMEM static void applyStateRecursive(lv_obj_t* obj, lv_state_t state, bool apply) {
@@ -298,53 +352,113 @@ FLASHMEM static void applyStateRecursive(lv_obj_t* obj, lv_state_t state, bool a
     }
 }
 
-FLASHMEM void ListOverlay::updateHighlight() {
-    if (buttons_.empty() || selected_index_ < 0 ||
-        selected_index_ >= static_cast<int>(buttons_.size())) {
-        return;
-    }
+FLASHMEM ListOverlay::SlotWidgets* ListOverlay::ensureSlotWidgets(lv_obj_t* container, int slotIndex) {
+    if (!container || slotIndex < 0 || slotIndex >= VISIBLE_SLOTS) return nullptr;
 
-    // Optimization: Only update the items that changed (previous and current)
-    // instead of iterating all buttons
-    if (previous_index_ >= 0 && previous_index_ < static_cast<int>(buttons_.size()) &&
-        previous_index_ != selected_index_) {
-        applyStateRecursive(buttons_[previous_index_], LV_STATE_FOCUSED, false);
-    }
+    auto& slot = slots_[static_cast<size_t>(slotIndex)];
+    if (slot.button == container && slot.label) return &slot;
+
+    lv_obj_t* btn = container;
+    lv_obj_set_style_bg_opa(btn, base_theme::opacity::OPA_TRANSP, LV_STATE_DEFAULT);
+    lv_obj_set_style_bg_opa(btn, base_theme::opacity::OPA_TRANSP, LV_STATE_CHECKED);
 
-    applyStateRecursive(buttons_[selected_index_], LV_STATE_FOCUSED, true);
-    previous_index_ = selected_index_;
+    lv_obj_set_style_pad_left(btn, base_theme::layout::PAD_BUTTON_H, LV_STATE_DEFAULT);
+    lv_obj_set_style_pad_right(btn, base_theme::layout::MARGIN_LG, LV_STATE_DEFAULT);
+    lv_obj_set_style_pad_top(btn, base_theme::layout::PAD_BUTTON_V, LV_STATE_DEFAULT);
+    lv_obj_set_style_pad_bottom(btn, base_theme::layout::PAD_BUTTON_V, LV_STATE_DEFAULT);
+    lv_obj_set_style_pad_column(btn, base_theme::layout::MARGIN_MD, LV_STATE_DEFAULT);
+
+    lv_obj_set_style_radius(btn, LV_RADIUS_CIRCLE, LV_STATE_DEFAULT);
+    lv_obj_set_style_border_width(btn, 0, LV_STATE_DEFAULT);
+
+    lv_obj_set_flex_flow(btn, LV_FLEX_FLOW_ROW);
+    lv_obj_set_flex_align(btn, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
+
+    // Use framework Label widget with auto-scroll for overflow text
+    // ownsLvglObjects(false) lets LVGL parent-child handle deletion
+    slot.label = std::make_unique<Label>(btn);
+    slot.label->flexGrow(true)
+        .alignment(LV_TEXT_ALIGN_LEFT)
+        .color(base_theme::color::INACTIVE_LIGHTER)
+        .ownsLvglObjects(false);
+
+    slot.font = coreFontOrDefault(fonts.list_item_label);
+    slot.label->font(slot.font);
+
+    // Apply styles for focused state on the inner label element
+    lv_obj_set_style_text_color(slot.label->getLabel(), lv_color_hex(base_theme::color::TEXT_PRIMARY), LV_STATE_FOCUSED);
+
+    MS_UI_PERF_OBJECTS(ListOverlay, slot.label->getElement());
+
+    slot.button = btn;
+    slot.boundIndex = -1;
+    slot.boundText = nullptr;
+    slot.labelHidden = false;
+    return &slot;
 }
 
-FLASHMEM void ListOverlay::scrollToSelected(bool animate) {
-    if (buttons_.empty() || selected_index_ < 0 ||
-        selected_index_ >= static_cast<int>(buttons_.size()) || !list_) {
-        return;
+FLASHMEM void ListOverlay::bindSlot(widget::VirtualSlot& slot, int index, bool isSelected) {
+    if (!list_ || index < 0 || static_cast<size_t>(index) >= item_count_) return;
+
+    auto* widgets = ensureSlotWidgets(slot.container, index - list_->getWindowStart());
+    if (!widgets || !widgets->label) return;
+    MS_UI_PERF_COUNT(ListOverlay, RowsBound, 1U);
+
+    const auto* entry = std::as_const(items_).style(static_cast<size_t>(index));
+    const lv_font_t* font =
+        (entry && entry->font) ? entry->font : coreFontOrDefault(fonts.list_item_label);
+    if (widgets->font != font) {
+        widgets->label->font(font);
+        widgets->font = font;
+    }
+
+    const bool hidden = entry && entry->labelHidden;
+    if (widgets->labelHidden != hidden) {
+        if (hidden) {
+            lv_obj_add_flag(widgets->label->getElement(), LV_OBJ_FLAG_HIDDEN);
+        } else {
+            lv_obj_clear_flag(widgets->label->getElement(), LV_OBJ_FLAG_HIDDEN);
+        }
+        widgets->labelHidden = hidden;
+    }
+
+    // Stored text only changes through reconcileItems(), which forgets the
+    // bound text, so the same index at the same address is the same text.
+    const char* text = itemText(static_cast<size_t>(index));
+    if (widgets->boundIndex != index || widgets->boundText != text) {
+        widgets->label->setText(text);
+        MS_UI_PERF_COUNT(ListOverlay, LabelTextSets, 1U);
+        widgets->boundText = text;
     }
 
-    lv_obj_scroll_to_view(buttons_[selected_index_], animate ? LV_ANIM_ON : LV_ANIM_OFF);
+    widgets->boundIndex = index;
+    applyStateRecursive(widgets->button, LV_STATE_FOCUSED, isSelected);
 }
 
-FLASHMEM void ListOverlay::destroyList() {
-    // Labels have ownsLvglObjects(false), so they don't delete LVGL objects
-    // LVGL parent-child handles cleanup when lv_obj_clean() is called
-    labels_.clear();
-    if (list_) {
-        lv_obj_clean(list_);
+FLASHMEM void ListOverlay::updateSlotHighlight(widget::VirtualSlot& slot, bool isSelected) {
+    for (auto& widgets : slots_) {
+        if (widgets.button == slot.container) {
+            applyStateRecursive(widgets.button, LV_STATE_FOCUSED, isSelected);
+            return;
+        }
     }
-    buttons_.clear();
 }
 
 FLASHMEM void ListOverlay::cleanup() {
     // Labels have ownsLvglObjects(false) - overlay deletion handles LVGL cleanup
-    labels_.clear();
+    for (auto& slot : slots_) {
+        slot.label.reset();
+        slot.button = nullptr;
+    }
     title_label_.reset();
+    list_.reset();
+    backdrop_.release();
+    occlusion_.uncover();
     if (overlay_) {
         lv_obj_delete(overlay_);
         overlay_ = nullptr;
         container_ = nullptr;
-        list_ = nullptr;
     }
-    buttons_.clear();
     ui_created_ = false;
     visible_ = false;
 }
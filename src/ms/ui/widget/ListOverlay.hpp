@@ -6,7 +6,7 @@
  *
  * Pure UI component displaying a centered modal with:
  * - Title header
- * - Scrollable list of string items
+ * - Virtualized list of string items (O(visible) LVGL objects)
  * - Visual selection highlighting
  *
  * Stateless and callback-free - data is pushed via setters.
@@ -16,7 +16,9 @@
  * @see DeviceSelector for a more complex virtualized variant
  */
 
+#include <array>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -26,6 +28,12 @@
 #include <oc/ui/lvgl/IComponent.hpp>
 #include <oc/ui/lvgl/theme/BaseTheme.hpp>
 #include <oc/ui/lvgl/widget/Label.hpp>
+#include <oc/ui/lvgl/widget/VirtualList.hpp>
+
+#include <ms/ui/component/BackdropSnapshot.hpp>
+#include <ms/ui/component/Occlusion.hpp>
+#include <ms/ui/text/FixedText.hpp>
+#include <ms/ui/widget/ListItemStore.hpp>
 
 namespace ms::ui {
 
@@ -33,7 +41,8 @@ namespace ms::ui {
  * @brief Pure UI widget for modal list overlay with selection
  *
  * Displays a centered modal overlay containing a scrollable list of items.
- * Supports visual selection highlighting via index.
+ * Supports visual selection highlighting via index. Rows are VirtualList
+ * slots bound on demand, so item count does not drive LVGL object count.
  *
  * PURE UI - No logic, no callbacks, only setters/getters.
  *
@@ -53,16 +62,29 @@ public:
     ListOverlay(const ListOverlay&) = delete;
     ListOverlay& operator=(const ListOverlay&) = delete;
 
+    /** Titles longer than 63 bytes are cut on a UTF-8 boundary. */
     void setTitle(const std::string& title);
     void setItems(const std::vector<std::string>& items);
     void setItems(const char* const* items, size_t itemCount);
     void setSelectedIndex(int index);
 
     /**
-     * @brief Append new items to the list without destroying existing ones
+     * @brief Reconcile against a caller-owned item span
+     *
+     * Nothing is retained from the span: only items whose text changed are
+     * copied, and only visible rows that changed are rebound. Any number of
+     * items of any length is kept. With keys, items are matched by key:
+     * text, styling and the selection move with it, so an insert or removal
+     * rebinds only rows whose key or text changed. Without keys items are
+     * matched by index.
+     */
+    void updateItems(const char* const* items, size_t itemCount, const uint32_t* keys = nullptr);
+
+    /**
+     * @brief Append new items to the list without rebinding existing ones
      *
      * Optimized for windowed loading where items are added incrementally.
-     * Only creates new LVGL objects for the appended items.
+     * Only the item count grows; visible rows keep their bindings.
      *
      * @param items Full list including existing + new items
      * @return Number of new items appended (0 if full rebuild was needed)
@@ -76,41 +98,91 @@ public:
     int getSelectedIndex() const;
     int getItemCount() const;
 
-    lv_obj_t* getButton(size_t index) const;
-    oc::ui::lvgl::Label* getLabel(size_t index) const;
+    /**
+     * Per-item styling. Same contract as when every item owned its row: the
+     * call works for any index, visible or not, and lasts until the items
+     * are replaced (keyed updates carry it along with its key).
+     *
+     * removeLabel() leaves the item's row without text. Rows are shared
+     * slots now, so the label is hidden whenever that item is bound rather
+     * than deleted.
+     */
     void setItemFont(size_t index, const lv_font_t* font);
     void removeLabel(size_t index);
 
+    /**
+     * Row widgets exist only for items inside the visible window: nullptr
+     * otherwise, and the pointer is only valid until the next scroll.
+     * Styling applied through them is lost on rebind.
+     */
+    [[deprecated("rows are virtual; use setItemFont()/removeLabel()")]]
+    lv_obj_t* getButton(size_t index) const;
+    [[deprecated("rows are virtual; use setItemFont()/removeLabel()")]]
+    oc::ui::lvgl::Label* getLabel(size_t index) const;
+
     lv_obj_t* getElement() const override { return overlay_; }
     lv_obj_t* getContainer() const { return container_; }
 
 private:
+    static constexpr int VISIBLE_SLOTS = 5;
+
+    struct SlotWidgets {
+        lv_obj_t* button = nullptr;
+        std::unique_ptr<oc::ui::lvgl::Label> label;
+        int boundIndex = -1;
+        const char* boundText = nullptr;
+        const lv_font_t* font = nullptr;
+        bool labelHidden = false;
+    };
+
+    // Per-item styling, re-applied whenever the item is bound.
+    struct ItemStyle {
+        const lv_font_t* font = nullptr;
+        bool labelHidden = false;
+    };
+
+    static constexpr size_t TITLE_CAPACITY = 64;
+    using ItemStore = ListItemStore<ItemStyle>;
+
     void createOverlay();
     void createTitleLabel();
     void createList();
-    void populateList();
+    // Title and row fonts may still be loading at construction: re-applied
+    // once their aliases are ready.
+    void applyFonts();
+    static void onCoreFontsReady(void* context);
+
+    void bindSlot(oc::ui::lvgl::widget::VirtualSlot& slot, int index, bool isSelected);
+    void updateSlotHighlight(oc::ui::lvgl::widget::VirtualSlot& slot, bool isSelected);
+    SlotWidgets* ensureSlotWidgets(lv_obj_t* container, int slotIndex);
+    const SlotWidgets* findBoundSlot(size_t index) const;
+    SlotWidgets* findBoundSlot(size_t index);
+    const char* itemText(size_t index) const;
+    size_t reconcileItems(const void* source, ItemStore::TextAt textAt, size_t itemCount, const uint32_t* keys);
+    void forgetSlotText(size_t index);
+    void applyItems();
+    void clampSelection();
 
-    void updateHighlight();
-    void scrollToSelected(bool animate = true);
-
-    void destroyList();
     void cleanup();
 
     lv_obj_t* parent_ = nullptr;
     lv_obj_t* overlay_ = nullptr;
     lv_obj_t* container_ = nullptr;
     std::unique_ptr<oc::ui::lvgl::Label> title_label_;
-    lv_obj_t* list_ = nullptr;
-
-    std::vector<lv_obj_t*> buttons_;
-    std::vector<std::unique_ptr<oc::ui::lvgl::Label>> labels_;
-    std::vector<std::string> owned_items_;
+    std::unique_ptr<oc::ui::lvgl::widget::VirtualList> list_;
+    // Dimmed capture of the screen beneath while open (MS_UI_OVERLAY_SNAPSHOT).
+    BackdropSnapshot backdrop_;
+    // Pauses widgets beneath while open, whatever the backdrop mode.
+    OverlayOcclusion occlusion_;
+
+    std::array<SlotWidgets, VISIBLE_SLOTS> slots_{};
+    // Owned item copies plus the styling of items, owned or static.
+    ItemStore items_;
     const char* const* static_items_ = nullptr;
     size_t item_count_ = 0;
     bool using_static_items_ = false;
-    std::string title_;
+    FixedText<TITLE_CAPACITY> title_;
     int selected_index_ = 0;
-    int previous_index_ = -1;  // Track previous selection for optimized highlight updates
     bool visible_ = false;
     bool ui_created_ = false;
 };
@@ -0,0 +1,212 @@
+#include "MarqueeEngine.hpp"
+
+#include <cstring>
+
+#include <config/PlatformCompat.hpp>
+#include <oc/diagnostics/Performance.hpp>
+
+#include <ms/ui/PerfCounters.hpp>
+#include <ms/ui/widget/LabelBitmapMode.hpp>
+
+namespace ms::ui {
+
+FLASHMEM MarqueeEngine::MarqueeEngine(MarqueeTiming timing) : timing_(timing) {
+    for (auto& lane : lanes_) lane.owner = this;
+}
+
+FLASHMEM MarqueeEngine::~MarqueeEngine() {
+    stopAll();
+    if (timer_) {
+        lv_timer_delete(timer_);
+        timer_ = nullptr;
+    }
+}
+
+FLASHMEM bool MarqueeEngine::start(lv_obj_t* label) {
+    if (!label) return false;
+    Lane* lane = laneFor(label);
+    if (!lane) {
+        lane = laneFor(nullptr);
+        if (!lane) return false;
+        lane->label = label;
+        lv_label_set_long_mode(label, LV_LABEL_LONG_CLIP);
+        lv_obj_add_event_cb(label, onDrawMain,
+                            static_cast<lv_event_code_t>(LV_EVENT_DRAW_MAIN | LV_EVENT_PREPROCESS), lane);
+        lv_obj_add_event_cb(label, onDelete, LV_EVENT_DELETE, lane);
+    }
+
+    lane->track.clear();
+    lane->offset = 0;
+    const char* text = lv_label_get_text(label);
+    const lv_font_t* font = lv_obj_get_style_text_font(label, LV_PART_MAIN);
+    lane->textWidth = text && font
+        ? lv_text_get_width(text, static_cast<uint32_t>(std::strlen(text)), font,
+                            lv_obj_get_style_text_letter_space(label, LV_PART_MAIN))
+        : 0;
+    lane->configured = false;
+    configure(*lane, lv_tick_get());
+    if (paused_) lane->track.pause(lv_tick_get());
+    MS_UI_PERF_INVALIDATE(Marquee, label);
+    refreshTimer();
+    return true;
+}
+
+FLASHMEM void MarqueeEngine::stop(lv_obj_t* label) {
+    Lane* lane = label ? laneFor(label) : nullptr;
+    if (!lane) return;
+    lv_label_set_long_mode(label, LV_LABEL_LONG_DOT);
+    MS_UI_PERF_INVALIDATE(Marquee, label);
+    release(*lane);
+    refreshTimer();
+}
+
+FLASHMEM void MarqueeEngine::stopAll() {
+    for (auto& lane : lanes_) {
+        if (lane.label) stop(lane.label);
+    }
+}
+
+FLASHMEM void MarqueeEngine::pause() {
+    if (paused_) return;
+    paused_ = true;
+    const uint32_t now = lv_tick_get();
+    for (auto& lane : lanes_) {
+        if (lane.label) lane.track.pause(now);
+    }
+    refreshTimer();
+}
+
+FLASHMEM void MarqueeEngine::resume() {
+    if (!paused_) return;
+    paused_ = false;
+    // Lanes that are still off-screen re-freeze on the next tick.
+    const uint32_t now = lv_tick_get();
+    for (auto& lane : lanes_) {
+        if (lane.label) lane.track.resume(now);
+    }
+    refreshTimer();
+}
+
+FLASHMEM bool MarqueeEngine::scrolling(const lv_obj_t* label) const {
+    for (const auto& lane : lanes_) {
+        if (label && lane.label == label) return lane.track.scrolls();
+    }
+    return false;
+}
+
+FLASHMEM MarqueeEngine::Lane* MarqueeEngine::laneFor(const lv_obj_t* label) {
+    for (auto& lane : lanes_) {
+        if (lane.label == label) return &lane;
+    }
+    return nullptr;
+}
+
+FLASHMEM void MarqueeEngine::release(Lane& lane) {
+    if (lane.label) {
+        lv_obj_remove_event_cb_with_user_data(lane.label, onDrawMain, &lane);
+        lv_obj_remove_event_cb_with_user_data(lane.label, onDelete, &lane);
+    }
+    lane.label = nullptr;
+    lane.track.clear();
+    lane.offset = 0;
+    lane.textWidth = 0;
+    lane.configured = false;
+}
+
+FLASHMEM bool MarqueeEngine::configure(Lane& lane, uint32_t nowMs) {
+    if (lane.configured) return true;
+    lv_area_t content;
+    lv_obj_get_content_coords(lane.label, &content);
+    const int32_t viewWidth = lv_area_get_width(&content);
+    if (viewWidth <= 0) return false;
+    lane.track.configure(lane.textWidth, viewWidth, timing_, nowMs);
+    lane.configured = true;
+    return true;
+}
+
+void MarqueeEngine::tick() {
+    OC_PERF_SCOPE(perfTick, "ui.marquee.tick");
+    const uint32_t now = lv_tick_get();
+    for (auto& lane : lanes_) {
+        if (!lane.label || !configure(lane, now) || !lane.track.scrolls()) continue;
+        // Parked rows and rows scrolled out of the list keep their phase.
+        if (!lv_obj_is_visible(lane.label)) {
+            lane.track.pause(now);
+            continue;
+        }
+        lane.track.resume(now);
+        const int32_t offset = lane.track.offset(now);
+        if (offset == lane.offset) continue;
+        lane.offset = offset;
+        MS_UI_PERF_INVALIDATE(Marquee, lane.label);
+    }
+}
+
+FLASHMEM void MarqueeEngine::refreshTimer() {
+    bool active = false;
+    if (!paused_) {
+        for (const auto& lane : lanes_) {
+            // Unconfigured lanes need ticks to learn their view width.
+            if (lane.label && (!lane.configured || lane.track.scrolls())) {
+                active = true;
+                break;
+            }
+        }
+    }
+    if (!active) {
+        if (timer_) lv_timer_pause(timer_);
+        return;
+    }
+    if (!timer_) {
+        timer_ = lv_timer_create(onTimer, MS_UI_MARQUEE_PERIOD_MS, this);
+        if (!timer_) return;
+    }
+    lv_timer_resume(timer_);
+}
+
+void MarqueeEngine::onTimer(lv_timer_t* timer) {
+    auto* self = static_cast<MarqueeEngine*>(lv_timer_get_user_data(timer));
+    if (self) self->tick();
+}
+
+// Runs before lv_label's own DRAW_MAIN (LV_EVENT_PREPROCESS). Text that
+// fits is left to the label.
+void MarqueeEngine::onDrawMain(lv_event_t* event) {
+    auto* lane = static_cast<Lane*>(lv_event_get_user_data(event));
+    lv_layer_t* layer = lv_event_get_layer(event);
+    if (!lane || !lane->label || !layer || !lane->track.scrolls()) return;
+
+    MS_UI_PERF_COUNT(Marquee, DrawCallbacks, 1U);
+    lv_event_stop_processing(event);
+    if (drawLabelBitmapScrolled(lane->label, layer, lane->offset)) return;
+
+    // Uncacheable text: draw the whole line shifted, clipped to the box.
+    lv_draw_label_dsc_t dsc;
+    lv_draw_label_dsc_init(&dsc);
+    lv_obj_init_draw_label_dsc(lane->label, LV_PART_MAIN, &dsc);
+    dsc.text = lv_label_get_text(lane->label);
+    dsc.flag |= LV_TEXT_FLAG_EXPAND;
+    dsc.align = LV_TEXT_ALIGN_LEFT;
+    lv_area_t content;
+    lv_obj_get_content_coords(lane->label, &content);
+    lv_area_t clip;
+    if (!lv_area_intersect(&clip, &content, &layer->_clip_area)) return;
+    lv_area_t area = content;
+    area.x1 -= lane->offset;
+    area.x2 = area.x1 + lane->textWidth - 1;
+    const lv_area_t savedClip = layer->_clip_area;
+    layer->_clip_area = clip;
+    lv_draw_label(layer, &dsc, &area);
+    layer->_clip_area = savedClip;
+}
+
+FLASHMEM void MarqueeEngine::onDelete(lv_event_t* event) {
+    auto* lane = static_cast<Lane*>(lv_event_get_user_data(event));
+    if (!lane || !lane->owner) return;
+    // The object is going away; its event list goes with it.
+    lane->label = nullptr;
+    lane->owner->release(*lane);
+    lane->owner->refreshTimer();
+}
+
+}  // namespace ms::ui
@@ -0,0 +1,87 @@
+#pragma once
+
+/**
+ * @file MarqueeEngine.hpp
+ * @brief One timer driving every auto-scrolling label of a view
+ */
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <lvgl.h>
+
+#include <ms/ui/widget/MarqueeTrack.hpp>
+
+// Labels one engine can scroll at once (one per visible list slot).
+#ifndef MS_UI_MARQUEE_LANES
+#define MS_UI_MARQUEE_LANES 5
+#endif
+
+#ifndef MS_UI_MARQUEE_PERIOD_MS
+#define MS_UI_MARQUEE_PERIOD_MS 33U
+#endif
+
+namespace ms::ui {
+
+/**
+ * Marquee for single-line labels wider than their box.
+ *
+ * start() switches the label to LONG_CLIP and hooks its DRAW_MAIN: the
+ * whole line is rendered once into the label bitmap cache and each frame
+ * blits it at the MarqueeTrack offset (plain lv_draw_label when the cache
+ * cannot hold it). A single lv_timer advances every lane and invalidates
+ * a label only when its offset changed. Lanes whose label is hidden or
+ * scrolled out of its list freeze; pause() freezes all of them while the
+ * owning view is hidden.
+ */
+class MarqueeEngine {
+public:
+    explicit MarqueeEngine(MarqueeTiming timing = {});
+    ~MarqueeEngine();
+
+    MarqueeEngine(const MarqueeEngine&) = delete;
+    MarqueeEngine& operator=(const MarqueeEngine&) = delete;
+
+    /**
+     * Scroll label's current text from its leading edge; call again after
+     * changing the text. Returns false when every lane is taken.
+     */
+    bool start(lv_obj_t* label);
+
+    /** Stop scrolling; the label goes back to LONG_DOT. */
+    void stop(lv_obj_t* label);
+    void stopAll();
+
+    void pause();
+    void resume();
+
+    [[nodiscard]] bool scrolling(const lv_obj_t* label) const;
+
+private:
+    struct Lane {
+        MarqueeEngine* owner = nullptr;
+        lv_obj_t* label = nullptr;
+        MarqueeTrack track{};
+        int32_t offset = 0;
+        // Text width measured, view width not known yet (before first layout).
+        int32_t textWidth = 0;
+        bool configured = false;
+    };
+
+    Lane* laneFor(const lv_obj_t* label);
+    void release(Lane& lane);
+    bool configure(Lane& lane, uint32_t nowMs);
+    void tick();
+    void refreshTimer();
+    static void onTimer(lv_timer_t* timer);
+    static void onDrawMain(lv_event_t* event);
+    static void onDelete(lv_event_t* event);
+
+    std::array<Lane, MS_UI_MARQUEE_LANES> lanes_{};
+    MarqueeTiming timing_{};
+    lv_timer_t* timer_ = nullptr;
+    bool paused_ = false;
+};
+
+}  // namespace ms::ui
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstdint>
+
+namespace ms::ui {
+
+struct MarqueeTiming {
+    uint16_t speedPxPerSec = 30U;
+    // Dwell at either end before reversing.
+    uint16_t edgePauseMs = 1000U;
+};
+
+/**
+ * Ping-pong scroll position of one text run wider than its view.
+ *
+ * Pure time -> offset mapping: the caller passes its clock (lv_tick_get()
+ * on target, a synthetic one in tests) and asks for the offset whenever it
+ * draws. The cycle is: dwell at 0, scroll to the far edge, dwell, scroll
+ * back. pause()/resume() freeze the phase while the text is not shown, so
+ * a row scrolled out of view continues where it stopped.
+ */
+class MarqueeTrack {
+public:
+    /** Restart from the leading edge; text that fits does not scroll. */
+    void configure(int textWidth, int viewWidth, const MarqueeTiming& timing, uint32_t nowMs) {
+        travel_ = textWidth > viewWidth && viewWidth > 0 ? textWidth - viewWidth : 0;
+        timing_ = timing;
+        if (timing_.speedPxPerSec == 0U) timing_.speedPxPerSec = 1U;
+        scrollMs_ = static_cast<uint32_t>(travel_) * 1000U / timing_.speedPxPerSec;
+        startMs_ = nowMs;
+        pausedElapsedMs_ = 0U;
+        paused_ = false;
+    }
+
+    void clear() { *this = MarqueeTrack{}; }
+
+    [[nodiscard]] bool scrolls() const { return travel_ > 0; }
+    [[nodiscard]] int travel() const { return travel_; }
+    [[nodiscard]] bool paused() const { return paused_; }
+
+    /** Cycle length in ms; 0 when the text fits. */
+    [[nodiscard]] uint32_t periodMs() const {
+        return scrolls() ? 2U * (timing_.edgePauseMs + scrollMs_) : 0U;
+    }
+
+    void pause(uint32_t nowMs) {
+        if (paused_) return;
+        pausedElapsedMs_ = nowMs - startMs_;
+        paused_ = true;
+    }
+
+    void resume(uint32_t nowMs) {
+        if (!paused_) return;
+        startMs_ = nowMs - pausedElapsedMs_;
+        paused_ = false;
+    }
+
+    /** Pixels the text is shifted left at nowMs, in [0, travel()]. */
+    [[nodiscard]] int offset(uint32_t nowMs) const {
+        if (!scrolls()) return 0;
+        const uint32_t elapsed = paused_ ? pausedElapsedMs_ : nowMs - startMs_;
+        uint32_t phase = elapsed % periodMs();
+        if (phase < timing_.edgePauseMs) return 0;
+        phase -= timing_.edgePauseMs;
+        if (phase < scrollMs_) return along(phase);
+        phase -= scrollMs_;
+        if (phase < timing_.edgePauseMs) return travel_;
+        phase -= timing_.edgePauseMs;
+        return travel_ - along(phase);
+    }
+
+private:
+    int along(uint32_t ms) const {
+        if (scrollMs_ == 0U) return travel_;
+        return static_cast<int>(static_cast<uint64_t>(ms) * static_cast<uint32_t>(travel_) / scrollMs_);
+    }
+
+    MarqueeTiming timing_{};
+    uint32_t startMs_ = 0U;
+    uint32_t scrollMs_ = 0U;
+    uint32_t pausedElapsedMs_ = 0U;
+    int travel_ = 0;
+    bool paused_ = false;
+};
+
+}  // namespace ms::ui
@@ -2,10 +2,13 @@
 
 #include <algorithm>
 #include <cstdint>
-#include <cstring>
 
 #include <config/PlatformCompat.hpp>
+#include <ms/ui/PerfCounters.hpp>
+#include <ms/ui/component/Occlusion.hpp>
 #include <ms/ui/font/CoreFonts.hpp>
+#include <ms/ui/widget/LabelBitmapMode.hpp>
+#include <oc/diagnostics/Performance.hpp>
 #include <oc/ui/lvgl/style/StyleBuilder.hpp>
 #include <oc/ui/lvgl/theme/BaseTheme.hpp>
 
@@ -47,10 +50,16 @@ uint32_t valueColorFor(MenuRowKind kind) {
 }  // namespace
 
 FLASHMEM MenuListView::MenuListView(lv_obj_t* parent) {
+    MS_UI_PERF_CONSTRUCT(MenuList);
     createUi(parent);
+    addOcclusionListener(container_, onOcclusion, this);
+    whenCoreFontsReady(CORE_FONTS_COMPLETE, onCoreFontsReady, this);
 }
 
 FLASHMEM MenuListView::~MenuListView() {
+    cancelCoreFontsReady(this);
+    removeOcclusionListener(this);
+    selection_.cancel();
     list_.reset();
     if (container_) {
         lv_obj_delete(container_);
@@ -62,36 +71,35 @@ FLASHMEM MenuListView::~MenuListView() {
 }
 
 FLASHMEM bool MenuListView::copyTextIfChanged(TextCache& cache, const char* text) {
-    const char* source = text ? text : "";
-    char next[TEXT_CACHE_SIZE] = {};
-    std::strncpy(next, source, TEXT_CACHE_SIZE - 1);
-    next[TEXT_CACHE_SIZE - 1] = '\0';
-
-    if (std::strncmp(cache.text, next, TEXT_CACHE_SIZE) == 0) return false;
-
-    std::strncpy(cache.text, next, TEXT_CACHE_SIZE - 1);
-    cache.text[TEXT_CACHE_SIZE - 1] = '\0';
-    return true;
+    return cache.assign(text_arena_, text);
 }
 
-FLASHMEM void MenuListView::setLabelTextIfChanged(
+FLASHMEM bool MenuListView::setLabelTextIfChanged(
     lv_obj_t* label,
-    TextCache& cache,
+    TextStamp& cache,
     const char* text
 ) {
-    if (!label) return;
-    if (!copyTextIfChanged(cache, text)) return;
-    lv_label_set_text(label, cache.text);
+    if (!label) return false;
+    if (!cache.update(text)) return false;
+    lv_label_set_text(label, text ? text : "");
+    MS_UI_PERF_COUNT(MenuList, LabelTextSets, 1U);
+    return true;
 }
 
-FLASHMEM void MenuListView::setLabelTextIfChanged(
-    oc::ui::lvgl::Label* label,
-    TextCache& cache,
-    const char* text
-) {
-    if (!label) return;
-    if (!copyTextIfChanged(cache, text)) return;
-    label->setText(cache.text);
+FLASHMEM void MenuListView::commitSelection(void* context, int index) {
+    auto* self = static_cast<MenuListView*>(context);
+    if (self && self->list_) self->list_->setSelectedIndex(index);
+}
+
+FLASHMEM void MenuListView::onOcclusion(void* context, bool occluded) {
+    auto* self = static_cast<MenuListView*>(context);
+    if (!self) return;
+    self->occluded_ = occluded;
+    if (occluded) {
+        self->marquee_.pause();
+    } else if (self->container_ && !lv_obj_has_flag(self->container_, LV_OBJ_FLAG_HIDDEN)) {
+        self->marquee_.resume();
+    }
 }
 
 FLASHMEM void MenuListView::createUi(lv_obj_t* parent) {
@@ -130,18 +138,21 @@ FLASHMEM void MenuListView::createUi(lv_obj_t* parent) {
 
     title_ = lv_label_create(header_);
     lv_label_set_text(title_, "");
-    lv_obj_set_style_text_font(title_, fonts.inter_14_bold, 0);
+    lv_obj_set_style_text_font(title_, coreFontOrDefault(fonts.inter_14_bold), 0);
     lv_obj_set_style_text_color(title_, lv_color_hex(base_theme::color::TEXT_PRIMARY), 0);
     lv_label_set_long_mode(title_, LV_LABEL_LONG_CLIP);
     lv_obj_set_width(title_, 132);
+    enableLabelBitmapMode(title_);
 
     meta_ = lv_label_create(header_);
     lv_label_set_text(meta_, "");
     lv_obj_set_flex_grow(meta_, 1);
-    lv_obj_set_style_text_font(meta_, fonts.inter_12_medium, 0);
+    lv_obj_set_style_text_font(meta_, coreFontOrDefault(fonts.inter_12_medium), 0);
     lv_obj_set_style_text_color(meta_, lv_color_hex(base_theme::color::TEXT_SECONDARY), 0);
     lv_obj_set_style_text_opa(meta_, LV_OPA_80, 0);
     lv_label_set_long_mode(meta_, LV_LABEL_LONG_DOT);
+    enableLabelBitmapMode(meta_);
+    MS_UI_PERF_OBJECTS(MenuList, container_);
 
     list_ = std::make_unique<widget::VirtualList>(container_);
     list_->visibleCount(VISIBLE_SLOTS)
@@ -156,10 +167,13 @@ FLASHMEM void MenuListView::createUi(lv_obj_t* parent) {
         .onUpdateHighlight([this](widget::VirtualSlot& slot, bool isSelected) {
             updateSlotHighlight(slot, isSelected);
         });
-    list_->prepare();
-    const auto& slots = list_->getSlots();
-    for (int i = 0; i < VISIBLE_SLOTS && i < static_cast<int>(slots.size()); ++i) {
-        ensureSlotWidgets(slots[static_cast<std::size_t>(i)].container, i);
+    // Lazy policies leave row widgets to the first bind.
+    if (slotMemoryPolicy() == SlotMemoryPolicy::Eager) {
+        list_->prepare();
+        const auto& slots = list_->getSlots();
+        for (int i = 0; i < VISIBLE_SLOTS && i < static_cast<int>(slots.size()); ++i) {
+            ensureSlotWidgets(slots[static_cast<std::size_t>(i)].container, static_cast<std::size_t>(i));
+        }
     }
     list_->show();
 }
@@ -168,23 +182,45 @@ FLASHMEM void MenuListView::show() {
     if (container_) {
         lv_obj_clear_flag(container_, LV_OBJ_FLAG_HIDDEN);
     }
+    if (rows_released_ && list_) {
+        // Slots still believe they are bound; rebuild rows on this pass.
+        rows_released_ = false;
+        list_->show();
+        list_->invalidate();
+    }
+    if (!occluded_) marquee_.resume();
 }
 
 FLASHMEM void MenuListView::hide() {
+    selection_.cancel();
+    marquee_.pause();
     if (container_) {
         lv_obj_add_flag(container_, LV_OBJ_FLAG_HIDDEN);
     }
+    if (slotMemoryPolicy() == SlotMemoryPolicy::LazyReclaim) releaseRows();
+}
+
+FLASHMEM void MenuListView::releaseRows() {
+    // Deleting a value label also frees its marquee lane.
+    const bool released = reclaimSlotRows(slot_widgets_);
+    slot_ring_.reset();
+    if (!released) return;
+    // Keep hidden renders from rebuilding rows until show().
+    if (list_) list_->hide();
+    rows_released_ = true;
 }
 
 FLASHMEM void MenuListView::syncRows(
     const MenuListViewProps& props,
     std::array<int, MAX_ROWS>& dirtyIndices,
-    int& dirtyCount
+    int& dirtyCount,
+    bool retained
 ) {
     dirtyCount = 0;
     const int nextCount = std::clamp(props.rowCount, 0, MAX_ROWS);
+    // A retained tree level already holds its rows unless its revision moved.
     const bool canSkipRowDiff =
-        props.dataRevision != 0 &&
+        (props.dataRevision != 0 || retained) &&
         props.dataRevision == last_data_revision_ &&
         nextCount == last_row_count_;
 
@@ -242,6 +278,14 @@ FLASHMEM void MenuListView::invalidateDirtyRows(
 
 FLASHMEM void MenuListView::render(const MenuListViewProps& props) {
     if (!container_) return;
+    MS_UI_PERF_COUNT(MenuList, Renders, 1U);
+    if (tree_) {
+        // Back to flat mode in the depth 0 cache, whatever the tree left there.
+        tree_ = nullptr;
+        activateLevelCache(0);
+        last_row_count_ = -1;
+        slot_ring_.reset();
+    }
 
     applyHeaderLayout(props.headerLayout);
     setLabelTextIfChanged(title_, title_cache_, props.title);
@@ -249,15 +293,240 @@ FLASHMEM void MenuListView::render(const MenuListViewProps& props) {
 
     std::array<int, MAX_ROWS> dirtyIndices{};
     int dirtyCount = 0;
-    syncRows(props, dirtyIndices, dirtyCount);
+    bool providerChanged = false;
+    if (props.rowProvider) {
+        providerChanged = syncProviderRows(props, dirtyIndices, dirtyCount);
+    } else {
+        providerChanged = row_provider_ != nullptr;
+        leaveProviderMode();
+        syncRows(props, dirtyIndices, dirtyCount);
+    }
+    if (providerChanged) {
+        slot_ring_.reset();
+    } else {
+        slot_ring_.trim(row_count_);
+        for (int i = 0; i < dirtyCount; ++i) {
+            slot_ring_.invalidate(dirtyIndices[static_cast<std::size_t>(i)]);
+        }
+    }
 
     if (list_) {
         const bool countChanged = list_->setTotalCount(row_count_);
-        list_->setSelectedIndex(props.selectedIndex);
-        if (!countChanged && list_->isVisible()) {
-            invalidateDirtyRows(dirtyIndices, dirtyCount);
+        const bool shown = list_->isVisible() &&
+            !lv_obj_has_flag(container_, LV_OBJ_FLAG_HIDDEN);
+        if (!countChanged && !providerChanged && dirtyCount == 0 && shown) {
+            // Pure selection move: the window moves once per frame.
+            selection_.request(props.selectedIndex);
+        } else {
+            selection_.cancel();
+            list_->setSelectedIndex(props.selectedIndex);
+            if (!countChanged && list_->isVisible()) {
+                if (providerChanged) {
+                    list_->invalidate();
+                } else {
+                    invalidateDirtyRows(dirtyIndices, dirtyCount);
+                }
+            }
+        }
+    }
+}
+
+FLASHMEM bool MenuListView::syncProviderRows(
+    const MenuListViewProps& props,
+    std::array<int, MAX_ROWS>& dirtyIndices,
+    int& dirtyCount
+) {
+    dirtyCount = 0;
+    const int nextCount = std::clamp(props.rowCount, 0, MAX_PROVIDER_ROWS);
+    const bool providerChanged = row_provider_ != props.rowProvider ||
+        row_provider_context_ != props.rowProviderContext ||
+        row_count_ != nextCount;
+    row_provider_ = props.rowProvider;
+    row_revision_ = props.rowRevision;
+    row_provider_context_ = props.rowProviderContext;
+    row_count_ = nextCount;
+
+    const bool revisionChanged = props.dataRevision == 0U ||
+        props.dataRevision != last_data_revision_;
+    last_data_revision_ = props.dataRevision;
+    if (providerChanged) {
+        for (auto& cached : provider_rows_) cached.index = -1;
+        return true;
+    }
+    if (!revisionChanged) return false;
+
+    // Only docked rows exist; refetch those whose own revision moved.
+    for (auto& cached : provider_rows_) {
+        if (cached.index < 0) continue;
+        if (cached.index >= row_count_) {
+            cached.index = -1;
+            continue;
         }
+        const bool rowChanged = row_revision_ == nullptr || cached.revision == 0U ||
+            row_revision_(row_provider_context_, cached.index) != cached.revision;
+        if (!rowChanged) continue;
+        if (dirtyCount < MAX_ROWS) dirtyIndices[static_cast<std::size_t>(dirtyCount++)] = cached.index;
+        cached.index = -1;
+    }
+    return false;
+}
+
+FLASHMEM void MenuListView::leaveProviderMode() {
+    if (!row_provider_) return;
+    row_provider_ = nullptr;
+    row_revision_ = nullptr;
+    row_provider_context_ = nullptr;
+    for (auto& cached : provider_rows_) {
+        copyTextIfChanged(cached.row.label, "");
+        copyTextIfChanged(cached.row.value, "");
+        cached.index = -1;
+        cached.revision = 0;
     }
+    // Static rows are re-diffed from scratch.
+    row_count_ = std::min(row_count_, MAX_ROWS);
+    last_data_revision_ = 0;
+    last_row_count_ = -1;
+}
+
+FLASHMEM const MenuListView::RowCache& MenuListView::boundRow(int index) {
+    if (!row_provider_) return rows_[static_cast<std::size_t>(index)];
+
+    auto& cached = provider_rows_[slot_ring_.rowFor(index)];
+    if (cached.index == index) return cached.row;
+
+    OC_PERF_SCOPE(perfFetch, "ui.menu-list.fetch-row");
+    provider_buffer_ = MenuRowBuffer{};
+    row_provider_(row_provider_context_, index, provider_buffer_);
+    MS_UI_PERF_COUNT(MenuList, ProviderCalls, 1U);
+    provider_buffer_.label.back() = '\0';
+    provider_buffer_.value.back() = '\0';
+    copyTextIfChanged(cached.row.label, provider_buffer_.label.data());
+    copyTextIfChanged(cached.row.value, provider_buffer_.value.data());
+    cached.row.kind = provider_buffer_.kind;
+    cached.row.enabled = provider_buffer_.enabled;
+    cached.row.valueAutoScroll = provider_buffer_.valueAutoScroll;
+    cached.row.valueRole = provider_buffer_.valueRole;
+    cached.index = index;
+    cached.revision = provider_buffer_.revision;
+    return cached.row;
+}
+
+FLASHMEM void MenuListView::activateLevelCache(std::size_t slot) {
+    if (slot >= MENU_DEPTH || slot == active_level_cache_) return;
+    auto& previous = level_caches_[active_level_cache_];
+    previous.lastDataRevision = last_data_revision_;
+    previous.lastRowCount = last_row_count_;
+    previous.rowCount = row_count_;
+
+    const auto& next = level_caches_[slot];
+    rows_ = level_caches_[slot].rows.data();
+    last_data_revision_ = next.lastDataRevision;
+    last_row_count_ = next.lastRowCount;
+    row_count_ = next.rowCount;
+    active_level_cache_ = slot;
+}
+
+FLASHMEM void MenuListView::setTree(const MenuTree* tree) {
+    if (!tree || !tree->levels || tree->levelCount <= 0) {
+        tree_ = nullptr;
+        return;
+    }
+    leaveProviderMode();
+    tree_ = tree;
+    const int root = std::clamp(tree->rootLevel, 0, tree->levelCount - 1);
+    navigation_.reset(static_cast<int16_t>(root));
+    showTreeLevel(false);
+}
+
+FLASHMEM void MenuListView::refreshTree() {
+    showTreeLevel(true);
+}
+
+FLASHMEM bool MenuListView::enterSelected() {
+    if (!tree_) return false;
+    const auto& current = navigation_.current();
+    const MenuLevel& level = tree_->levels[current.level];
+    const int index = current.selectedIndex;
+    if (!level.rows || index < 0 || index >= std::min(level.rowCount, MAX_ROWS)) return false;
+
+    const MenuRow& row = level.rows[index];
+    if (row.kind != MenuRowKind::Folder || !row.enabled) return false;
+    if (row.childLevel < 0 || row.childLevel >= tree_->levelCount) return false;
+    if (!navigation_.enter(row.childLevel)) return false;
+    showTreeLevel(false);
+    return true;
+}
+
+FLASHMEM bool MenuListView::back() {
+    if (!tree_ || !navigation_.back()) return false;
+    showTreeLevel(false);
+    return true;
+}
+
+FLASHMEM void MenuListView::select(int index) {
+    if (!tree_ || row_count_ <= 0) return;
+    index = std::clamp(index, 0, row_count_ - 1);
+    navigation_.current().selectedIndex = static_cast<int16_t>(index);
+    if (!list_) return;
+    const bool shown = list_->isVisible() && !lv_obj_has_flag(container_, LV_OBJ_FLAG_HIDDEN);
+    if (shown) {
+        selection_.request(index);
+    } else {
+        selection_.cancel();
+        list_->setSelectedIndex(index);
+    }
+}
+
+FLASHMEM int MenuListView::currentLevel() const {
+    return tree_ ? navigation_.current().level : -1;
+}
+
+FLASHMEM int MenuListView::selectedIndex() const {
+    return tree_ ? navigation_.current().selectedIndex : -1;
+}
+
+FLASHMEM std::size_t MenuListView::depth() const {
+    return tree_ ? navigation_.depth() : 0U;
+}
+
+FLASHMEM void MenuListView::showTreeLevel(bool refresh) {
+    if (!tree_ || !container_) return;
+    OC_PERF_SCOPE(perfLevel, "ui.menu.level");
+    MS_UI_PERF_COUNT(MenuList, Renders, 1U);
+
+    const auto& current = navigation_.current();
+    const MenuLevel& level = tree_->levels[current.level];
+    const bool retained = navigation_.cached() && !refresh;
+    activateLevelCache(navigation_.slot());
+    // Another level used this depth before, or refreshTree() after rows
+    // changed in place under the same dataRevision: diff every row.
+    if (!navigation_.cached() || refresh) last_row_count_ = -1;
+
+    MenuListViewProps props;
+    props.title = level.title;
+    props.meta = level.meta;
+    props.rows = level.rows;
+    props.rowCount = level.rowCount;
+    props.dataRevision = level.dataRevision;
+    props.selectedIndex = current.selectedIndex;
+    props.headerLayout = tree_->headerLayout;
+
+    applyHeaderLayout(props.headerLayout);
+    setLabelTextIfChanged(title_, title_cache_, props.title);
+    setLabelTextIfChanged(meta_, meta_cache_, props.meta);
+
+    std::array<int, MAX_ROWS> dirtyIndices{};
+    int dirtyCount = 0;
+    syncRows(props, dirtyIndices, dirtyCount, retained);
+    navigation_.markCached();
+
+    // Same indices now mean other rows: every visible slot rebinds once.
+    slot_ring_.reset();
+    selection_.cancel();
+    if (!list_) return;
+    list_->setTotalCount(row_count_);
+    list_->setSelectedIndex(std::clamp<int>(current.selectedIndex, 0, std::max(row_count_ - 1, 0)));
+    list_->invalidate();
 }
 
 FLASHMEM void MenuListView::applyHeaderLayout(MenuListHeaderLayout layout) {
@@ -294,35 +563,30 @@ FLASHMEM void MenuListView::bindSlot(widget::VirtualSlot& slot, int index, bool
     if (slotIndex < 0 || slotIndex >= VISIBLE_SLOTS) return;
     if (index < 0 || index >= row_count_) return;
 
-    ensureSlotWidgets(slot.container, slotIndex);
-    auto& widgets = slot_widgets_[static_cast<std::size_t>(slotIndex)];
-    const auto& row = rows_[static_cast<std::size_t>(index)];
+    // Rows still in the window after a shift only move to their new slot.
+    const bool rebind = slot_ring_.claim(index);
+    const std::size_t rowIndex = slot_ring_.rowFor(index);
+    ensureSlotWidgets(slot.container, rowIndex);
+    auto& widgets = slot_widgets_[rowIndex];
+    row_dock_.dock(widgets.row, slot.container);
+    const auto& row = boundRow(index);
+    if (!rebind && widgets.boundIndex == index) {
+        applyHighlightStyle(slot, widgets, isSelected, row);
+        return;
+    }
 
+    MS_UI_PERF_COUNT(MenuList, RowsBound, 1U);
     applyValueLayout(widgets, row.valueRole);
-    setLabelTextIfChanged(widgets.label, widgets.labelCache, row.label.text);
-    if (row.valueAutoScroll) {
-        ensureValueScroller(widgets, row.valueRole);
-        if (widgets.value) {
-            lv_obj_add_flag(widgets.value, LV_OBJ_FLAG_HIDDEN);
-        }
-        if (widgets.valueScroller) {
-            lv_obj_clear_flag(widgets.valueScroller->getElement(), LV_OBJ_FLAG_HIDDEN);
-        }
-        setLabelTextIfChanged(widgets.valueScroller.get(), widgets.valueScrollerCache, row.value.text);
-    } else {
-        if (widgets.valueScroller) {
-            if (widgets.valueScrollerActive) {
-                widgets.valueScroller->autoScroll(false);
-                widgets.valueScroller->setText("");
-                widgets.valueScrollerActive = false;
-                widgets.valueScrollerCache = {};
-            }
-            lv_obj_add_flag(widgets.valueScroller->getElement(), LV_OBJ_FLAG_HIDDEN);
-        }
-        if (widgets.value) {
-            lv_obj_clear_flag(widgets.value, LV_OBJ_FLAG_HIDDEN);
+    setLabelTextIfChanged(widgets.label, widgets.labelCache, rowText(row.label));
+    const bool valueChanged = setLabelTextIfChanged(widgets.value, widgets.valueCache, rowText(row.value));
+    if (widgets.valueScrolling && (valueChanged || !row.valueAutoScroll)) {
+        // New text restarts from the leading edge; plain rows stop.
+        if (row.valueAutoScroll) {
+            widgets.valueScrolling = marquee_.start(widgets.value);
+        } else {
+            marquee_.stop(widgets.value);
+            widgets.valueScrolling = false;
         }
-        setLabelTextIfChanged(widgets.value, widgets.valueCache, row.value.text);
     }
     applyRowStyle(widgets, row);
 
@@ -337,14 +601,21 @@ FLASHMEM void MenuListView::updateSlotHighlight(widget::VirtualSlot& slot, bool
     if (slotIndex < 0 || slotIndex >= VISIBLE_SLOTS) return;
     if (slot.boundIndex < 0 || slot.boundIndex >= row_count_) return;
 
-    auto& widgets = slot_widgets_[static_cast<std::size_t>(slotIndex)];
-    const auto& row = rows_[static_cast<std::size_t>(slot.boundIndex)];
+    const std::size_t rowIndex = slot_ring_.rowFor(slot.boundIndex);
+    auto& widgets = slot_widgets_[rowIndex];
+    if (widgets.boundIndex != slot.boundIndex) return;
+    if (row_provider_ && provider_rows_[rowIndex].index != slot.boundIndex) return;
+    const auto& row = boundRow(slot.boundIndex);
     applyHighlightStyle(slot, widgets, isSelected, row);
 }
 
-FLASHMEM void MenuListView::ensureSlotWidgets(lv_obj_t* row, int slotIndex) {
-    auto& widgets = slot_widgets_[static_cast<std::size_t>(slotIndex)];
-    if (widgets.created || !row) return;
+FLASHMEM void MenuListView::ensureSlotWidgets(lv_obj_t* container, std::size_t rowIndex) {
+    auto& widgets = slot_widgets_[rowIndex];
+    if (widgets.created || !container) return;
+
+    OC_PERF_SCOPE(perfBuild, "ui.menu-list.build-row");
+    lv_obj_t* row = row_dock_.createRow(list_.get(), container);
+    widgets.row = row;
 
     lv_obj_set_flex_flow(row, LV_FLEX_FLOW_ROW);
     lv_obj_set_flex_align(row, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
@@ -356,34 +627,32 @@ FLASHMEM void MenuListView::ensureSlotWidgets(lv_obj_t* row, int slotIndex) {
     lv_label_set_text(widgets.label, "");
     lv_obj_set_flex_grow(widgets.label, 1);
     lv_label_set_long_mode(widgets.label, LV_LABEL_LONG_DOT);
-    lv_obj_set_style_text_font(widgets.label, fonts.list_item_label, 0);
+    lv_obj_set_style_text_font(widgets.label, coreFontOrDefault(fonts.list_item_label), 0);
 
     widgets.value = lv_label_create(row);
     lv_label_set_text(widgets.value, "");
     lv_obj_set_width(widgets.value, VALUE_COL_W);
     lv_obj_set_style_text_align(widgets.value, LV_TEXT_ALIGN_RIGHT, 0);
     lv_label_set_long_mode(widgets.value, LV_LABEL_LONG_DOT);
-    lv_obj_set_style_text_font(widgets.value, fonts.inter_14_semibold, 0);
+    lv_obj_set_style_text_font(widgets.value, coreFontOrDefault(fonts.inter_14_semibold), 0);
 
     widgets.created = true;
+    noteSlotRowBuilt(row);
+    MS_UI_PERF_OBJECTS(MenuList, row);
 }
 
-FLASHMEM void MenuListView::ensureValueScroller(SlotWidgets& widgets, MenuRowValueRole role) {
-    if (widgets.valueScroller) {
-        applyValueLayout(widgets, role);
-        return;
-    }
-
-    lv_obj_t* parent = widgets.value ? lv_obj_get_parent(widgets.value) : nullptr;
-    if (!parent) return;
+FLASHMEM void MenuListView::onCoreFontsReady(void* context) {
+    static_cast<MenuListView*>(context)->applyFonts();
+}
 
-    widgets.valueScroller = std::make_unique<Label>(parent);
-    widgets.valueScroller->font(fonts.inter_14_semibold)
-        .autoScroll(false)
-        .ownsLvglObjects(false);
-    lv_obj_add_flag(widgets.valueScroller->getElement(), LV_OBJ_FLAG_HIDDEN);
-    widgets.valueLayoutApplied = false;
-    applyValueLayout(widgets, role);
+FLASHMEM void MenuListView::applyFonts() {
+    if (title_) lv_obj_set_style_text_font(title_, coreFontOrDefault(fonts.inter_14_bold), 0);
+    if (meta_) lv_obj_set_style_text_font(meta_, coreFontOrDefault(fonts.inter_12_medium), 0);
+    for (auto& widgets : slot_widgets_) {
+        if (!widgets.created) continue;
+        lv_obj_set_style_text_font(widgets.label, coreFontOrDefault(fonts.list_item_label), 0);
+        lv_obj_set_style_text_font(widgets.value, coreFontOrDefault(fonts.inter_14_semibold), 0);
+    }
 }
 
 FLASHMEM void MenuListView::applyValueLayout(SlotWidgets& widgets, MenuRowValueRole role) {
@@ -407,11 +676,6 @@ FLASHMEM void MenuListView::applyValueLayout(SlotWidgets& widgets, MenuRowValueR
             0
         );
     }
-    if (widgets.valueScroller) {
-        widgets.valueScroller->width(description ? DESCRIPTION_VALUE_COL_W : VALUE_COL_W)
-            .alignment(description ? LV_TEXT_ALIGN_LEFT : LV_TEXT_ALIGN_RIGHT);
-    }
-
     widgets.valueRole = role;
     widgets.valueLayoutApplied = true;
 }
@@ -426,17 +690,20 @@ FLASHMEM void MenuListView::applyHighlightStyle(
     const bool shouldScroll = row.valueAutoScroll && isSelected;
     if (widgets.highlightStyleApplied &&
         widgets.highlighted == isSelected &&
-        widgets.valueScrollerActive == shouldScroll) {
+        widgets.valueScrolling == shouldScroll) {
         return;
     }
 
     widgets.highlighted = isSelected;
     widgets.highlightStyleApplied = true;
 
-    if (widgets.valueScroller && widgets.valueScrollerActive != shouldScroll) {
-        widgets.valueScroller->autoScroll(shouldScroll);
-        widgets.valueScroller->setText(widgets.valueScrollerCache.text);
-        widgets.valueScrollerActive = shouldScroll;
+    if (widgets.value && widgets.valueScrolling != shouldScroll) {
+        if (shouldScroll) {
+            widgets.valueScrolling = marquee_.start(widgets.value);
+        } else {
+            marquee_.stop(widgets.value);
+            widgets.valueScrolling = false;
+        }
     }
 }
 
@@ -462,9 +729,6 @@ FLASHMEM void MenuListView::applyRowStyle(SlotWidgets& widgets, const RowCache&
         if (widgets.value) {
             lv_obj_set_style_text_color(widgets.value, lv_color_hex(valueColor), 0);
         }
-        if (widgets.valueScroller) {
-            lv_obj_set_style_text_color(widgets.valueScroller->getLabel(), lv_color_hex(valueColor), 0);
-        }
         widgets.valueColor = valueColor;
     }
     if (!widgets.rowStyleApplied || widgets.labelOpa != labelOpa) {
@@ -477,9 +741,6 @@ FLASHMEM void MenuListView::applyRowStyle(SlotWidgets& widgets, const RowCache&
         if (widgets.value) {
             lv_obj_set_style_text_opa(widgets.value, valueOpa, 0);
         }
-        if (widgets.valueScroller) {
-            lv_obj_set_style_text_opa(widgets.valueScroller->getLabel(), valueOpa, 0);
-        }
         widgets.valueOpa = valueOpa;
     }
     widgets.rowStyleApplied = true;
@@ -12,9 +12,21 @@
 
 #include <lvgl.h>
 
-#include <oc/ui/lvgl/widget/Label.hpp>
 #include <oc/ui/lvgl/widget/VirtualList.hpp>
 
+#include <ms/ui/text/TextCache.hpp>
+#include <ms/ui/widget/CoalescedSelection.hpp>
+#include <ms/ui/widget/MarqueeEngine.hpp>
+#include <ms/ui/widget/MenuNavigation.hpp>
+#include <ms/ui/widget/SlotMemoryPolicy.hpp>
+#include <ms/ui/widget/SlotRowDock.hpp>
+#include <ms/ui/widget/VirtualSlotRing.hpp>
+
+// Tree levels retained at once (root included).
+#ifndef MS_UI_MENU_DEPTH
+#define MS_UI_MENU_DEPTH 4
+#endif
+
 namespace ms::ui {
 
 enum class MenuRowKind : uint8_t {
@@ -42,18 +54,66 @@ struct MenuRow {
     bool enabled = true;
     bool valueAutoScroll = false;
     MenuRowValueRole valueRole = MenuRowValueRole::Value;
+    // Folder rows of a MenuTree: level opened by enterSelected().
+    int16_t childLevel = -1;
+};
+
+static constexpr std::size_t MENU_ROW_TEXT_CAPACITY = 48;
+
+/**
+ * Scratch a MenuRowProvider fills for one row entering the visible window,
+ * so long lists (preset browsers, parameter pages) never hold more than
+ * the five visible rows.
+ */
+struct MenuRowBuffer {
+    std::array<char, MENU_ROW_TEXT_CAPACITY> label{};
+    std::array<char, MENU_ROW_TEXT_CAPACITY> value{};
+    MenuRowKind kind = MenuRowKind::Value;
+    bool enabled = true;
+    bool valueAutoScroll = false;
+    MenuRowValueRole valueRole = MenuRowValueRole::Value;
+    // Bump when this row's content changes; 0 = unknown (refetched on every change).
+    uint32_t revision = 0;
 };
 
+using MenuRowProvider = void (*)(void* context, int index, MenuRowBuffer& out);
+
+/** Current MenuRowBuffer::revision of a row, without filling its text. */
+using MenuRowRevision = uint32_t (*)(void* context, int index);
+
 struct MenuListViewProps {
     const char* title = "";
     const char* meta = "";
     const MenuRow* rows = nullptr;
+    // Virtual rows (rowCount up to 4096); rows is ignored when set.
+    MenuRowProvider rowProvider = nullptr;
+    // Optional: lets a dataRevision bump rebind only the visible rows that moved.
+    MenuRowRevision rowRevision = nullptr;
+    void* rowProviderContext = nullptr;
     int rowCount = 0;
     int selectedIndex = 0;
     uint32_t dataRevision = 0;
     MenuListHeaderLayout headerLayout = MenuListHeaderLayout::Horizontal;
 };
 
+/** One screen of a MenuTree. */
+struct MenuLevel {
+    const char* title = "";
+    const char* meta = "";
+    const MenuRow* rows = nullptr;
+    int rowCount = 0;
+    // Bump when rows change; a retained level is only re-diffed when it moved.
+    uint32_t dataRevision = 0;
+};
+
+/** Retained menu hierarchy; levels link to each other via MenuRow::childLevel. */
+struct MenuTree {
+    const MenuLevel* levels = nullptr;
+    int levelCount = 0;
+    int rootLevel = 0;
+    MenuListHeaderLayout headerLayout = MenuListHeaderLayout::Horizontal;
+};
+
 class MenuListView {
 public:
     explicit MenuListView(lv_obj_t* parent);
@@ -62,7 +122,30 @@ public:
     MenuListView(const MenuListView&) = delete;
     MenuListView& operator=(const MenuListView&) = delete;
 
+    /** Flat mode: the owner supplies every level itself. Leaves tree mode. */
     void render(const MenuListViewProps& props);
+
+    /**
+     * Tree mode: the view navigates tree itself, which must outlive it (or
+     * the next setTree()/render()). Each depth keeps its own row cache and
+     * selection, so back() swaps the parent back in without copying or
+     * diffing a single row. nullptr leaves tree mode.
+     */
+    void setTree(const MenuTree* tree);
+    /**
+     * Re-diff the current level after its rows changed in place, whether or
+     * not its dataRevision was bumped. Only rows that differ are rebound.
+     */
+    void refreshTree();
+    /** Open the selected Folder row's childLevel; false when it has none. */
+    bool enterSelected();
+    bool back();
+    void select(int index);
+
+    [[nodiscard]] int currentLevel() const;
+    [[nodiscard]] int selectedIndex() const;
+    [[nodiscard]] std::size_t depth() const;
+
     void show();
     void hide();
 
@@ -71,11 +154,13 @@ public:
 private:
     static constexpr int VISIBLE_SLOTS = 5;
     static constexpr int MAX_ROWS = 16;
-    static constexpr std::size_t TEXT_CACHE_SIZE = 48;
-
-    struct TextCache {
-        char text[TEXT_CACHE_SIZE] = {};
-    };
+    static constexpr int MAX_PROVIDER_ROWS = 4096;
+    static constexpr std::size_t MENU_DEPTH = MS_UI_MENU_DEPTH;
+    // Interned row text: label and value per row of every retained level,
+    // plus the provider rows currently docked in the window. 16 bytes each
+    // on average, 8 guaranteed, long text cut when the slack runs out
+    // (~3.9 KB with the entry table at the default depth of 4).
+    static constexpr std::size_t TEXT_ARENA_ENTRIES = (MAX_ROWS * MENU_DEPTH + VISIBLE_SLOTS) * 2;
 
     struct RowCache {
         TextCache label;
@@ -86,32 +171,47 @@ private:
         MenuRowValueRole valueRole = MenuRowValueRole::Value;
     };
 
+    // Rows and diff state of one navigation depth (flat mode uses depth 0).
+    struct LevelCache {
+        std::array<RowCache, MAX_ROWS> rows{};
+        uint32_t lastDataRevision = 0;
+        int lastRowCount = 0;
+        int rowCount = 0;
+    };
+
+    // Provider row shown by one slot row, keyed like slot_widgets_.
+    struct ProviderRow {
+        RowCache row;
+        int index = -1;
+        uint32_t revision = 0;
+    };
+
     struct SlotWidgets {
         bool created = false;
+        lv_obj_t* row = nullptr;
         lv_obj_t* label = nullptr;
         lv_obj_t* value = nullptr;
-        std::unique_ptr<oc::ui::lvgl::Label> valueScroller;
         bool highlighted = false;
         bool highlightStyleApplied = false;
         bool rowStyleApplied = false;
         bool valueLayoutApplied = false;
-        bool valueScrollerActive = false;
+        // value is driven by marquee_ (selected valueAutoScroll row).
+        bool valueScrolling = false;
         MenuRowValueRole valueRole = MenuRowValueRole::Value;
         uint32_t labelColor = 0;
         uint32_t valueColor = 0;
         lv_opa_t labelOpa = LV_OPA_TRANSP;
         lv_opa_t valueOpa = LV_OPA_TRANSP;
         int boundIndex = -1;
-        TextCache labelCache;
-        TextCache valueCache;
-        TextCache valueScrollerCache;
+        TextStamp labelCache;
+        TextStamp valueCache;
     };
 
     void createUi(lv_obj_t* parent);
     void bindSlot(oc::ui::lvgl::widget::VirtualSlot& slot, int index, bool isSelected);
     void updateSlotHighlight(oc::ui::lvgl::widget::VirtualSlot& slot, bool isSelected);
-    void ensureSlotWidgets(lv_obj_t* container, int slotIndex);
-    void ensureValueScroller(SlotWidgets& widgets, MenuRowValueRole role);
+    void ensureSlotWidgets(lv_obj_t* container, std::size_t rowIndex);
+    void releaseRows();
     void applyHighlightStyle(oc::ui::lvgl::widget::VirtualSlot& slot,
                              SlotWidgets& widgets,
                              bool isSelected,
@@ -121,28 +221,61 @@ private:
     void applyRowStyle(SlotWidgets& widgets, const RowCache& row);
     void syncRows(const MenuListViewProps& props,
                   std::array<int, MAX_ROWS>& dirtyIndices,
-                  int& dirtyCount);
+                  int& dirtyCount,
+                  bool retained = false);
+    bool syncProviderRows(const MenuListViewProps& props,
+                          std::array<int, MAX_ROWS>& dirtyIndices,
+                          int& dirtyCount);
+    void leaveProviderMode();
+    const RowCache& boundRow(int index);
+    void activateLevelCache(std::size_t slot);
+    void showTreeLevel(bool refresh);
     void invalidateDirtyRows(const std::array<int, MAX_ROWS>& dirtyIndices, int dirtyCount);
-    static bool copyTextIfChanged(TextCache& cache, const char* text);
-    static void setLabelTextIfChanged(lv_obj_t* label, TextCache& cache, const char* text);
-    static void setLabelTextIfChanged(oc::ui::lvgl::Label* label, TextCache& cache, const char* text);
+    bool copyTextIfChanged(TextCache& cache, const char* text);
+    const char* rowText(const TextCache& cache) const { return cache.c_str(text_arena_); }
+    static bool setLabelTextIfChanged(lv_obj_t* label, TextStamp& cache, const char* text);
+    static void commitSelection(void* context, int index);
+    static void onOcclusion(void* context, bool occluded);
+    // Header and row fonts may still be loading at construction: re-applied
+    // once every core font is in.
+    void applyFonts();
+    static void onCoreFontsReady(void* context);
 
     lv_obj_t* container_ = nullptr;
     lv_obj_t* header_ = nullptr;
     lv_obj_t* title_ = nullptr;
     lv_obj_t* meta_ = nullptr;
     std::unique_ptr<oc::ui::lvgl::widget::VirtualList> list_;
+    CoalescedSelection selection_{commitSelection, this};
+    // One timer for every auto-scrolling value; frozen while hidden or covered.
+    MarqueeEngine marquee_{};
 
+    // Row content is keyed by index % VISIBLE_SLOTS, not by slot position.
     std::array<SlotWidgets, VISIBLE_SLOTS> slot_widgets_{};
-    std::array<RowCache, MAX_ROWS> rows_{};
-    TextCache title_cache_{};
-    TextCache meta_cache_{};
+    VirtualSlotRing<VISIBLE_SLOTS> slot_ring_{};
+    SlotRowDock row_dock_{PerfWidget::MenuList};
+    TextCacheArena<TEXT_ARENA_ENTRIES> text_arena_{};
+    std::array<LevelCache, MENU_DEPTH> level_caches_{};
+    // Rows of the active level cache; swapped, never copied, on navigation.
+    RowCache* rows_ = level_caches_[0].rows.data();
+    std::size_t active_level_cache_ = 0;
+    const MenuTree* tree_ = nullptr;
+    std::array<ProviderRow, VISIBLE_SLOTS> provider_rows_{};
+    MenuRowBuffer provider_buffer_{};
+    MenuRowProvider row_provider_ = nullptr;
+    MenuRowRevision row_revision_ = nullptr;
+    void* row_provider_context_ = nullptr;
+    MenuNavigation<MENU_DEPTH> navigation_{};
+    TextStamp title_cache_{};
+    TextStamp meta_cache_{};
 
     uint32_t last_data_revision_ = 0;
     int last_row_count_ = 0;
     int row_count_ = 0;
     MenuListHeaderLayout header_layout_ = MenuListHeaderLayout::Horizontal;
     bool header_layout_applied_ = false;
+    bool rows_released_ = false;
+    bool occluded_ = false;
 };
 
 }  // namespace ms::ui
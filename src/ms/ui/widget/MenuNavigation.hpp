@@ -0,0 +1,76 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace ms::ui {
+
+/**
+ * Path through a retained menu tree plus the per-depth cache bookkeeping.
+ *
+ * Depth d of the path always uses cache slot d. Entering a level marks its
+ * slot cached once the owner filled it (markCached()); backing out leaves
+ * every slot alone, so the parent's rows and selection are still there and
+ * re-entering the same folder finds its slot cached as well. Fixed depth,
+ * no allocation.
+ */
+template <std::size_t Depth>
+class MenuNavigation {
+public:
+    static_assert(Depth > 0U && Depth < 0x7FFFU, "Depth must fit the slot index");
+
+    static constexpr int16_t NO_LEVEL = -1;
+
+    struct Level {
+        int16_t level = NO_LEVEL;
+        int16_t selectedIndex = 0;
+    };
+
+    static constexpr std::size_t capacity() { return Depth; }
+
+    /** Start over at root with every cached slot forgotten. */
+    void reset(int16_t root) {
+        path_.fill(Level{});
+        cachedLevel_.fill(NO_LEVEL);
+        path_[0].level = root;
+        depth_ = 1U;
+    }
+
+    /** Push level with selection at the top; false when the path is full. */
+    bool enter(int16_t level) {
+        if (depth_ >= Depth) return false;
+        path_[depth_] = Level{level, 0};
+        ++depth_;
+        return true;
+    }
+
+    /** Pop back to the parent; false at the root. */
+    bool back() {
+        if (depth_ <= 1U) return false;
+        --depth_;
+        return true;
+    }
+
+    [[nodiscard]] std::size_t depth() const { return depth_; }
+    [[nodiscard]] std::size_t slot() const { return depth_ - 1U; }
+    [[nodiscard]] Level& current() { return path_[depth_ - 1U]; }
+    [[nodiscard]] const Level& current() const { return path_[depth_ - 1U]; }
+
+    /** The current slot still holds the current level's rows. */
+    [[nodiscard]] bool cached() const {
+        return current().level != NO_LEVEL && cachedLevel_[slot()] == current().level;
+    }
+
+    void markCached() { cachedLevel_[slot()] = current().level; }
+
+    /** Drop every slot's claim (tree content replaced). */
+    void forgetCaches() { cachedLevel_.fill(NO_LEVEL); }
+
+private:
+    std::array<Level, Depth> path_{};
+    std::array<int16_t, Depth> cachedLevel_{};
+    std::size_t depth_ = 1U;
+};
+
+}  // namespace ms::ui
@@ -0,0 +1,58 @@
+#include "SlotMemoryPolicy.hpp"
+
+#include <config/PlatformCompat.hpp>
+
+namespace ms::ui {
+
+namespace {
+
+SlotMemoryPolicy g_policy = MS_UI_SLOT_MEMORY_POLICY;
+SlotPoolStats g_stats{};
+
+FLASHMEM uint32_t countObjects(lv_obj_t* obj) {
+    if (!obj) return 0U;
+    uint32_t count = 1U;
+    const uint32_t children = lv_obj_get_child_cnt(obj);
+    for (uint32_t i = 0; i < children; ++i) {
+        count += countObjects(lv_obj_get_child(obj, static_cast<int32_t>(i)));
+    }
+    return count;
+}
+
+}  // namespace
+
+FLASHMEM SlotMemoryPolicy slotMemoryPolicy() {
+    return g_policy;
+}
+
+FLASHMEM void setSlotMemoryPolicy(SlotMemoryPolicy policy) {
+    g_policy = policy;
+}
+
+FLASHMEM const SlotPoolStats& slotPoolStats() {
+    return g_stats;
+}
+
+FLASHMEM void noteSlotRowBuilt(lv_obj_t* row) {
+    if (!row) return;
+    noteSlotObjectsAdded(row);
+    ++g_stats.builtRows;
+}
+
+FLASHMEM void noteSlotObjectsAdded(lv_obj_t* subtree) {
+    if (!subtree) return;
+    g_stats.liveObjects += countObjects(subtree);
+    if (g_stats.liveObjects > g_stats.peakObjects) {
+        g_stats.peakObjects = g_stats.liveObjects;
+    }
+}
+
+FLASHMEM void reclaimSlotRow(lv_obj_t* row) {
+    if (!row) return;
+    const uint32_t objects = countObjects(row);
+    g_stats.liveObjects = objects > g_stats.liveObjects ? 0U : g_stats.liveObjects - objects;
+    ++g_stats.reclaimedRows;
+    lv_obj_delete(row);
+}
+
+}  // namespace ms::ui
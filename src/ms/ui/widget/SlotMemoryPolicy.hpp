@@ -0,0 +1,77 @@
+#pragma once
+
+/**
+ * @file SlotMemoryPolicy.hpp
+ * @brief When list overlays build and release their per-row LVGL widgets
+ */
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <lvgl.h>
+
+namespace ms::ui {
+
+/**
+ * Row widget lifetime for VirtualList-backed overlays.
+ *
+ * - Eager: build every row in the constructor (lowest first-show latency).
+ * - LazyRetain: build rows on first bind, keep them for the next show.
+ * - LazyReclaim: build rows on first bind, delete them when hidden.
+ *
+ * Only one overlay is visible at a time, so LazyReclaim keeps the row trees
+ * of a single overlay alive instead of every overlay created at boot, at the
+ * price of rebuilding them (up to 30 objects per overlay) on every show.
+ * The default stays Eager; firmware opts in per build or at runtime and can
+ * compare slotPoolStats() for its own screens before switching.
+ */
+enum class SlotMemoryPolicy : uint8_t {
+    Eager = 0,
+    LazyRetain,
+    LazyReclaim,
+};
+
+#ifndef MS_UI_SLOT_MEMORY_POLICY
+#define MS_UI_SLOT_MEMORY_POLICY ::ms::ui::SlotMemoryPolicy::Eager
+#endif
+
+/** Live row-widget bookkeeping shared by every list overlay. */
+struct SlotPoolStats {
+    uint32_t liveObjects = 0;
+    uint32_t peakObjects = 0;
+    uint32_t builtRows = 0;
+    uint32_t reclaimedRows = 0;
+};
+
+SlotMemoryPolicy slotMemoryPolicy();
+void setSlotMemoryPolicy(SlotMemoryPolicy policy);
+
+const SlotPoolStats& slotPoolStats();
+
+/** Record a freshly built row subtree (row object plus descendants). */
+void noteSlotRowBuilt(lv_obj_t* row);
+
+/** Record objects added to an existing row after it was built. */
+void noteSlotObjectsAdded(lv_obj_t* subtree);
+
+/** Delete a row subtree and record the release. Safe on nullptr. */
+void reclaimSlotRow(lv_obj_t* row);
+
+/**
+ * Reclaim every built row of a widget's slot array (elements carry
+ * `created` and `row`) and reset them. True when anything was released.
+ */
+template <typename SlotWidgets, std::size_t N>
+bool reclaimSlotRows(std::array<SlotWidgets, N>& slots) {
+    bool released = false;
+    for (auto& widgets : slots) {
+        if (!widgets.created) continue;
+        reclaimSlotRow(widgets.row);
+        widgets = SlotWidgets{};
+        released = true;
+    }
+    return released;
+}
+
+}  // namespace ms::ui
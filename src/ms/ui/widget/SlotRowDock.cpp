@@ -0,0 +1,60 @@
+#include "SlotRowDock.hpp"
+
+#include <config/PlatformCompat.hpp>
+#include <oc/diagnostics/Performance.hpp>
+#include <oc/ui/lvgl/style/StyleBuilder.hpp>
+
+#include <ms/ui/PerfCounters.hpp>
+
+namespace ms::ui {
+
+namespace style = oc::ui::lvgl::style;
+
+FLASHMEM lv_obj_t* SlotRowDock::createRow(
+    oc::ui::lvgl::widget::VirtualList* list,
+    lv_obj_t* container
+) {
+    if (!container) return nullptr;
+    if (!slots_prepared_ && list) {
+        for (const auto& slot : list->getSlots()) {
+            if (!slot.container) continue;
+            lv_obj_set_style_pad_left(slot.container, 0, LV_STATE_DEFAULT);
+            lv_obj_set_style_pad_right(slot.container, 0, LV_STATE_DEFAULT);
+        }
+        slots_prepared_ = true;
+    }
+
+    lv_obj_t* row = lv_obj_create(container);
+    style::apply(row)
+        .size(LV_PCT(100), LV_PCT(100))
+        .transparent()
+        .noBorder()
+        .pad(0)
+        .noScroll();
+    lv_obj_remove_flag(row, LV_OBJ_FLAG_CLICKABLE);
+    // Tags the body as ours, so dock() never hides what the list put there.
+    lv_obj_set_user_data(row, this);
+    return row;
+}
+
+void SlotRowDock::dock(lv_obj_t* row, lv_obj_t* container) {
+    if (!row || !container) return;
+    if (lv_obj_get_parent(row) != container) {
+        OC_PERF_SCOPE(perfDock, "ui.slot-row.dock");
+        const uint32_t children = lv_obj_get_child_cnt(container);
+        for (uint32_t i = 0; i < children; ++i) {
+            lv_obj_t* other = lv_obj_get_child(container, static_cast<int32_t>(i));
+            if (other != row && lv_obj_get_user_data(other) == this) {
+                lv_obj_add_flag(other, LV_OBJ_FLAG_HIDDEN);
+            }
+        }
+        lv_obj_set_parent(row, container);
+        OC_PERF_UNITS(perfDock, 1U, children);
+#if MS_UI_PERF_COUNTERS
+        perfCount(widget_, PerfCounter::RowsDocked, 1U);
+#endif
+    }
+    lv_obj_clear_flag(row, LV_OBJ_FLAG_HIDDEN);
+}
+
+}  // namespace ms::ui
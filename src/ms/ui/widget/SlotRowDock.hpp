@@ -0,0 +1,48 @@
+#pragma once
+
+/**
+ * @file SlotRowDock.hpp
+ * @brief Row bodies that move between VirtualList slots as a unit
+ */
+
+#include <lvgl.h>
+
+#include <oc/ui/lvgl/widget/VirtualList.hpp>
+
+#include <ms/ui/PerfCounterTable.hpp>
+
+namespace ms::ui {
+
+/**
+ * LVGL half of the VirtualSlotRing pattern.
+ *
+ * Each ring row is one transparent body that is re-parented into whichever
+ * slot shows its index, so a one-step window shift moves rows instead of
+ * re-applying their text. The move is not free (one extra object per slot,
+ * and lv_obj_set_parent() relayouts both slots): it is timed as
+ * ui.slot-row.dock and counted as RowsDocked next to RowsBound, so the two
+ * costs can be compared per widget.
+ */
+class SlotRowDock {
+public:
+    explicit SlotRowDock(PerfWidget widget) : widget_(widget) {}
+
+    /**
+     * Build a full-size row body in container. The first row also moves the
+     * slots' horizontal padding onto the row bodies.
+     */
+    lv_obj_t* createRow(oc::ui::lvgl::widget::VirtualList* list, lv_obj_t* container);
+
+    /**
+     * Show row in container. Whichever row the slot showed before is hidden;
+     * it either docks into its own new slot later in the pass or stays out
+     * of the window.
+     */
+    void dock(lv_obj_t* row, lv_obj_t* container);
+
+private:
+    PerfWidget widget_;
+    bool slots_prepared_ = false;
+};
+
+}  // namespace ms::ui
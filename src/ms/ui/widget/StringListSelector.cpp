@@ -4,6 +4,8 @@
 
 #include <config/PlatformCompat.hpp>
 
+#include <ms/ui/PerfCounters.hpp>
+
 namespace ms::ui {
 
 StringListSelector::StringListSelector(lv_obj_t* parent)
@@ -15,6 +17,7 @@ FLASHMEM void StringListSelector::invalidateItems() {
 }
 
 FLASHMEM void StringListSelector::render(const StringListSelectorProps& props) {
+    MS_UI_PERF_COUNT(StringListSelector, Renders, 1U);
     if (!props.visible) {
         hide();
         return;
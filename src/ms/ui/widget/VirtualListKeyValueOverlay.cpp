@@ -4,10 +4,15 @@
 #include <cstring>
 
 #include <config/PlatformCompat.hpp>
+#include <oc/diagnostics/Performance.hpp>
 #include <oc/ui/lvgl/style/StyleBuilder.hpp>
 #include <oc/ui/lvgl/theme/BaseTheme.hpp>
 
+#include <ms/ui/PerfCounters.hpp>
+#include <ms/ui/component/Occlusion.hpp>
 #include <ms/ui/font/CoreFonts.hpp>
+#include <ms/ui/widget/HighlightStyles.hpp>
+#include <ms/ui/widget/LabelBitmapMode.hpp>
 
 namespace ms::ui {
 
@@ -28,6 +33,9 @@ constexpr int COMPACT_ICON_COL_W = 14;
 constexpr int COMPACT_DETAIL_COL_W = 78;
 constexpr int COMPACT_SPARKLINE_W = 58;
 constexpr uint32_t SPARKLINE_MARKER_PERIOD_MS = 4U;
+// Prefetch runs between refreshes, not as a busy loop: a couple of rows
+// every 20 ms fills the look-ahead long before the next scroll step.
+constexpr uint32_t PREFETCH_PERIOD_MS = 20U;
 
 FLASHMEM bool sameMarker(
     const KeyValueSparklineMarker& lhs,
@@ -67,11 +75,9 @@ FLASHMEM void drawLine(
 }
 
 FLASHMEM lv_area_t markerDamageArea(
-    lv_obj_t* surface,
+    const lv_area_t& surfaceArea,
     const KeyValueSparklineMarker& marker
 ) {
-    lv_area_t surfaceArea{};
-    lv_obj_get_coords(surface, &surfaceArea);
     const int width = lv_area_get_width(&surfaceArea);
     const int height = lv_area_get_height(&surfaceArea);
     const int x = surfaceArea.x1 + keyValueSparklineCoordinate(
@@ -87,10 +93,45 @@ FLASHMEM lv_area_t markerDamageArea(
         static_cast<lv_coord_t>(y + 4),
     };
 }
+
+FLASHMEM const lv_font_t* keyFont() {
+    return coreFontOrDefault(fonts.list_item_label);
+}
+
+FLASHMEM const lv_font_t* detailFont() {
+    return fonts.inter_12_medium ? fonts.inter_12_medium : keyFont();
+}
+
+FLASHMEM const lv_font_t* valueFont() {
+    return fonts.inter_14_semibold ? fonts.inter_14_semibold : keyFont();
+}
+
+#if MS_UI_KV_DRAWN_ROWS
+/** Sparkline box of a drawn row: its span, SPARKLINE_H tall, centered. */
+FLASHMEM lv_area_t drawnSparklineArea(const lv_area_t& rowArea, const KeyValueRowSpan& span) {
+    const int y = rowArea.y1 + (lv_area_get_height(&rowArea) - SPARKLINE_H) / 2;
+    return {
+        static_cast<lv_coord_t>(rowArea.x1 + span.x),
+        static_cast<lv_coord_t>(y),
+        static_cast<lv_coord_t>(rowArea.x1 + span.x + span.width - 1),
+        static_cast<lv_coord_t>(y + SPARKLINE_H - 1),
+    };
+}
+
+FLASHMEM lv_area_t drawnColumnArea(const lv_area_t& rowArea, const KeyValueRowSpan& span) {
+    return {
+        static_cast<lv_coord_t>(rowArea.x1 + span.x),
+        rowArea.y1,
+        static_cast<lv_coord_t>(rowArea.x1 + span.x + span.width - 1),
+        rowArea.y2,
+    };
+}
+#endif
 }
 
 FLASHMEM VirtualListKeyValueOverlay::VirtualListKeyValueOverlay(lv_obj_t* parent)
-    : overlay_(parent) {
+    : overlay_(parent), selection_(commitSelection, this) {
+    MS_UI_PERF_CONSTRUCT(KeyValueOverlay);
     overlay_.configureList(VISIBLE_SLOTS, ITEM_HEIGHT);
 
     auto* list = overlay_.list();
@@ -103,34 +144,56 @@ FLASHMEM VirtualListKeyValueOverlay::VirtualListKeyValueOverlay(lv_obj_t* parent
                 updateSlotHighlight(slot, isSelected);
             });
 
-        // Build the fixed slot pool while this overlay is still parked.
-        list->prepare();
-        const auto& slots = list->getSlots();
-        for (int i = 0; i < VISIBLE_SLOTS && i < static_cast<int>(slots.size()); ++i) {
-            ensureSlotWidgets(slots[static_cast<size_t>(i)].container, i);
+        // Eager policy builds the fixed slot pool while this overlay is
+        // still parked; lazy policies leave it to the first bind.
+        if (slotMemoryPolicy() == SlotMemoryPolicy::Eager) {
+            list->prepare();
+            const auto& slots = list->getSlots();
+            for (int i = 0; i < VISIBLE_SLOTS && i < static_cast<int>(slots.size()); ++i) {
+                ensureSlotWidgets(slots[static_cast<size_t>(i)].container, static_cast<size_t>(i));
+            }
         }
     }
+    addOcclusionListener(overlay_.getElement(), onOcclusion, this);
+    whenCoreFontsReady(CORE_FONTS_COMPLETE, onCoreFontsReady, this);
 }
 
 FLASHMEM VirtualListKeyValueOverlay::~VirtualListKeyValueOverlay() {
+    cancelCoreFontsReady(this);
+    removeOcclusionListener(this);
     if (marker_timer_) {
         lv_timer_delete(marker_timer_);
         marker_timer_ = nullptr;
     }
+    if (prefetch_timer_) {
+        lv_timer_delete(prefetch_timer_);
+        prefetch_timer_ = nullptr;
+    }
     // Overlay owns LVGL objects; VirtualListOverlay handles deletion.
 }
 
-FLASHMEM bool VirtualListKeyValueOverlay::copyTextIfChanged(TextCache& cache, const char* text) {
-    const char* source = text ? text : "";
-    char next[TEXT_CACHE_SIZE] = {};
-    std::strncpy(next, source, TEXT_CACHE_SIZE - 1);
-    next[TEXT_CACHE_SIZE - 1] = '\0';
+FLASHMEM void VirtualListKeyValueOverlay::onCoreFontsReady(void* context) {
+    static_cast<VirtualListKeyValueOverlay*>(context)->applyFonts();
+}
 
-    if (std::strncmp(cache.text, next, TEXT_CACHE_SIZE) == 0) return false;
+FLASHMEM void VirtualListKeyValueOverlay::applyFonts() {
+    for (auto& widgets : slot_widgets_) {
+        if (!widgets.created) continue;
+        if (!widgets.keyLabel) {
+            if (widgets.row) lv_obj_invalidate(widgets.row);
+            continue;
+        }
+        lv_obj_set_style_text_font(widgets.keyLabel, keyFont(), LV_STATE_DEFAULT);
+        lv_obj_set_height(widgets.keyLabel, lv_font_get_line_height(keyFont()));
+        lv_obj_set_style_text_font(widgets.detailLabel, detailFont(), LV_STATE_DEFAULT);
+        lv_obj_set_height(widgets.detailLabel, lv_font_get_line_height(detailFont()));
+        lv_obj_set_style_text_font(widgets.valueLabel, valueFont(), LV_STATE_DEFAULT);
+        lv_obj_set_height(widgets.valueLabel, lv_font_get_line_height(valueFont()));
+    }
+}
 
-    std::strncpy(cache.text, next, TEXT_CACHE_SIZE - 1);
-    cache.text[TEXT_CACHE_SIZE - 1] = '\0';
-    return true;
+FLASHMEM bool VirtualListKeyValueOverlay::copyTextIfChanged(TextCache& cache, const char* text) {
+    return cache.assign(text_arena_, text);
 }
 
 FLASHMEM bool VirtualListKeyValueOverlay::copySparklineIfChanged(
@@ -155,13 +218,14 @@ FLASHMEM bool VirtualListKeyValueOverlay::copySparklineIfChanged(
 
 FLASHMEM void VirtualListKeyValueOverlay::setLabelTextIfChanged(
     lv_obj_t* label,
-    TextCache& cache,
+    TextStamp& cache,
     const char* text
 ) {
     if (!label) return;
-    if (!copyTextIfChanged(cache, text)) return;
+    if (!cache.update(text)) return;
 
-    lv_label_set_text(label, cache.text);
+    lv_label_set_text(label, text ? text : "");
+    MS_UI_PERF_COUNT(KeyValueOverlay, LabelTextSets, 1U);
 }
 
 FLASHMEM void VirtualListKeyValueOverlay::syncRows(
@@ -229,10 +293,14 @@ FLASHMEM void VirtualListKeyValueOverlay::invalidateDirtyRows(
 }
 
 FLASHMEM void VirtualListKeyValueOverlay::render(const VirtualListKeyValueOverlayProps& props) {
+    MS_UI_PERF_COUNT(KeyValueOverlay, Renders, 1U);
     if (!props.visible) {
         visible_ = false;
         if (marker_timer_) lv_timer_pause(marker_timer_);
+        if (prefetch_timer_) lv_timer_pause(prefetch_timer_);
+        selection_.cancel();
         overlay_.hide();
+        if (slotMemoryPolicy() == SlotMemoryPolicy::LazyReclaim) releaseRows();
         return;
     }
     visible_ = true;
@@ -264,6 +332,7 @@ FLASHMEM void VirtualListKeyValueOverlay::render(const VirtualListKeyValueOverla
             props.dataRevision == 0U ||
             last_data_revision_ != props.dataRevision ||
             row_count_ != nextCount;
+        if (providerChanged) prefetch_.reset();
         row_provider_ = props.rowProvider;
         row_provider_context_ = props.rowProviderContext;
         row_count_ = nextCount;
@@ -276,28 +345,61 @@ FLASHMEM void VirtualListKeyValueOverlay::render(const VirtualListKeyValueOverla
             last_data_revision_ = 0;
             last_row_count_ = -1;
             providerChanged = true;
+            prefetch_.reset();
         }
         syncRows(props, dirtyIndices, dirtyCount);
     }
 
+    if (props.selectedIndex != last_selected_index_) {
+        prefetch_direction_ = props.selectedIndex > last_selected_index_ ? 1 : -1;
+        last_selected_index_ = props.selectedIndex;
+    }
+
+    const bool restyled = dimStyleChanged || compactStyleChanged || providerChanged;
+    if (restyled) {
+        slot_ring_.reset();
+    } else {
+        slot_ring_.trim(row_count_);
+        for (int i = 0; i < dirtyCount; ++i) {
+            slot_ring_.invalidate(dirtyIndices[static_cast<size_t>(i)]);
+        }
+    }
+
     auto* list = overlay_.list();
     if (list) {
         const bool countChanged = list->setTotalCount(row_count_);
-        list->setSelectedIndex(props.selectedIndex);
-
-        if (!countChanged && overlay_.isVisible()) {
-            if (dimStyleChanged || compactStyleChanged || providerChanged) {
-                list->invalidate();
-            } else {
-                invalidateDirtyRows(dirtyIndices, dirtyCount);
+        if (!countChanged && !restyled && dirtyCount == 0 && overlay_.isVisible()) {
+            // Pure selection move: the window moves once per frame.
+            selection_.request(props.selectedIndex);
+        } else {
+            selection_.cancel();
+            list->setSelectedIndex(props.selectedIndex);
+            if (!countChanged && overlay_.isVisible()) {
+                if (restyled) {
+                    list->invalidate();
+                } else {
+                    invalidateDirtyRows(dirtyIndices, dirtyCount);
+                }
             }
         }
     }
 
     if (!overlay_.isVisible()) {
         overlay_.show();
+        if (rows_released_ && list) {
+            // Slots still believe they are bound; rebuild rows on this pass.
+            rows_released_ = false;
+            list->invalidate();
+        }
     }
     refreshSparklineMarkerTimer();
+    schedulePrefetch();
+}
+
+FLASHMEM void VirtualListKeyValueOverlay::releaseRows() {
+    if (reclaimSlotRows(slot_widgets_)) rows_released_ = true;
+    slot_ring_.reset();
+    refreshSparklineMarkerTimer();
 }
 
 FLASHMEM void VirtualListKeyValueOverlay::bindSlot(widget::VirtualSlot& slot, int index, bool isSelected) {
@@ -308,15 +410,46 @@ FLASHMEM void VirtualListKeyValueOverlay::bindSlot(widget::VirtualSlot& slot, in
     if (slotIndex < 0 || slotIndex >= VISIBLE_SLOTS) return;
     if (index < 0 || index >= row_count_) return;
 
-    ensureSlotWidgets(slot.container, slotIndex);
-    auto& widgets = slot_widgets_[static_cast<size_t>(slotIndex)];
+    // Rows still in the window after a shift only move to their new slot.
+    const bool rebind = slot_ring_.claim(index);
+    const size_t rowIndex = slot_ring_.rowFor(index);
+    ensureSlotWidgets(slot.container, rowIndex);
+    auto& widgets = slot_widgets_[rowIndex];
+    row_dock_.dock(widgets.row, slot.container);
+    if (!rebind && widgets.boundIndex == index) {
+        applyHighlightStyle(widgets, isSelected);
+        return;
+    }
+
+    // Units count provider calls made inside the frame: 0 when the row was
+    // already prepared by the idle prefetch ring.
+    OC_PERF_SCOPE(perfBind, "ui.kv-overlay.bind");
+    OC_PERF_UNITS(
+        perfBind,
+        row_provider_ != nullptr && !prefetch_.contains(index) ? 1U : 0U,
+        1U
+    );
+    MS_UI_PERF_COUNT(KeyValueOverlay, RowsBound, 1U);
+
     const auto& row = row_provider_ != nullptr
         ? materializeProviderRow(index)
         : rows_[static_cast<size_t>(index)];
 
+#if MS_UI_KV_DRAWN_ROWS
+    bindDrawnRow(widgets, row);
+#else
+    bindWidgetRow(widgets, row);
+#endif
+
+    widgets.boundIndex = index;
+    applyHighlightStyle(widgets, isSelected);
+}
+
+FLASHMEM void VirtualListKeyValueOverlay::bindWidgetRow(SlotWidgets& widgets, const RowCache& row) {
     if (widgets.iconLabel) {
-        const bool hasIcon = row.icon.text[0] != '\0' && row.iconFont != nullptr;
-        setLabelTextIfChanged(widgets.iconLabel, widgets.iconCache, hasIcon ? row.icon.text : "");
+        const char* icon = rowText(row.icon);
+        const bool hasIcon = icon[0] != '\0' && row.iconFont != nullptr;
+        setLabelTextIfChanged(widgets.iconLabel, widgets.iconCache, hasIcon ? icon : "");
         if (hasIcon && widgets.iconFont != row.iconFont) {
             lv_obj_set_style_text_font(widgets.iconLabel, row.iconFont, LV_STATE_DEFAULT);
             widgets.iconFont = row.iconFont;
@@ -335,45 +468,312 @@ FLASHMEM void VirtualListKeyValueOverlay::bindSlot(widget::VirtualSlot& slot, in
         setLabelTextIfChanged(
             widgets.keyLabel,
             widgets.keyCache,
-            row.key.text
+            rowText(row.key)
         );
     }
     if (widgets.valueLabel) {
-        setLabelTextIfChanged(widgets.valueLabel, widgets.valueCache, row.value.text);
+        setLabelTextIfChanged(widgets.valueLabel, widgets.valueCache, rowText(row.value));
     }
     if (widgets.detailLabel) {
-        setLabelTextIfChanged(widgets.detailLabel, widgets.detailCache, row.detail.text);
-        if (row.detail.text[0] != '\0') {
+        setLabelTextIfChanged(widgets.detailLabel, widgets.detailCache, rowText(row.detail));
+        if (rowText(row.detail)[0] != '\0') {
             lv_obj_clear_flag(widgets.detailLabel, LV_OBJ_FLAG_HIDDEN);
         } else {
             lv_obj_add_flag(widgets.detailLabel, LV_OBJ_FLAG_HIDDEN);
         }
     }
     applySparkline(widgets, row);
+}
 
-    widgets.boundIndex = index;
-    applyHighlightStyle(widgets, isSelected);
+#if MS_UI_KV_DRAWN_ROWS
+FLASHMEM void VirtualListKeyValueOverlay::bindDrawnRow(SlotWidgets& widgets, const RowCache& row) {
+    auto assign = [](DrawnColumn& column, const char* text) {
+        if (!column.text.assign(text)) return false;
+        column.fitSpan = -1;
+        return true;
+    };
+    const bool hadDetail = !widgets.drawnDetail.text.empty();
+    const bool hadSparkline = widgets.sparklineVisible;
+
+    KeyValueRowColumnMask changed = 0U;
+    const char* icon = rowText(row.icon);
+    const bool hasIcon = icon[0] != '\0' && row.iconFont != nullptr;
+    const lv_font_t* iconFont = hasIcon ? row.iconFont : nullptr;
+    const uint32_t iconColor = hasIcon ? row.iconColor : 0U;
+    if (assign(widgets.drawnIcon, hasIcon ? icon : "") || widgets.iconFont != iconFont ||
+        widgets.iconColor != iconColor) {
+        changed |= keyValueRowColumnBit(KeyValueRowColumn::Icon);
+    }
+    widgets.iconFont = iconFont;
+    widgets.iconColor = iconColor;
+    if (assign(widgets.drawnKey, rowText(row.key))) {
+        changed |= keyValueRowColumnBit(KeyValueRowColumn::Key);
+    }
+    if (assign(widgets.drawnDetail, rowText(row.detail))) {
+        changed |= keyValueRowColumnBit(KeyValueRowColumn::Detail);
+    }
+    if (assign(widgets.drawnValue, rowText(row.value))) {
+        changed |= keyValueRowColumnBit(KeyValueRowColumn::Value);
+    }
+    if (applySparkline(widgets, row)) {
+        changed |= keyValueRowColumnBit(KeyValueRowColumn::Sparkline);
+    }
+
+    const bool hasDetail = !widgets.drawnDetail.text.empty();
+    if (changed == 0U && hadDetail == hasDetail && hadSparkline == widgets.sparklineVisible) {
+        return;
+    }
+    lv_area_t rowArea{};
+    if (!prepareDrawnLayout(widgets, rowArea)) {
+        // Not laid out yet; its first layout pass draws it whole.
+        MS_UI_PERF_INVALIDATE(KeyValueOverlay, widgets.row);
+        return;
+    }
+    const auto& before = row_layout_.columns(hadDetail, hadSparkline);
+    const auto& after = row_layout_.columns(hasDetail, widgets.sparklineVisible);
+    const KeyValueRowColumnMask damage = keyValueRowDamage(before, after, changed);
+    for (std::size_t column = 0; column < KEY_VALUE_ROW_COLUMN_COUNT; ++column) {
+        if ((damage & (1U << column)) == 0U) continue;
+        for (const auto* columns : {&before, &after}) {
+            const auto& span = columns->spans[column];
+            if (!span.visible()) continue;
+            const lv_area_t area = drawnColumnArea(rowArea, span);
+            MS_UI_PERF_INVALIDATE_AREA(KeyValueOverlay, widgets.row, &area);
+        }
+    }
+}
+
+FLASHMEM bool VirtualListKeyValueOverlay::prepareDrawnLayout(
+    const SlotWidgets& widgets,
+    lv_area_t& rowArea
+) {
+    if (!widgets.row) return false;
+    lv_obj_get_coords(widgets.row, &rowArea);
+    const int width = lv_area_get_width(&rowArea);
+    if (width <= 0) return false;
+    row_layout_.configure(rowMetrics(), width);
+    return true;
+}
+
+FLASHMEM KeyValueRowMetrics VirtualListKeyValueOverlay::rowMetrics() const {
+    if (compact_facts_) {
+        return {COMPACT_PAD_H, COMPACT_COL_GAP, COMPACT_ICON_COL_W, COMPACT_DETAIL_COL_W, COMPACT_SPARKLINE_W};
+    }
+    return {PAD_H, COL_GAP, ICON_COL_W, COMPACT_DETAIL_COL_W, VALUE_COL_W};
+}
+
+FLASHMEM void VirtualListKeyValueOverlay::fitColumn(DrawnColumn& column, const lv_font_t* font, int width) {
+    if (column.fitFont == font && column.fitSpan == width) return;
+    const char* text = column.text.c_str();
+    const auto length = static_cast<uint32_t>(column.text.size());
+    column.fitFont = font;
+    column.fitSpan = static_cast<int16_t>(width);
+    column.fitBytes = static_cast<uint16_t>(length);
+    column.fitWidth = static_cast<int16_t>(lv_text_get_width(text, length, font, 0));
+    column.dotsWidth = 0;
+    column.dots = false;
+    if (column.fitWidth <= width) return;
+
+    // Same result as LV_LABEL_LONG_DOT: whole glyphs, then "...", within width.
+    column.dotsWidth = static_cast<int16_t>(lv_text_get_width("...", 3U, font, 0));
+    uint32_t offset = 0U;
+    uint32_t kept = 0U;
+    int32_t x = 0;
+    while (offset < length) {
+        const uint32_t letter = lv_text_encoded_next(text, &offset);
+        uint32_t peek = offset;
+        const uint32_t next = offset < length ? lv_text_encoded_next(text, &peek) : 0U;
+        const int32_t advance = lv_font_get_glyph_width(font, letter, next);
+        if (x + advance + column.dotsWidth > width) break;
+        x += advance;
+        kept = offset;
+    }
+    column.fitBytes = static_cast<uint16_t>(kept);
+    column.fitWidth = static_cast<int16_t>(x);
+    column.dots = true;
+}
+
+FLASHMEM void VirtualListKeyValueOverlay::drawColumnText(
+    lv_layer_t* layer,
+    DrawnColumn& column,
+    const lv_font_t* font,
+    const lv_area_t& rowArea,
+    const KeyValueRowSpan& span,
+    lv_text_align_t align,
+    uint32_t color,
+    lv_opa_t opacity
+) {
+    if (!font || column.text.empty() || !span.visible() || opacity == LV_OPA_TRANSP) return;
+    fitColumn(column, font, span.width);
+
+    const int textWidth = column.fitWidth + (column.dots ? column.dotsWidth : 0);
+    int x = rowArea.x1 + span.x;
+    if (align == LV_TEXT_ALIGN_RIGHT) {
+        x += span.width - textWidth;
+    } else if (align == LV_TEXT_ALIGN_CENTER) {
+        x += (span.width - textWidth) / 2;
+    }
+    const int lineHeight = lv_font_get_line_height(font);
+    const int y = rowArea.y1 + (lv_area_get_height(&rowArea) - lineHeight) / 2;
+
+    lv_draw_label_dsc_t dsc;
+    lv_draw_label_dsc_init(&dsc);
+    dsc.font = font;
+    dsc.color = lv_color_hex(color);
+    dsc.opa = opacity;
+    dsc.flag = LV_TEXT_FLAG_EXPAND;
+    std::array<char, KEY_VALUE_ROW_TEXT_CAPACITY + 3> fitted{};
+    if (column.dots) {
+        std::memcpy(fitted.data(), column.text.c_str(), column.fitBytes);
+        std::memcpy(fitted.data() + column.fitBytes, "...", 4U);
+        dsc.text = fitted.data();
+        // Draw tasks may run after this callback returns.
+        dsc.text_local = 1;
+    } else {
+        dsc.text = column.text.c_str();
+    }
+    const lv_area_t area{
+        static_cast<lv_coord_t>(x),
+        static_cast<lv_coord_t>(y),
+        static_cast<lv_coord_t>(x + std::max(textWidth, 1) - 1),
+        static_cast<lv_coord_t>(y + lineHeight - 1),
+    };
+    lv_draw_label(layer, &dsc, &area);
 }
 
+FLASHMEM void VirtualListKeyValueOverlay::onDrawnRowEvent(lv_event_t* event) {
+    auto* widgets = static_cast<SlotWidgets*>(lv_event_get_user_data(event));
+    auto* layer = lv_event_get_layer(event);
+    if (!widgets || !layer || !widgets->owner) return;
+
+    OC_PERF_SCOPE(perfDraw, "ui.kv-overlay.draw-row");
+    MS_UI_PERF_COUNT(KeyValueOverlay, DrawCallbacks, 1U);
+    lv_area_t rowArea{};
+    if (!widgets->owner->prepareDrawnLayout(*widgets, rowArea)) return;
+    const auto& columns = widgets->owner->row_layout_.columns(
+        !widgets->drawnDetail.text.empty(),
+        widgets->sparklineVisible
+    );
+    const bool selected = widgets->highlighted;
+    const bool dimmed = widgets->dimUnselected;
+
+    drawColumnText(layer, widgets->drawnIcon, widgets->iconFont, rowArea,
+                   columns[KeyValueRowColumn::Icon], LV_TEXT_ALIGN_CENTER, widgets->iconColor,
+                   highlightTextOpa(HighlightRole::Icon, selected, dimmed));
+    drawColumnText(layer, widgets->drawnKey, keyFont(), rowArea,
+                   columns[KeyValueRowColumn::Key], LV_TEXT_ALIGN_LEFT,
+                   highlightTextColor(HighlightRole::Label, selected, dimmed), LV_OPA_COVER);
+    drawColumnText(layer, widgets->drawnDetail, detailFont(), rowArea,
+                   columns[KeyValueRowColumn::Detail], LV_TEXT_ALIGN_RIGHT,
+                   base_theme::color::TEXT_SECONDARY, LV_OPA_COVER);
+    drawColumnText(layer, widgets->drawnValue, valueFont(), rowArea,
+                   columns[KeyValueRowColumn::Value], LV_TEXT_ALIGN_RIGHT,
+                   highlightTextColor(HighlightRole::Value, selected, dimmed), LV_OPA_COVER);
+    const auto& sparkline = columns[KeyValueRowColumn::Sparkline];
+    if (sparkline.visible()) {
+        drawSparkline(layer, *widgets, drawnSparklineArea(rowArea, sparkline));
+    }
+}
+#endif
+
 FLASHMEM const VirtualListKeyValueOverlay::RowCache&
 VirtualListKeyValueOverlay::materializeProviderRow(int index) {
-    provider_buffer_ = {};
-    if (row_provider_ != nullptr) {
-        row_provider_(row_provider_context_, index, provider_buffer_);
-    }
-    (void)copyTextIfChanged(provider_row_.key, provider_buffer_.key.data());
-    (void)copyTextIfChanged(provider_row_.value, provider_buffer_.value.data());
-    (void)copyTextIfChanged(provider_row_.detail, provider_buffer_.detail.data());
-    (void)copyTextIfChanged(provider_row_.icon, provider_buffer_.icon.data());
-    provider_row_.iconFont = provider_buffer_.iconFont;
-    provider_row_.iconColor = provider_buffer_.iconColor;
+    const auto& buffer = fetchProviderRow(index);
+    (void)copyTextIfChanged(provider_row_.key, buffer.key.data());
+    (void)copyTextIfChanged(provider_row_.value, buffer.value.data());
+    (void)copyTextIfChanged(provider_row_.detail, buffer.detail.data());
+    (void)copyTextIfChanged(provider_row_.icon, buffer.icon.data());
+    provider_row_.iconFont = buffer.iconFont;
+    provider_row_.iconColor = buffer.iconColor;
     (void)copySparklineIfChanged(
         provider_row_.sparkline,
-        provider_buffer_.sparkline
+        buffer.sparkline
     );
     return provider_row_;
 }
 
+FLASHMEM const KeyValueRowBuffer& VirtualListKeyValueOverlay::fetchProviderRow(int index) {
+    if (const auto* prepared = prefetch_.find(index)) return *prepared;
+
+    auto& buffer = prefetch_.claim(index);
+    if (row_provider_ != nullptr) {
+        row_provider_(row_provider_context_, index, buffer);
+        MS_UI_PERF_COUNT(KeyValueOverlay, ProviderCalls, 1U);
+    }
+    return buffer;
+}
+
+FLASHMEM void VirtualListKeyValueOverlay::schedulePrefetch() {
+    // Without a data revision every render may carry new content and resets
+    // the ring, so rows prepared ahead would only be thrown away.
+    if (!visible_ || occluded_ || row_provider_ == nullptr || last_data_revision_ == 0U ||
+        row_count_ <= VISIBLE_SLOTS) {
+        if (prefetch_timer_) lv_timer_pause(prefetch_timer_);
+        return;
+    }
+    if (prefetch_timer_ == nullptr) {
+        prefetch_timer_ = lv_timer_create(onPrefetchTimer, PREFETCH_PERIOD_MS, this);
+        if (!prefetch_timer_) return;
+    }
+    lv_timer_resume(prefetch_timer_);
+}
+
+FLASHMEM void VirtualListKeyValueOverlay::servicePrefetch() {
+    auto* list = overlay_.list();
+    if (!list || !visible_ || row_provider_ == nullptr) {
+        if (prefetch_timer_) lv_timer_pause(prefetch_timer_);
+        return;
+    }
+
+    OC_PERF_SCOPE(perfPrefetch, "ui.kv-overlay.prefetch");
+    uint32_t prepared = 0U;
+    for (int i = 0; i < PREFETCH_ROWS_PER_TICK; ++i) {
+        const int index = prefetch_.nextMissing(
+            list->getWindowStart(),
+            VISIBLE_SLOTS,
+            prefetch_direction_,
+            PREFETCH_ROWS,
+            PREFETCH_ROWS,
+            row_count_
+        );
+        if (index < 0) {
+            // Span complete; render() resumes the timer after the next move.
+            if (prefetch_timer_) lv_timer_pause(prefetch_timer_);
+            break;
+        }
+        row_provider_(row_provider_context_, index, prefetch_.claim(index));
+        ++prepared;
+    }
+    MS_UI_PERF_COUNT(KeyValueOverlay, ProviderCalls, prepared);
+    OC_PERF_UNITS(perfPrefetch, prepared, static_cast<uint32_t>(row_count_));
+}
+
+FLASHMEM void VirtualListKeyValueOverlay::commitSelection(void* context, int index) {
+    auto* self = static_cast<VirtualListKeyValueOverlay*>(context);
+    if (!self || !self->overlay_.list()) return;
+    self->overlay_.list()->setSelectedIndex(index);
+    self->schedulePrefetch();
+}
+
+FLASHMEM void VirtualListKeyValueOverlay::onOcclusion(void* context, bool occluded) {
+    auto* self = static_cast<VirtualListKeyValueOverlay*>(context);
+    if (!self) return;
+    self->occluded_ = occluded;
+    if (!occluded && self->visible_) {
+        // One catch-up pass for markers that moved while covered.
+        self->serviceSparklineMarkers();
+    }
+    self->refreshSparklineMarkerTimer();
+    self->schedulePrefetch();
+}
+
+FLASHMEM void VirtualListKeyValueOverlay::onPrefetchTimer(lv_timer_t* timer) {
+    auto* self = static_cast<VirtualListKeyValueOverlay*>(
+        lv_timer_get_user_data(timer)
+    );
+    if (self) self->servicePrefetch();
+}
+
 FLASHMEM void VirtualListKeyValueOverlay::updateSlotHighlight(widget::VirtualSlot& slot, bool isSelected) {
     auto* list = overlay_.list();
     if (!list) return;
@@ -381,62 +781,69 @@ FLASHMEM void VirtualListKeyValueOverlay::updateSlotHighlight(widget::VirtualSlo
     const int slotIndex = slot.boundIndex - list->getWindowStart();
     if (slotIndex < 0 || slotIndex >= VISIBLE_SLOTS) return;
 
-    auto& widgets = slot_widgets_[static_cast<size_t>(slotIndex)];
+    auto& widgets = slot_widgets_[slot_ring_.rowFor(slot.boundIndex)];
+    if (widgets.boundIndex != slot.boundIndex) return;
     applyHighlightStyle(widgets, isSelected);
 }
 
-FLASHMEM void VirtualListKeyValueOverlay::ensureSlotWidgets(lv_obj_t* container, int slotIndex) {
-    auto& widgets = slot_widgets_[static_cast<size_t>(slotIndex)];
+FLASHMEM void VirtualListKeyValueOverlay::ensureSlotWidgets(lv_obj_t* container, size_t rowIndex) {
+    auto& widgets = slot_widgets_[rowIndex];
     if (widgets.created || !container) return;
 
-    lv_obj_set_flex_flow(container, LV_FLEX_FLOW_ROW);
-    lv_obj_set_flex_align(container, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
-    lv_obj_set_style_pad_left(container, PAD_H, LV_STATE_DEFAULT);
-    lv_obj_set_style_pad_right(container, PAD_H, LV_STATE_DEFAULT);
-    lv_obj_set_style_pad_column(container, COL_GAP, LV_STATE_DEFAULT);
-
-    widgets.iconLabel = lv_label_create(container);
+    OC_PERF_SCOPE(perfBuild, "ui.kv-overlay.build-row");
+    widgets.row = row_dock_.createRow(overlay_.list(), container);
+#if MS_UI_KV_DRAWN_ROWS
+    // One object per slot: columns come from row_layout_ at draw time.
+    widgets.owner = this;
+    lv_obj_add_event_cb(widgets.row, onDrawnRowEvent, LV_EVENT_DRAW_MAIN, &widgets);
+    widgets.created = true;
+    noteSlotRowBuilt(widgets.row);
+    MS_UI_PERF_OBJECTS(KeyValueOverlay, widgets.row);
+    return;
+#endif
+    lv_obj_set_flex_flow(widgets.row, LV_FLEX_FLOW_ROW);
+    lv_obj_set_flex_align(widgets.row, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
+    lv_obj_set_style_pad_left(widgets.row, PAD_H, LV_STATE_DEFAULT);
+    lv_obj_set_style_pad_right(widgets.row, PAD_H, LV_STATE_DEFAULT);
+    lv_obj_set_style_pad_column(widgets.row, COL_GAP, LV_STATE_DEFAULT);
+
+    widgets.iconLabel = lv_label_create(widgets.row);
     lv_obj_set_width(widgets.iconLabel, ICON_COL_W);
     lv_obj_set_style_text_align(widgets.iconLabel, LV_TEXT_ALIGN_CENTER, LV_STATE_DEFAULT);
     lv_label_set_long_mode(widgets.iconLabel, LV_LABEL_LONG_DOT);
     lv_label_set_text(widgets.iconLabel, "");
+    addHighlightStyles(widgets.iconLabel, HighlightRole::Icon);
+    // Icon glyphs only change with the row; redraws blit the cached bitmap.
+    enableLabelBitmapMode(widgets.iconLabel);
 
-    widgets.keyLabel = lv_label_create(container);
+    widgets.keyLabel = lv_label_create(widgets.row);
     lv_obj_set_flex_grow(widgets.keyLabel, 1);
     lv_label_set_long_mode(widgets.keyLabel, LV_LABEL_LONG_DOT);
-    const lv_font_t* keyFont = fonts.list_item_label
-        ? fonts.list_item_label
-        : LV_FONT_DEFAULT;
-    lv_obj_set_style_text_font(widgets.keyLabel, keyFont, LV_STATE_DEFAULT);
+    lv_obj_set_style_text_font(widgets.keyLabel, keyFont(), LV_STATE_DEFAULT);
     // A fixed one-line box is required for LONG_DOT. With auto height LVGL
     // wraps first, allowing a long key to escape its 32 px virtual row and
     // collide with the contextual strip below it.
-    lv_obj_set_height(widgets.keyLabel, lv_font_get_line_height(keyFont));
-    style::apply(widgets.keyLabel).textColor(base_theme::color::INACTIVE);
+    lv_obj_set_height(widgets.keyLabel, lv_font_get_line_height(keyFont()));
+    addHighlightStyles(widgets.keyLabel, HighlightRole::Label);
 
-    widgets.detailLabel = lv_label_create(container);
+    widgets.detailLabel = lv_label_create(widgets.row);
     lv_obj_set_width(widgets.detailLabel, COMPACT_DETAIL_COL_W);
     lv_obj_set_style_text_align(widgets.detailLabel, LV_TEXT_ALIGN_RIGHT, LV_STATE_DEFAULT);
     lv_label_set_long_mode(widgets.detailLabel, LV_LABEL_LONG_DOT);
-    const lv_font_t* detailFont = fonts.inter_12_medium
-        ? fonts.inter_12_medium
-        : keyFont;
-    lv_obj_set_style_text_font(widgets.detailLabel, detailFont, LV_STATE_DEFAULT);
-    lv_obj_set_height(widgets.detailLabel, lv_font_get_line_height(detailFont));
+    lv_obj_set_style_text_font(widgets.detailLabel, detailFont(), LV_STATE_DEFAULT);
+    lv_obj_set_height(widgets.detailLabel, lv_font_get_line_height(detailFont()));
     style::apply(widgets.detailLabel).textColor(base_theme::color::TEXT_SECONDARY);
     lv_obj_add_flag(widgets.detailLabel, LV_OBJ_FLAG_HIDDEN);
 
-    widgets.valueLabel = lv_label_create(container);
+    widgets.valueLabel = lv_label_create(widgets.row);
     lv_obj_set_width(widgets.valueLabel, VALUE_COL_W);
     lv_obj_set_style_text_align(widgets.valueLabel, LV_TEXT_ALIGN_RIGHT, LV_STATE_DEFAULT);
     lv_label_set_long_mode(widgets.valueLabel, LV_LABEL_LONG_DOT);
-    const lv_font_t* valueFont = fonts.inter_14_semibold
-        ? fonts.inter_14_semibold
-        : keyFont;
-    lv_obj_set_style_text_font(widgets.valueLabel, valueFont, LV_STATE_DEFAULT);
-    lv_obj_set_height(widgets.valueLabel, lv_font_get_line_height(valueFont));
+    lv_obj_set_style_text_font(widgets.valueLabel, valueFont(), LV_STATE_DEFAULT);
+    lv_obj_set_height(widgets.valueLabel, lv_font_get_line_height(valueFont()));
+    addHighlightStyles(widgets.valueLabel, HighlightRole::Value);
 
-    widgets.sparklineSurface = lv_obj_create(container);
+    widgets.sparklineSurface = lv_obj_create(widgets.row);
     lv_obj_set_size(widgets.sparklineSurface, VALUE_COL_W, SPARKLINE_H);
     lv_obj_set_style_bg_opa(
         widgets.sparklineSurface,
@@ -471,12 +878,14 @@ FLASHMEM void VirtualListKeyValueOverlay::ensureSlotWidgets(lv_obj_t* container,
 
     widgets.created = true;
     applyCompactLayout(widgets);
+    noteSlotRowBuilt(widgets.row);
+    MS_UI_PERF_OBJECTS(KeyValueOverlay, widgets.row);
 }
 
 FLASHMEM void VirtualListKeyValueOverlay::applyCompactLayout(SlotWidgets& widgets) {
-    if (!widgets.created || !widgets.keyLabel) return;
-    lv_obj_t* container = lv_obj_get_parent(widgets.keyLabel);
-    if (!container) return;
+    // Drawn rows pick their spans from row_layout_, keyed by compact_facts_.
+    if (!widgets.created || !widgets.row || MS_UI_KV_DRAWN_ROWS) return;
+    lv_obj_t* container = widgets.row;
 
     lv_obj_set_style_pad_left(
         container,
@@ -516,7 +925,7 @@ FLASHMEM void VirtualListKeyValueOverlay::applyCompactLayout(SlotWidgets& widget
     }
 }
 
-FLASHMEM void VirtualListKeyValueOverlay::applySparkline(
+FLASHMEM bool VirtualListKeyValueOverlay::applySparkline(
     SlotWidgets& widgets,
     const RowCache& row
 ) {
@@ -529,28 +938,31 @@ FLASHMEM void VirtualListKeyValueOverlay::applySparkline(
             lv_obj_clear_flag(widgets.valueLabel, LV_OBJ_FLAG_HIDDEN);
         }
     }
-    if (!widgets.sparklineSurface) return;
 
     if (!showSparkline) {
-        if (widgets.sparklineVisible) {
+        const bool wasVisible = widgets.sparklineVisible;
+        if (wasVisible && widgets.sparklineSurface) {
             lv_obj_add_flag(widgets.sparklineSurface, LV_OBJ_FLAG_HIDDEN);
-            widgets.sparklineVisible = false;
         }
+        widgets.sparklineVisible = false;
         widgets.sparkline = {};
         widgets.marker = {};
         refreshSparklineMarkerTimer();
-        return;
+        return wasVisible;
     }
 
     const bool geometryChanged = copySparklineIfChanged(
         widgets.sparkline,
         row.sparkline
     );
-    if (geometryChanged || !widgets.sparklineVisible) {
+    const bool redraw = geometryChanged || !widgets.sparklineVisible;
+    if (redraw) {
         widgets.marker = {};
-        lv_obj_invalidate(widgets.sparklineSurface);
+        if (widgets.sparklineSurface) MS_UI_PERF_INVALIDATE(KeyValueOverlay, widgets.sparklineSurface);
+    }
+    if (widgets.sparklineSurface) {
+        lv_obj_clear_flag(widgets.sparklineSurface, LV_OBJ_FLAG_HIDDEN);
     }
-    lv_obj_clear_flag(widgets.sparklineSurface, LV_OBJ_FLAG_HIDDEN);
     widgets.sparklineVisible = true;
     if (widgets.sparkline.markerProvider != nullptr && marker_timer_ == nullptr) {
         marker_timer_ = lv_timer_create(
@@ -561,6 +973,7 @@ FLASHMEM void VirtualListKeyValueOverlay::applySparkline(
         if (marker_timer_) lv_timer_pause(marker_timer_);
     }
     refreshSparklineMarkerTimer();
+    return redraw;
 }
 
 FLASHMEM void VirtualListKeyValueOverlay::onSparklineDrawEvent(
@@ -568,14 +981,44 @@ FLASHMEM void VirtualListKeyValueOverlay::onSparklineDrawEvent(
 ) {
     auto* widgets = static_cast<SlotWidgets*>(lv_event_get_user_data(event));
     auto* layer = lv_event_get_layer(event);
-    if (!widgets || !layer || !widgets->sparklineSurface ||
-        !widgets->sparklineVisible || !widgets->sparkline.enabled ||
-        widgets->sparkline.sampleProvider == nullptr) {
-        return;
-    }
+    if (!widgets || !layer || !widgets->sparklineSurface) return;
 
+    MS_UI_PERF_COUNT(KeyValueOverlay, DrawCallbacks, 1U);
     lv_area_t area{};
     lv_obj_get_coords(widgets->sparklineSurface, &area);
+    drawSparkline(layer, *widgets, area);
+}
+
+FLASHMEM bool VirtualListKeyValueOverlay::sparklineArea(
+    const SlotWidgets& widgets,
+    lv_area_t& area
+) {
+    if (widgets.sparklineSurface) {
+        lv_obj_get_coords(widgets.sparklineSurface, &area);
+        return true;
+    }
+#if MS_UI_KV_DRAWN_ROWS
+    lv_area_t rowArea{};
+    if (!prepareDrawnLayout(widgets, rowArea)) return false;
+    const auto& span = row_layout_.columns(!widgets.drawnDetail.text.empty(), true)
+        [KeyValueRowColumn::Sparkline];
+    area = drawnSparklineArea(rowArea, span);
+    return true;
+#else
+    return false;
+#endif
+}
+
+FLASHMEM void VirtualListKeyValueOverlay::drawSparkline(
+    lv_layer_t* layer,
+    const SlotWidgets& widgets,
+    const lv_area_t& area
+) {
+    if (!widgets.sparklineVisible || !widgets.sparkline.enabled ||
+        widgets.sparkline.sampleProvider == nullptr) {
+        return;
+    }
+
     const int width = std::min<int>(
         lv_area_get_width(&area),
         KEY_VALUE_SPARKLINE_MAX_WIDTH
@@ -583,7 +1026,7 @@ FLASHMEM void VirtualListKeyValueOverlay::onSparklineDrawEvent(
     const int height = lv_area_get_height(&area);
     if (width < 2 || height < 2) return;
 
-    if (widgets->sparkline.centerLine) {
+    if (widgets.sparkline.centerLine) {
         std::array<lv_point_precise_t, 2> guide{{
             {
                 static_cast<lv_value_precise_t>(area.x1),
@@ -638,8 +1081,8 @@ FLASHMEM void VirtualListKeyValueOverlay::onSparklineDrawEvent(
                   )
                 : 0U;
             KeyValueSparklineSample sample{};
-            if (!widgets->sparkline.sampleProvider(
-                    widgets->sparkline,
+            if (!widgets.sparkline.sampleProvider(
+                    widgets.sparkline,
                     positionQ16,
                     previousPositionQ16,
                     column > 0U,
@@ -668,13 +1111,13 @@ FLASHMEM void VirtualListKeyValueOverlay::onSparklineDrawEvent(
         flush();
     }
 
-    if (widgets->marker.visible) {
+    if (widgets.marker.visible) {
         const int markerX = area.x1 + keyValueSparklineCoordinate(
-            widgets->marker.positionQ16,
+            widgets.marker.positionQ16,
             width
         );
         const int markerY = area.y1 + height - 1 -
-            keyValueSparklineCoordinate(widgets->marker.valueQ16, height);
+            keyValueSparklineCoordinate(widgets.marker.valueQ16, height);
         std::array<lv_point_precise_t, 2> marker{{
             {
                 static_cast<lv_value_precise_t>(markerX),
@@ -705,7 +1148,9 @@ FLASHMEM void VirtualListKeyValueOverlay::onSparklineDrawEvent(
 FLASHMEM void VirtualListKeyValueOverlay::serviceSparklineMarkers() {
     const uint32_t nowMs = lv_tick_get();
     for (auto& widgets : slot_widgets_) {
-        if (!widgets.sparklineVisible || !widgets.sparklineSurface ||
+        // Drawn rows have no surface; the marker damages the row itself.
+        lv_obj_t* target = widgets.sparklineSurface ? widgets.sparklineSurface : widgets.row;
+        if (!widgets.sparklineVisible || !target ||
             widgets.sparkline.markerProvider == nullptr) {
             continue;
         }
@@ -718,13 +1163,18 @@ FLASHMEM void VirtualListKeyValueOverlay::serviceSparklineMarkers() {
             next = {};
         }
         if (sameMarker(widgets.marker, next)) continue;
+        lv_area_t surface{};
+        if (!sparklineArea(widgets, surface)) {
+            widgets.marker = next;
+            continue;
+        }
         if (widgets.marker.visible && next.visible) {
             const auto oldArea = markerDamageArea(
-                widgets.sparklineSurface,
+                surface,
                 widgets.marker
             );
             const auto nextArea = markerDamageArea(
-                widgets.sparklineSurface,
+                surface,
                 next
             );
             if (sameArea(oldArea, nextArea)) {
@@ -734,18 +1184,18 @@ FLASHMEM void VirtualListKeyValueOverlay::serviceSparklineMarkers() {
         }
         if (widgets.marker.visible) {
             const auto oldArea = markerDamageArea(
-                widgets.sparklineSurface,
+                surface,
                 widgets.marker
             );
-            lv_obj_invalidate_area(widgets.sparklineSurface, &oldArea);
+            MS_UI_PERF_INVALIDATE_AREA(KeyValueOverlay, target, &oldArea);
         }
         widgets.marker = next;
         if (widgets.marker.visible) {
             const auto newArea = markerDamageArea(
-                widgets.sparklineSurface,
+                surface,
                 widgets.marker
             );
-            lv_obj_invalidate_area(widgets.sparklineSurface, &newArea);
+            MS_UI_PERF_INVALIDATE_AREA(KeyValueOverlay, target, &newArea);
         }
     }
 }
@@ -753,7 +1203,7 @@ FLASHMEM void VirtualListKeyValueOverlay::serviceSparklineMarkers() {
 FLASHMEM void VirtualListKeyValueOverlay::refreshSparklineMarkerTimer() {
     if (!marker_timer_) return;
     bool active = false;
-    if (visible_) {
+    if (visible_ && !occluded_) {
         for (const auto& widgets : slot_widgets_) {
             if (widgets.sparklineVisible &&
                 widgets.sparkline.markerProvider != nullptr) {
@@ -784,33 +1234,24 @@ FLASHMEM void VirtualListKeyValueOverlay::applyHighlightStyle(SlotWidgets& widge
         return;
     }
 
-    if (widgets.iconLabel) {
-        lv_obj_set_style_text_opa(
-            widgets.iconLabel,
-            isSelected ? LV_OPA_COVER : LV_OPA_70,
-            LV_STATE_DEFAULT
-        );
-    }
-    if (widgets.keyLabel) {
-        style::apply(widgets.keyLabel).textColor(
-            isSelected
-                ? base_theme::color::TEXT_PRIMARY
-                : (dim_unselected_
-                       ? base_theme::color::INACTIVE
-                       : base_theme::color::TEXT_SECONDARY));
-    }
-    if (widgets.valueLabel) {
-        style::apply(widgets.valueLabel).textColor(
-            isSelected
-                ? base_theme::color::ACTIVE
-                : (dim_unselected_
-                       ? base_theme::color::INACTIVE
-                       : base_theme::color::INACTIVE_LIGHTER));
+    if (MS_UI_KV_DRAWN_ROWS) {
+        // The slot background redraws on a selection move anyway; the row
+        // picks its palette from these flags when it draws.
+        if (widgets.row) MS_UI_PERF_INVALIDATE(KeyValueOverlay, widgets.row);
+        widgets.highlighted = isSelected;
+        widgets.dimUnselected = dim_unselected_;
+        widgets.highlightStyleApplied = true;
+        return;
     }
+
+    // Shared styles pick the colors; only the state bits change here.
+    setHighlightState(widgets.iconLabel, isSelected, dim_unselected_);
+    setHighlightState(widgets.keyLabel, isSelected, dim_unselected_);
+    setHighlightState(widgets.valueLabel, isSelected, dim_unselected_);
     if (widgets.sparklineSurface && widgets.sparklineVisible) {
         // Curve color remains semantic/active for every visible source. Focus
         // is conveyed by the row background, not by rebuilding its geometry.
-        lv_obj_invalidate(widgets.sparklineSurface);
+        MS_UI_PERF_INVALIDATE(KeyValueOverlay, widgets.sparklineSurface);
     }
 
     widgets.highlighted = isSelected;
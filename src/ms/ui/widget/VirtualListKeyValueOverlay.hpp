@@ -14,7 +14,24 @@
 #include <oc/ui/lvgl/widget/VirtualList.hpp>
 
 #include <ms/ui/component/VirtualListOverlay.hpp>
+#include <ms/ui/text/FixedText.hpp>
+#include <ms/ui/text/TextCache.hpp>
+#include <ms/ui/widget/CoalescedSelection.hpp>
+#include <ms/ui/widget/KeyValueRowGeometry.hpp>
 #include <ms/ui/widget/KeyValueSparkline.hpp>
+#include <ms/ui/widget/SlotMemoryPolicy.hpp>
+#include <ms/ui/widget/SlotRowDock.hpp>
+#include <ms/ui/widget/VirtualListPrefetch.hpp>
+#include <ms/ui/widget/VirtualSlotRing.hpp>
+
+// 0 (default): the flex row of labels plus a sparkline surface. 1: each
+// slot row is one object drawing its columns from precomputed
+// KeyValueRowLayout spans (1 LVGL object per slot instead of 6, no flex
+// relayout on bind); opt in once measured on the target. The drawn-row
+// columns, layout and callbacks are compiled out at 0.
+#ifndef MS_UI_KV_DRAWN_ROWS
+#define MS_UI_KV_DRAWN_ROWS 0
+#endif
 
 namespace ms::ui {
 
@@ -90,12 +107,20 @@ public:
 private:
     static constexpr int VISIBLE_SLOTS = 5;
     static constexpr int MAX_ROWS = 16;
-    static constexpr size_t TEXT_CACHE_SIZE = KEY_VALUE_ROW_TEXT_CAPACITY;
+    // Interned row text: 16 static rows plus the provider row, four fields
+    // each. 16 bytes each on average, 8 guaranteed, long text cut when
+    // the slack runs out (~1.9 KB with the entry table).
+    static constexpr size_t TEXT_ARENA_ENTRIES = (MAX_ROWS + 1) * 4;
     static constexpr int MAX_PROVIDER_ROWS = 4096;
-
-    struct TextCache {
-        char text[TEXT_CACHE_SIZE] = {};
-    };
+    // Provider rows prepared around the window while LVGL is idle. The ring
+    // covers exactly the window plus both look-ahead spans, which is the
+    // longest contiguous span that must not collide. Cost per overlay is
+    // PREFETCH_CAPACITY KeyValueRowBuffers (~230 B each on the Teensy,
+    // ~3 KB total) where a single bind buffer used to be enough.
+    static constexpr int PREFETCH_ROWS = 4;
+    static constexpr int PREFETCH_ROWS_PER_TICK = 2;
+    static constexpr std::size_t PREFETCH_CAPACITY =
+        static_cast<std::size_t>(VISIBLE_SLOTS + 2 * PREFETCH_ROWS);
 
     struct RowCache {
         TextCache key;
@@ -107,8 +132,25 @@ private:
         KeyValueSparkline sparkline{};
     };
 
+#if MS_UI_KV_DRAWN_ROWS
+    /**
+     * Text of one drawn column, fitted to its span on first draw the way
+     * LV_LABEL_LONG_DOT would: fitBytes of text, then "..." when dots.
+     */
+    struct DrawnColumn {
+        FixedText<KEY_VALUE_ROW_TEXT_CAPACITY> text;
+        const lv_font_t* fitFont = nullptr;
+        int16_t fitSpan = -1;
+        int16_t fitWidth = 0;
+        int16_t dotsWidth = 0;
+        uint16_t fitBytes = 0;
+        bool dots = false;
+    };
+#endif
+
     struct SlotWidgets {
         bool created = false;
+        lv_obj_t* row = nullptr;
         lv_obj_t* iconLabel = nullptr;
         lv_obj_t* keyLabel = nullptr;
         lv_obj_t* valueLabel = nullptr;
@@ -118,40 +160,86 @@ private:
         bool highlightStyleApplied = false;
         bool dimUnselected = true;
         int boundIndex = -1;
-        TextCache iconCache;
-        TextCache keyCache;
-        TextCache valueCache;
-        TextCache detailCache;
+        TextStamp iconCache;
+        TextStamp keyCache;
+        TextStamp valueCache;
+        TextStamp detailCache;
         const lv_font_t* iconFont = nullptr;
         uint32_t iconColor = 0;
         bool sparklineVisible = false;
         KeyValueSparkline sparkline{};
         KeyValueSparklineMarker marker{};
+#if MS_UI_KV_DRAWN_ROWS
+        // Drawn rows only: row is the single object and these are its columns.
+        DrawnColumn drawnIcon;
+        DrawnColumn drawnKey;
+        DrawnColumn drawnDetail;
+        DrawnColumn drawnValue;
+        VirtualListKeyValueOverlay* owner = nullptr;
+#endif
     };
 
     void bindSlot(oc::ui::lvgl::widget::VirtualSlot& slot, int index, bool isSelected);
     void updateSlotHighlight(oc::ui::lvgl::widget::VirtualSlot& slot, bool isSelected);
-    void ensureSlotWidgets(lv_obj_t* container, int slotIndex);
+    void ensureSlotWidgets(lv_obj_t* container, std::size_t rowIndex);
+    void releaseRows();
     void applyCompactLayout(SlotWidgets& widgets);
     void applyHighlightStyle(SlotWidgets& widgets, bool isSelected);
-    void applySparkline(SlotWidgets& widgets, const RowCache& row);
+    bool applySparkline(SlotWidgets& widgets, const RowCache& row);
+    void bindWidgetRow(SlotWidgets& widgets, const RowCache& row);
+    bool sparklineArea(const SlotWidgets& widgets, lv_area_t& area);
+    static void drawSparkline(lv_layer_t* layer, const SlotWidgets& widgets, const lv_area_t& area);
+#if MS_UI_KV_DRAWN_ROWS
+    void bindDrawnRow(SlotWidgets& widgets, const RowCache& row);
+    bool prepareDrawnLayout(const SlotWidgets& widgets, lv_area_t& rowArea);
+    KeyValueRowMetrics rowMetrics() const;
+    static void fitColumn(DrawnColumn& column, const lv_font_t* font, int width);
+    static void drawColumnText(lv_layer_t* layer,
+                               DrawnColumn& column,
+                               const lv_font_t* font,
+                               const lv_area_t& rowArea,
+                               const KeyValueRowSpan& span,
+                               lv_text_align_t align,
+                               uint32_t color,
+                               lv_opa_t opacity);
+    static void onDrawnRowEvent(lv_event_t* event);
+#endif
     void serviceSparklineMarkers();
     void refreshSparklineMarkerTimer();
     static void onSparklineDrawEvent(lv_event_t* event);
     static void onSparklineMarkerTimer(lv_timer_t* timer);
     const RowCache& materializeProviderRow(int index);
+    const KeyValueRowBuffer& fetchProviderRow(int index);
+    void schedulePrefetch();
+    void servicePrefetch();
+    static void onPrefetchTimer(lv_timer_t* timer);
+    static void onOcclusion(void* context, bool occluded);
+    // Row fonts may still be loading at construction: re-applied once every
+    // core font is in. Drawn rows refit their columns on the next draw.
+    void applyFonts();
+    static void onCoreFontsReady(void* context);
+    static void commitSelection(void* context, int index);
     void syncRows(const VirtualListKeyValueOverlayProps& props,
                   std::array<int, MAX_ROWS>& dirtyIndices,
                   int& dirtyCount);
     void invalidateDirtyRows(const std::array<int, MAX_ROWS>& dirtyIndices, int dirtyCount);
-    static bool copyTextIfChanged(TextCache& cache, const char* text);
+    bool copyTextIfChanged(TextCache& cache, const char* text);
+    const char* rowText(const TextCache& cache) const { return cache.c_str(text_arena_); }
     static bool copySparklineIfChanged(KeyValueSparkline& cache, const KeyValueSparkline& next);
-    static void setLabelTextIfChanged(lv_obj_t* label, TextCache& cache, const char* text);
+    static void setLabelTextIfChanged(lv_obj_t* label, TextStamp& cache, const char* text);
 
     VirtualListOverlay overlay_;
+    CoalescedSelection selection_;
+    // Row content is keyed by index % VISIBLE_SLOTS, not by slot position.
     std::array<SlotWidgets, VISIBLE_SLOTS> slot_widgets_{};
+#if MS_UI_KV_DRAWN_ROWS
+    KeyValueRowLayout row_layout_{};
+#endif
+    VirtualSlotRing<VISIBLE_SLOTS> slot_ring_{};
+    SlotRowDock row_dock_{PerfWidget::KeyValueOverlay};
+    TextCacheArena<TEXT_ARENA_ENTRIES> text_arena_{};
     std::array<RowCache, MAX_ROWS> rows_{};
-    KeyValueRowBuffer provider_buffer_{};
+    VirtualListPrefetchRing<KeyValueRowBuffer, PREFETCH_CAPACITY> prefetch_{};
     RowCache provider_row_{};
 
     KeyValueRowProvider row_provider_ = nullptr;
@@ -163,7 +251,13 @@ private:
     bool dim_unselected_ = true;
     bool compact_facts_ = false;
     bool visible_ = false;
+    // Covered by another overlay: marker and prefetch timers stay paused.
+    bool occluded_ = false;
     lv_timer_t* marker_timer_ = nullptr;
+    lv_timer_t* prefetch_timer_ = nullptr;
+    int prefetch_direction_ = 1;
+    int last_selected_index_ = 0;
+    bool rows_released_ = false;
 };
 
 }  // namespace ms::ui
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace ms::ui {
+
+/**
+ * Bounded look-ahead ring for provider-backed VirtualList rows.
+ *
+ * Rows are direct-mapped by `index % Capacity`, so lookup and replacement are
+ * O(1) and a contiguous span of up to Capacity rows never collides. The owner
+ * fills rows ahead of the visible window during idle ticks; binding a slot on
+ * scroll then copies a prepared buffer instead of calling the provider inside
+ * the frame.
+ */
+template <typename Row, std::size_t Capacity>
+class VirtualListPrefetchRing {
+public:
+    static_assert(Capacity > 0U, "Prefetch ring needs at least one row");
+
+    static constexpr std::size_t capacity() { return Capacity; }
+
+    /** Drop every prepared row (data revision, count or provider changed). */
+    void reset() {
+        for (auto& entry : entries_) entry.index = -1;
+    }
+
+    [[nodiscard]] bool contains(int index) const {
+        return index >= 0 && entries_[slotFor(index)].index == index;
+    }
+
+    [[nodiscard]] const Row* find(int index) const {
+        return contains(index) ? &entries_[slotFor(index)].row : nullptr;
+    }
+
+    /**
+     * Claim the entry for index, evicting whichever row shared its slot. The
+     * returned row is cleared; the caller fills it from the provider.
+     */
+    Row& claim(int index) {
+        auto& entry = entries_[slotFor(index)];
+        entry.index = index;
+        entry.row = Row{};
+        return entry.row;
+    }
+
+    /**
+     * Next missing row to prepare around a window, or -1 when the span is
+     * complete. Rows ahead in the scroll direction come first (nearest
+     * first), then rows behind; the visible window itself is left to bind.
+     */
+    [[nodiscard]] int nextMissing(
+        int windowStart,
+        int windowCount,
+        int direction,
+        int ahead,
+        int behind,
+        int totalCount
+    ) const {
+        const bool backwards = direction < 0;
+        const int windowEnd = windowStart + windowCount;
+        const auto below = [&](int step) { return windowEnd + step; };
+        const auto above = [&](int step) { return windowStart - 1 - step; };
+        const auto missing = [&](int index) {
+            return index >= 0 && index < totalCount && !contains(index);
+        };
+        for (int step = 0; step < ahead; ++step) {
+            const int index = backwards ? above(step) : below(step);
+            if (missing(index)) return index;
+        }
+        for (int step = 0; step < behind; ++step) {
+            const int index = backwards ? below(step) : above(step);
+            if (missing(index)) return index;
+        }
+        return -1;
+    }
+
+private:
+    struct Entry {
+        int index = -1;
+        Row row{};
+    };
+
+    [[nodiscard]] static std::size_t slotFor(int index) {
+        return static_cast<std::size_t>(index) % Capacity;
+    }
+
+    std::array<Entry, Capacity> entries_{};
+};
+
+}  // namespace ms::ui
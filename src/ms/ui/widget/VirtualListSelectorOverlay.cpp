@@ -1,13 +1,14 @@
 #include "VirtualListSelectorOverlay.hpp"
 
-#include <cstring>
-
 #include <config/PlatformCompat.hpp>
+#include <oc/diagnostics/Performance.hpp>
 #include <oc/type/TextFormat.hpp>
 #include <oc/ui/lvgl/style/StyleBuilder.hpp>
 #include <oc/ui/lvgl/theme/BaseTheme.hpp>
 
+#include <ms/ui/PerfCounters.hpp>
 #include <ms/ui/font/CoreFonts.hpp>
+#include <ms/ui/widget/HighlightStyles.hpp>
 
 namespace ms::ui {
 
@@ -23,7 +24,8 @@ constexpr int INDEX_W = 24;
 }
 
 FLASHMEM VirtualListSelectorOverlay::VirtualListSelectorOverlay(lv_obj_t* parent)
-    : overlay_(parent) {
+    : overlay_(parent), selection_(commitSelection, this) {
+    MS_UI_PERF_CONSTRUCT(SelectorOverlay);
     overlay_.configureList(VISIBLE_SLOTS, ITEM_HEIGHT);
 
     auto* list = overlay_.list();
@@ -36,44 +38,53 @@ FLASHMEM VirtualListSelectorOverlay::VirtualListSelectorOverlay(lv_obj_t* parent
                 updateSlotHighlight(slot, isSelected);
             });
 
-        list->prepare();
-        const auto& slots = list->getSlots();
-        for (int i = 0; i < VISIBLE_SLOTS && i < static_cast<int>(slots.size()); ++i) {
-            ensureSlotWidgets(slots[static_cast<size_t>(i)].container, i);
+        // Lazy policies leave row widgets to the first bind after show().
+        if (slotMemoryPolicy() == SlotMemoryPolicy::Eager) {
+            list->prepare();
+            const auto& slots = list->getSlots();
+            for (int i = 0; i < VISIBLE_SLOTS && i < static_cast<int>(slots.size()); ++i) {
+                ensureSlotWidgets(slots[static_cast<size_t>(i)].container, static_cast<size_t>(i));
+            }
         }
     }
+    whenCoreFontsReady(coreFontAliasBit(CoreFontAlias::ListItemLabel), onCoreFontsReady, this);
 }
 
 FLASHMEM VirtualListSelectorOverlay::~VirtualListSelectorOverlay() {
+    cancelCoreFontsReady(this);
     // Overlay owns LVGL objects; VirtualListOverlay handles deletion.
 }
 
-FLASHMEM bool VirtualListSelectorOverlay::copyTextIfChanged(TextCache& cache, const char* text) {
-    const char* source = text ? text : "";
-    char next[TEXT_CACHE_SIZE] = {};
-    std::strncpy(next, source, TEXT_CACHE_SIZE - 1);
-    next[TEXT_CACHE_SIZE - 1] = '\0';
-
-    if (std::strncmp(cache.text, next, TEXT_CACHE_SIZE) == 0) return false;
+FLASHMEM void VirtualListSelectorOverlay::onCoreFontsReady(void* context) {
+    static_cast<VirtualListSelectorOverlay*>(context)->applyFonts();
+}
 
-    std::strncpy(cache.text, next, TEXT_CACHE_SIZE - 1);
-    cache.text[TEXT_CACHE_SIZE - 1] = '\0';
-    return true;
+FLASHMEM void VirtualListSelectorOverlay::applyFonts() {
+    const lv_font_t* font = coreFontOrDefault(fonts.list_item_label);
+    for (auto& widgets : slot_widgets_) {
+        if (!widgets.created) continue;
+        lv_obj_set_style_text_font(widgets.indexLabel, font, LV_STATE_DEFAULT);
+        lv_obj_set_style_text_font(widgets.label, font, LV_STATE_DEFAULT);
+    }
 }
 
 FLASHMEM void VirtualListSelectorOverlay::setLabelTextIfChanged(
     lv_obj_t* label,
-    TextCache& cache,
+    TextStamp& cache,
     const char* text
 ) {
     if (!label) return;
-    if (!copyTextIfChanged(cache, text)) return;
-    lv_label_set_text(label, cache.text);
+    if (!cache.update(text)) return;
+    lv_label_set_text(label, text ? text : "");
+    MS_UI_PERF_COUNT(SelectorOverlay, LabelTextSets, 1U);
 }
 
 FLASHMEM void VirtualListSelectorOverlay::render(const VirtualListSelectorOverlayProps& props) {
+    MS_UI_PERF_COUNT(SelectorOverlay, Renders, 1U);
     if (!props.visible) {
+        selection_.cancel();
         overlay_.hide();
+        if (slotMemoryPolicy() == SlotMemoryPolicy::LazyReclaim) releaseRows();
         return;
     }
 
@@ -95,6 +106,8 @@ FLASHMEM void VirtualListSelectorOverlay::render(const VirtualListSelectorOverla
         overlay_.setBackdropOpacity(props.backdropOpacity);
     }
 
+    if (dataChanged) slot_ring_.reset();
+
     last_items_ = props.items;
     last_item_count_ = props.itemCount;
     last_show_index_column_ = props.showIndexColumn;
@@ -111,19 +124,40 @@ FLASHMEM void VirtualListSelectorOverlay::render(const VirtualListSelectorOverla
     auto* list = overlay_.list();
     if (list) {
         const bool countChanged = list->setTotalCount(totalCount);
-        list->setSelectedIndex(props.selectedIndex);
-
-        // Only rebind visible slots when data (not selection) changed.
-        if (!countChanged && dataChanged && overlay_.isVisible()) {
-            list->invalidate();
+        if (!countChanged && !dataChanged && overlay_.isVisible()) {
+            // Pure selection move: the window moves once per frame.
+            selection_.request(props.selectedIndex);
+        } else {
+            selection_.cancel();
+            list->setSelectedIndex(props.selectedIndex);
+
+            // Only rebind visible slots when data (not selection) changed.
+            if (!countChanged && dataChanged && overlay_.isVisible()) {
+                list->invalidate();
+            }
         }
     }
 
     if (!overlay_.isVisible()) {
         overlay_.show();
+        if (rows_released_ && list) {
+            // Slots still believe they are bound; rebuild rows on this pass.
+            rows_released_ = false;
+            list->invalidate();
+        }
     }
 }
 
+FLASHMEM void VirtualListSelectorOverlay::releaseRows() {
+    if (reclaimSlotRows(slot_widgets_)) rows_released_ = true;
+    slot_ring_.reset();
+}
+
+FLASHMEM void VirtualListSelectorOverlay::commitSelection(void* context, int index) {
+    auto* self = static_cast<VirtualListSelectorOverlay*>(context);
+    if (self && self->overlay_.list()) self->overlay_.list()->setSelectedIndex(index);
+}
+
 FLASHMEM void VirtualListSelectorOverlay::bindSlot(widget::VirtualSlot& slot, int index, bool isSelected) {
     auto* list = overlay_.list();
     if (!list) return;
@@ -131,9 +165,18 @@ FLASHMEM void VirtualListSelectorOverlay::bindSlot(widget::VirtualSlot& slot, in
     const int slotIndex = index - list->getWindowStart();
     if (slotIndex < 0 || slotIndex >= VISIBLE_SLOTS) return;
 
-    ensureSlotWidgets(slot.container, slotIndex);
-    auto& widgets = slot_widgets_[static_cast<size_t>(slotIndex)];
+    // Rows still in the window after a shift only move to their new slot.
+    const bool rebind = slot_ring_.claim(index);
+    const size_t rowIndex = slot_ring_.rowFor(index);
+    ensureSlotWidgets(slot.container, rowIndex);
+    auto& widgets = slot_widgets_[rowIndex];
+    row_dock_.dock(widgets.row, slot.container);
+    if (!rebind && widgets.boundIndex == index) {
+        applyHighlightStyle(widgets, isSelected);
+        return;
+    }
 
+    MS_UI_PERF_COUNT(SelectorOverlay, RowsBound, 1U);
     const char* name = "";
     if (current_props_.items && index >= 0 && index < current_props_.itemCount) {
         name = current_props_.items[index] ? current_props_.items[index] : "";
@@ -169,36 +212,38 @@ FLASHMEM void VirtualListSelectorOverlay::updateSlotHighlight(widget::VirtualSlo
     const int slotIndex = slot.boundIndex - list->getWindowStart();
     if (slotIndex < 0 || slotIndex >= VISIBLE_SLOTS) return;
 
-    auto& widgets = slot_widgets_[static_cast<size_t>(slotIndex)];
+    auto& widgets = slot_widgets_[slot_ring_.rowFor(slot.boundIndex)];
+    if (widgets.boundIndex != slot.boundIndex) return;
     applyHighlightStyle(widgets, isSelected);
 }
 
-FLASHMEM void VirtualListSelectorOverlay::ensureSlotWidgets(lv_obj_t* container, int slotIndex) {
-    auto& widgets = slot_widgets_[static_cast<size_t>(slotIndex)];
+FLASHMEM void VirtualListSelectorOverlay::ensureSlotWidgets(lv_obj_t* container, size_t rowIndex) {
+    auto& widgets = slot_widgets_[rowIndex];
     if (widgets.created || !container) return;
 
-    lv_obj_set_flex_flow(container, LV_FLEX_FLOW_ROW);
-    lv_obj_set_flex_align(container, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
-    lv_obj_set_style_pad_left(container, PAD_H, LV_STATE_DEFAULT);
-    lv_obj_set_style_pad_right(container, PAD_H, LV_STATE_DEFAULT);
-    lv_obj_set_style_pad_column(container, COL_GAP, LV_STATE_DEFAULT);
+    OC_PERF_SCOPE(perfBuild, "ui.selector-overlay.build-row");
+    widgets.row = row_dock_.createRow(overlay_.list(), container);
+    lv_obj_set_flex_flow(widgets.row, LV_FLEX_FLOW_ROW);
+    lv_obj_set_flex_align(widgets.row, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
+    lv_obj_set_style_pad_left(widgets.row, PAD_H, LV_STATE_DEFAULT);
+    lv_obj_set_style_pad_right(widgets.row, PAD_H, LV_STATE_DEFAULT);
+    lv_obj_set_style_pad_column(widgets.row, COL_GAP, LV_STATE_DEFAULT);
 
-    widgets.indexLabel = lv_label_create(container);
+    widgets.indexLabel = lv_label_create(widgets.row);
     lv_obj_set_width(widgets.indexLabel, INDEX_W);
     lv_obj_set_style_text_align(widgets.indexLabel, LV_TEXT_ALIGN_RIGHT, LV_STATE_DEFAULT);
-    if (fonts.list_item_label) {
-        lv_obj_set_style_text_font(widgets.indexLabel, fonts.list_item_label, LV_STATE_DEFAULT);
-    }
-    style::apply(widgets.indexLabel).textColor(base_theme::color::INACTIVE);
+    lv_obj_set_style_text_font(widgets.indexLabel, coreFontOrDefault(fonts.list_item_label), LV_STATE_DEFAULT);
+    addHighlightStyles(widgets.indexLabel, HighlightRole::Value);
 
-    widgets.label = lv_label_create(container);
+    widgets.label = lv_label_create(widgets.row);
     lv_obj_set_flex_grow(widgets.label, 1);
     lv_label_set_long_mode(widgets.label, LV_LABEL_LONG_DOT);
-    if (fonts.list_item_label) {
-        lv_obj_set_style_text_font(widgets.label, fonts.list_item_label, LV_STATE_DEFAULT);
-    }
+    lv_obj_set_style_text_font(widgets.label, coreFontOrDefault(fonts.list_item_label), LV_STATE_DEFAULT);
+    addHighlightStyles(widgets.label, HighlightRole::Label);
 
     widgets.created = true;
+    noteSlotRowBuilt(widgets.row);
+    MS_UI_PERF_OBJECTS(SelectorOverlay, widgets.row);
 }
 
 FLASHMEM void VirtualListSelectorOverlay::applyHighlightStyle(SlotWidgets& widgets, bool isSelected) {
@@ -207,22 +252,9 @@ FLASHMEM void VirtualListSelectorOverlay::applyHighlightStyle(SlotWidgets& widge
         return;
     }
 
-    if (widgets.label) {
-        style::apply(widgets.label).textColor(
-            isSelected
-                ? base_theme::color::TEXT_PRIMARY
-                : (current_props_.dimUnselected
-                       ? base_theme::color::INACTIVE
-                       : base_theme::color::TEXT_SECONDARY));
-    }
-    if (widgets.indexLabel) {
-        style::apply(widgets.indexLabel).textColor(
-            isSelected
-                ? base_theme::color::ACTIVE
-                : (current_props_.dimUnselected
-                       ? base_theme::color::INACTIVE
-                       : base_theme::color::INACTIVE_LIGHTER));
-    }
+    // Shared styles pick the colors; only the state bits change here.
+    setHighlightState(widgets.label, isSelected, current_props_.dimUnselected);
+    setHighlightState(widgets.indexLabel, isSelected, current_props_.dimUnselected);
 
     widgets.highlighted = isSelected;
     widgets.dimUnselected = current_props_.dimUnselected;
@@ -14,6 +14,11 @@
 #include <oc/ui/lvgl/widget/VirtualList.hpp>
 
 #include <ms/ui/component/VirtualListOverlay.hpp>
+#include <ms/ui/text/TextCache.hpp>
+#include <ms/ui/widget/CoalescedSelection.hpp>
+#include <ms/ui/widget/SlotMemoryPolicy.hpp>
+#include <ms/ui/widget/SlotRowDock.hpp>
+#include <ms/ui/widget/VirtualSlotRing.hpp>
 
 namespace ms::ui {
 
@@ -52,14 +57,9 @@ public:
 
 private:
     static constexpr int VISIBLE_SLOTS = 5;
-    static constexpr size_t TEXT_CACHE_SIZE = 48;
-
-    struct TextCache {
-        char text[TEXT_CACHE_SIZE] = {};
-    };
-
     struct SlotWidgets {
         bool created = false;
+        lv_obj_t* row = nullptr;
         lv_obj_t* indexLabel = nullptr;
         lv_obj_t* label = nullptr;
         bool highlighted = false;
@@ -68,19 +68,28 @@ private:
         bool indexVisible = true;
         bool indexVisibilityApplied = false;
         int boundIndex = -1;
-        TextCache indexCache;
-        TextCache labelCache;
+        TextStamp indexCache;
+        TextStamp labelCache;
     };
 
     void bindSlot(oc::ui::lvgl::widget::VirtualSlot& slot, int index, bool isSelected);
     void updateSlotHighlight(oc::ui::lvgl::widget::VirtualSlot& slot, bool isSelected);
-    void ensureSlotWidgets(lv_obj_t* container, int slotIndex);
+    void ensureSlotWidgets(lv_obj_t* container, std::size_t rowIndex);
+    void releaseRows();
     void applyHighlightStyle(SlotWidgets& widgets, bool isSelected);
-    static bool copyTextIfChanged(TextCache& cache, const char* text);
-    static void setLabelTextIfChanged(lv_obj_t* label, TextCache& cache, const char* text);
+    static void setLabelTextIfChanged(lv_obj_t* label, TextStamp& cache, const char* text);
+    static void commitSelection(void* context, int index);
+    // Rows built before staged font loading finished hold the fallback
+    // font: re-applied once the list item font is ready.
+    void applyFonts();
+    static void onCoreFontsReady(void* context);
 
     VirtualListOverlay overlay_;
+    CoalescedSelection selection_;
+    // Row content is keyed by index % VISIBLE_SLOTS, not by slot position.
     std::array<SlotWidgets, VISIBLE_SLOTS> slot_widgets_{};
+    VirtualSlotRing<VISIBLE_SLOTS> slot_ring_{};
+    SlotRowDock row_dock_{PerfWidget::SelectorOverlay};
 
     VirtualListSelectorOverlayProps current_props_{};
 
@@ -90,6 +99,7 @@ private:
     bool last_dim_unselected_ = true;
     lv_opa_t last_backdrop_opacity_ = LayoutOverlay::DEFAULT_BACKDROP_OPACITY;
     uint32_t last_data_revision_ = 0;
+    bool rows_released_ = false;
 };
 
 }  // namespace ms::ui
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+namespace ms::ui {
+
+/**
+ * Index-to-row ring for VirtualList slot content.
+ *
+ * VirtualList slots are positional: after a window shift every slot is bound
+ * to a different logical index. Keying the row content by `index % Rows`
+ * instead keeps a row attached to the same index while it stays in the
+ * window, so a one-step shift only exposes one row that needs new content;
+ * the others are re-docked into their new slot with labels, caches and
+ * sparklines intact.
+ */
+template <std::size_t Rows>
+class VirtualSlotRing {
+public:
+    static_assert(Rows > 0U, "Slot ring needs at least one row");
+
+    static constexpr std::size_t rows() { return Rows; }
+
+    [[nodiscard]] static constexpr std::size_t rowFor(int index) {
+        return index >= 0 ? static_cast<std::size_t>(index) % Rows : 0U;
+    }
+
+    /**
+     * Attach index to its row. Returns true when the row content must be
+     * (re)applied, false when the row already shows this index.
+     */
+    bool claim(int index) {
+        if (index < 0) return false;
+        int& bound = bound_[rowFor(index)];
+        if (bound == index) return false;
+        bound = index;
+        return true;
+    }
+
+    [[nodiscard]] bool holds(int index) const {
+        return index >= 0 && bound_[rowFor(index)] == index;
+    }
+
+    /** Force the next claim of index to rebind (row data changed). */
+    void invalidate(int index) {
+        if (holds(index)) bound_[rowFor(index)] = -1;
+    }
+
+    /** Drop rows bound past the end of a shrunk list. */
+    void trim(int count) {
+        for (auto& bound : bound_) {
+            if (bound >= count) bound = -1;
+        }
+    }
+
+    /** Force every row to rebind (style, layout or data source changed). */
+    void reset() {
+        for (auto& bound : bound_) bound = -1;
+    }
+
+private:
+    std::array<int, Rows> bound_ = makeUnbound();
+
+    static constexpr std::array<int, Rows> makeUnbound() {
+        std::array<int, Rows> rows{};
+        for (auto& bound : rows) bound = -1;
+        return rows;
+    }
+};
+
+}  // namespace ms::ui
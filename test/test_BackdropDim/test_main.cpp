@@ -0,0 +1,57 @@
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+
+#include <ms/ui/component/BackdropDim.hpp>
+
+namespace {
+
+using ms::ui::blendRgb565;
+using ms::ui::dimRgb565;
+
+constexpr uint16_t WHITE = 0xFFFFU;
+constexpr uint16_t BLACK = 0x0000U;
+constexpr uint16_t RED = 0xF800U;
+
+void testBlendEndpoints() {
+    assert(blendRgb565(RED, BLACK, 0U) == RED);
+    assert(blendRgb565(RED, BLACK, 255U) == BLACK);
+    assert(blendRgb565(WHITE, RED, 255U) == RED);
+    std::cout << "[PASS] opa 0 keeps the pixel and 255 gives the backdrop color\n";
+}
+
+void testBlendPerChannel() {
+    // Half-way white over black: every channel rounds to its midpoint.
+    const uint16_t half = blendRgb565(BLACK, WHITE, 128U);
+    assert(((half >> 11) & 0x1FU) == 16U);
+    assert(((half >> 5) & 0x3FU) == 32U);
+    assert((half & 0x1FU) == 16U);
+    // 230/255 black leaves a tenth of a full red channel.
+    const uint16_t dimmed = blendRgb565(RED, BLACK, 230U);
+    assert(((dimmed >> 11) & 0x1FU) == 3U);
+    assert((dimmed & 0x07FFU) == 0U);
+    std::cout << "[PASS] channels blend independently with rounding\n";
+}
+
+void testDimRespectsStride() {
+    // 2x2 frame in a 3-pixel pitch; the padding pixel must stay untouched.
+    std::array<uint16_t, 6> frame{WHITE, WHITE, 0x1234U, WHITE, WHITE, 0x1234U};
+    dimRgb565(reinterpret_cast<uint8_t*>(frame.data()), 3U * sizeof(uint16_t), 2U, 2U, BLACK, 255U);
+    assert(frame[0] == BLACK && frame[1] == BLACK && frame[3] == BLACK && frame[4] == BLACK);
+    assert(frame[2] == 0x1234U && frame[5] == 0x1234U);
+
+    dimRgb565(reinterpret_cast<uint8_t*>(frame.data()), 3U * sizeof(uint16_t), 2U, 2U, WHITE, 0U);
+    assert(frame[0] == BLACK);
+    std::cout << "[PASS] dimming covers width x height and honours the row pitch\n";
+}
+
+}  // namespace
+
+int main() {
+    testBlendEndpoints();
+    testBlendPerChannel();
+    testDimRespectsStride();
+    std::cout << "All BackdropDim tests passed\n";
+    return 0;
+}
@@ -0,0 +1,524 @@
+#include <cassert>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#include <ms/ui/font/AsciiGlyphTable.hpp>
+#include <ms/ui/font/BinFont.hpp>
+#include <ms/ui/font/GlyphCache.hpp>
+#include <ms/ui/font/MappedFontFile.hpp>
+
+// Real core font binaries, as linked into the firmware.
+#define PROGMEM
+#include <ms/ui/font/data/interdisplay_bold_13.c.inc>
+#include <ms/ui/font/data/interdisplay_bold_14.c.inc>
+#include <ms/ui/font/data/interdisplay_bold_20.c.inc>
+#include <ms/ui/font/data/interdisplay_light_14.c.inc>
+#include <ms/ui/font/data/interdisplay_medium_12.c.inc>
+#include <ms/ui/font/data/interdisplay_medium_13.c.inc>
+#include <ms/ui/font/data/interdisplay_medium_14.c.inc>
+#include <ms/ui/font/data/interdisplay_regular_14.c.inc>
+#include <ms/ui/font/data/interdisplay_semibold_14.c.inc>
+#include <ms/ui/font/data/jetbrainsmononl_medium_13.c.inc>
+
+namespace {
+
+struct FontBlob {
+    const char* name;
+    const uint8_t* data;
+    uint32_t size;
+    uint16_t fontSize;
+};
+
+const FontBlob FONTS[] = {
+    {"bold_13", interdisplay_bold_13_bin, interdisplay_bold_13_bin_len, 13},
+    {"bold_14", interdisplay_bold_14_bin, interdisplay_bold_14_bin_len, 14},
+    {"bold_20", interdisplay_bold_20_bin, interdisplay_bold_20_bin_len, 20},
+    {"light_14", interdisplay_light_14_bin, interdisplay_light_14_bin_len, 14},
+    {"medium_12", interdisplay_medium_12_bin, interdisplay_medium_12_bin_len, 12},
+    {"medium_13", interdisplay_medium_13_bin, interdisplay_medium_13_bin_len, 13},
+    {"medium_14", interdisplay_medium_14_bin, interdisplay_medium_14_bin_len, 14},
+    {"regular_14", interdisplay_regular_14_bin, interdisplay_regular_14_bin_len, 14},
+    {"semibold_14", interdisplay_semibold_14_bin, interdisplay_semibold_14_bin_len, 14},
+    {"mono_13", jetbrainsmononl_medium_13_bin, jetbrainsmononl_medium_13_bin_len, 13},
+};
+
+void testEveryCoreFontMapsInPlace() {
+    for (const auto& blob : FONTS) {
+        ms::ui::BinFontView view{};
+        assert(view.parse(blob.data, blob.size));
+        assert(view.info().fontSize == blob.fontSize);
+        assert(view.info().bpp == 4U);
+        assert(view.info().lineHeight() > blob.fontSize);
+
+        // Every glyph expands within its own bit range.
+        std::array<uint8_t, 512> bitmap{};
+        ms::ui::BinGlyph glyph{};
+        for (uint32_t id = 1U; id < view.info().glyphCount; ++id) {
+            assert(view.glyph(id, glyph));
+            assert(glyph.area() <= view.info().maxGlyphArea);
+            assert(view.decodeA8(glyph, bitmap.data(), glyph.width, bitmap.size()));
+        }
+    }
+    std::cout << "[PASS] all core fonts parse and decode in place\n";
+}
+
+void testCmapLookup() {
+    ms::ui::BinFontView view{};
+    assert(view.parse(interdisplay_bold_20_bin, interdisplay_bold_20_bin_len));
+    // ASCII starts at glyph 1; the Latin-1 ranges follow.
+    assert(view.glyphIndex(' ') == 1U);
+    assert(view.glyphIndex('A') == 34U);
+    assert(view.glyphIndex('~') == 95U);
+    assert(view.glyphIndex(0xE9U) != 0U);  // e acute
+    assert(view.glyphIndex(0x7FU) == 0U);
+    assert(view.glyphIndex(0x4E2DU) == 0U);
+    std::cout << "[PASS] cmap resolves covered and missing codepoints\n";
+}
+
+void testGlyphMetricsAndBitmap() {
+    ms::ui::BinFontView view{};
+    assert(view.parse(interdisplay_bold_20_bin, interdisplay_bold_20_bin_len));
+    ms::ui::BinGlyph glyph{};
+    assert(view.glyph(view.glyphIndex('A'), glyph));
+    assert(glyph.advance16 == 14U * 16U);
+    assert(glyph.width == 15U && glyph.height == 15U);
+    assert(glyph.offsetX == 0 && glyph.offsetY == 0);
+
+    std::array<uint8_t, 15 * 15> bitmap{};
+    assert(view.decodeA8(glyph, bitmap.data(), 15U, bitmap.size()));
+    // Apex on top, both legs solid on the baseline row, open counter.
+    assert(bitmap[0] == 0U && bitmap[7] >= 0x80U);
+    assert(bitmap[14 * 15 + 0] >= 0x80U && bitmap[14 * 15 + 13] >= 0x80U);
+    assert(bitmap[14 * 15 + 7] == 0U && bitmap[14 * 15 + 14] == 0U);
+
+    // Descender: 'g' sits below the baseline.
+    assert(view.glyph(view.glyphIndex('g'), glyph));
+    assert(glyph.offsetY < 0);
+
+    // Strided output leaves the padding untouched.
+    assert(view.glyph(view.glyphIndex('A'), glyph));
+    std::array<uint8_t, 16 * 15> strided{};
+    strided.fill(0xAAU);
+    assert(view.decodeA8(glyph, strided.data(), 16U, strided.size()));
+    assert(strided[15] == 0xAAU && strided[16 + 7] == bitmap[15 + 7]);
+    assert(!view.decodeA8(glyph, strided.data(), 16U, 100U));
+    std::cout << "[PASS] glyph metrics and A8 bitmap match the source font\n";
+}
+
+void testMonospaceDefaultAdvance() {
+    ms::ui::BinFontView view{};
+    assert(view.parse(jetbrainsmononl_medium_13_bin, jetbrainsmononl_medium_13_bin_len));
+    ms::ui::BinGlyph narrow{};
+    ms::ui::BinGlyph wide{};
+    assert(view.glyph(view.glyphIndex('i'), narrow));
+    assert(view.glyph(view.glyphIndex('W'), wide));
+    // No per-glyph advance bits: every glyph uses the head default.
+    assert(narrow.advance16 == wide.advance16 && narrow.advance16 > 0U);
+    std::cout << "[PASS] monospace font uses the default advance\n";
+}
+
+void testRejectsMalformedData() {
+    ms::ui::BinFontView view{};
+    assert(!view.parse(nullptr, 0U));
+    assert(!view.parse(interdisplay_bold_13_bin, 40U));
+    std::array<uint8_t, 7020> copy{};
+    std::memcpy(copy.data(), interdisplay_bold_13_bin, copy.size());
+    copy[8] = 2U;  // unknown head version
+    assert(!view.parse(copy.data(), copy.size()));
+    assert(!view.valid() && view.glyphIndex('A') == 0U);
+    std::cout << "[PASS] malformed blobs are rejected\n";
+}
+
+/**
+ * Reference for the copying path: LVGL's binfont loader reads every glyph
+ * descriptor into RAM and copies each bitmap into a byte-aligned buffer,
+ * then lv_font_fmt_txt decompresses it at draw time. The in-place reader
+ * must produce the same metrics and pixels.
+ */
+class CopyingLoaderReference {
+public:
+    struct Glyph {
+        uint32_t advance16 = 0U;
+        int32_t offsetX = 0;
+        int32_t offsetY = 0;
+        uint32_t width = 0U;
+        uint32_t height = 0U;
+        std::vector<uint8_t> bitmap;
+    };
+
+    explicit CopyingLoaderReference(const uint8_t* data) : data_(data) {
+        uint32_t offset = 0U;
+        const uint32_t headSize = u32(offset);
+        const uint8_t* head = data + 8U;
+        defaultAdvance_ = u16At(head + 22U);
+        advanceFormat_ = head[28];
+        bpp_ = head[29];
+        xyBits_ = head[30];
+        whBits_ = head[31];
+        advanceBits_ = head[32];
+        compression_ = head[33];
+        offset += headSize;
+        offset += u32(offset);  // cmap
+        const uint32_t locaCount = u32(offset + 8U);
+        std::vector<uint32_t> loca(locaCount);
+        for (uint32_t i = 0; i < locaCount; ++i) loca[i] = u16At(data + offset + 12U + i * 2U);
+        offset += u32(offset);
+        const uint32_t glyf = offset;
+        const uint32_t glyfLength = u32(glyf);
+
+        glyphs_.resize(locaCount);
+        const uint32_t nbits = advanceBits_ + 2U * xyBits_ + 2U * whBits_;
+        for (uint32_t i = 1; i < locaCount; ++i) {
+            Glyph& glyph = glyphs_[i];
+            bitPos_ = -1;
+            cursor_ = glyf + loca[i];
+            glyph.advance16 = advanceBits_ == 0U ? defaultAdvance_ : readBits(advanceBits_);
+            if (advanceFormat_ == 0U) glyph.advance16 *= 16U;
+            glyph.offsetX = readSigned(xyBits_);
+            glyph.offsetY = readSigned(xyBits_);
+            glyph.width = readBits(whBits_);
+            glyph.height = readBits(whBits_);
+            const uint32_t next = i + 1U < locaCount ? loca[i + 1U] : glyfLength;
+            const int32_t bmpSize = static_cast<int32_t>(next - loca[i] - nbits / 8U);
+            // Byte copy exactly as the loader does, plus get_bits' look-ahead.
+            std::vector<uint8_t> copy(static_cast<std::size_t>(bmpSize > 0 ? bmpSize : 0) + 2U, 0U);
+            if (bmpSize > 0) {
+                if (nbits % 8U == 0U) {
+                    std::memcpy(copy.data(), data + cursor_, static_cast<std::size_t>(bmpSize));
+                } else {
+                    for (int32_t k = 0; k < bmpSize - 1; ++k) copy[k] = static_cast<uint8_t>(readBits(8U));
+                    copy[bmpSize - 1] = static_cast<uint8_t>(readBits(8U - nbits % 8U) << (nbits % 8U));
+                }
+            }
+            glyph.bitmap = decompress(copy.data(), glyph.width, glyph.height);
+        }
+    }
+
+    const Glyph& glyph(uint32_t id) const { return glyphs_[id]; }
+
+private:
+    uint32_t u32(uint32_t offset) const { return ms::ui::binfont_detail::u32(data_ + offset); }
+    static uint32_t u16At(const uint8_t* p) { return ms::ui::binfont_detail::u16(p); }
+
+    uint32_t readBits(uint32_t count) {
+        uint32_t value = 0U;
+        while (count--) {
+            byte_ = static_cast<uint8_t>(byte_ << 1);
+            if (--bitPos_ < 0) {
+                bitPos_ = 7;
+                byte_ = data_[cursor_++];
+            }
+            value |= ((byte_ & 0x80U) ? 1U : 0U) << count;
+        }
+        return value;
+    }
+
+    int32_t readSigned(uint32_t count) {
+        const uint32_t value = readBits(count);
+        return (value & (1U << (count - 1U))) ? static_cast<int32_t>(value) - (1 << count)
+                                              : static_cast<int32_t>(value);
+    }
+
+    // lv_font_fmt_txt.c get_bits / rle_next / decompress, 4 bpp -> A8.
+    static uint8_t getBits(const uint8_t* in, uint32_t bit, uint8_t len) {
+        const uint8_t mask = static_cast<uint8_t>((1U << len) - 1U);
+        const uint32_t byte = bit >> 3;
+        bit &= 7U;
+        if (bit + len >= 8U) {
+            const uint16_t in16 = static_cast<uint16_t>((in[byte] << 8) + in[byte + 1U]);
+            return static_cast<uint8_t>((in16 >> (16U - bit - len)) & mask);
+        }
+        return static_cast<uint8_t>((in[byte] >> (8U - bit - len)) & mask);
+    }
+
+    std::vector<uint8_t> decompress(const uint8_t* in, uint32_t w, uint32_t h) const {
+        std::vector<uint8_t> out(w * h, 0U);
+        uint32_t rdp = 0U;
+        uint8_t previous = 0U;
+        uint32_t count = 0U;
+        int state = 0;
+        auto next = [&]() -> uint8_t {
+            uint8_t ret = 0U;
+            if (compression_ == 0U) {
+                ret = getBits(in, rdp, bpp_);
+                rdp += bpp_;
+            } else if (state == 0) {
+                ret = getBits(in, rdp, bpp_);
+                if (rdp != 0U && previous == ret) {
+                    count = 0U;
+                    state = 1;
+                }
+                previous = ret;
+                rdp += bpp_;
+            } else if (state == 1) {
+                const uint8_t v = getBits(in, rdp, 1U);
+                ++count;
+                ++rdp;
+                if (v == 1U) {
+                    ret = previous;
+                    if (count == 11U) {
+                        count = getBits(in, rdp, 6U);
+                        rdp += 6U;
+                        if (count != 0U) {
+                            state = 2;
+                        } else {
+                            ret = getBits(in, rdp, bpp_);
+                            previous = ret;
+                            rdp += bpp_;
+                            state = 0;
+                        }
+                    }
+                } else {
+                    ret = getBits(in, rdp, bpp_);
+                    previous = ret;
+                    rdp += bpp_;
+                    state = 0;
+                }
+            } else {
+                ret = previous;
+                if (--count == 0U) {
+                    ret = getBits(in, rdp, bpp_);
+                    previous = ret;
+                    rdp += bpp_;
+                    state = 0;
+                }
+            }
+            return ret;
+        };
+        std::vector<uint8_t> line(w, 0U);
+        for (uint32_t y = 0; y < h; ++y) {
+            for (uint32_t x = 0; x < w; ++x) {
+                const uint8_t value = next();
+                line[x] = (compression_ == 1U && y > 0U) ? static_cast<uint8_t>(line[x] ^ value) : value;
+                out[y * w + x] = static_cast<uint8_t>(line[x] * 17U);  // LVGL opa4 table
+            }
+        }
+        return out;
+    }
+
+    const uint8_t* data_;
+    uint32_t cursor_ = 0U;
+    int32_t bitPos_ = -1;
+    uint8_t byte_ = 0U;
+    uint16_t defaultAdvance_ = 0U;
+    uint8_t advanceFormat_ = 0U;
+    uint8_t bpp_ = 0U;
+    uint8_t xyBits_ = 0U;
+    uint8_t whBits_ = 0U;
+    uint8_t advanceBits_ = 0U;
+    uint8_t compression_ = 0U;
+    std::vector<Glyph> glyphs_;
+};
+
+void expectMatchesCopyingLoader(const ms::ui::BinFontView& view, const uint8_t* data) {
+    const CopyingLoaderReference reference(data);
+    std::array<uint8_t, 512> bitmap{};
+    ms::ui::BinGlyph glyph{};
+    for (uint32_t id = 1U; id < view.info().glyphCount; ++id) {
+        const auto& expected = reference.glyph(id);
+        assert(view.glyph(id, glyph));
+        assert(glyph.advance16 == expected.advance16);
+        assert(glyph.offsetX == expected.offsetX && glyph.offsetY == expected.offsetY);
+        assert(glyph.width == expected.width && glyph.height == expected.height);
+        assert(view.decodeA8(glyph, bitmap.data(), glyph.width, bitmap.size()));
+        assert(std::memcmp(bitmap.data(), expected.bitmap.data(), glyph.area()) == 0);
+    }
+}
+
+void testInPlaceMatchesCopyingLoader() {
+    for (const auto& blob : FONTS) {
+        ms::ui::BinFontView view{};
+        assert(view.parse(blob.data, blob.size));
+        expectMatchesCopyingLoader(view, blob.data);
+    }
+    std::cout << "[PASS] in-place glyphs match the copying loader for every core font\n";
+}
+
+void testMappedFileMatchesProgmem() {
+#if MS_UI_HAS_MMAP
+    char path[] = "/tmp/ms_ui_binfont_XXXXXX";
+    const int fd = mkstemp(path);
+    assert(fd >= 0);
+    FILE* file = fdopen(fd, "wb");
+    assert(file != nullptr);
+    assert(std::fwrite(interdisplay_medium_14_bin, 1U, interdisplay_medium_14_bin_len, file) ==
+           interdisplay_medium_14_bin_len);
+    std::fclose(file);
+
+    ms::ui::MappedFontFile mapped{};
+    assert(mapped.open(path));
+    assert(mapped.size() == interdisplay_medium_14_bin_len);
+    ms::ui::BinFontView view{};
+    assert(view.parse(mapped.data(), mapped.size()));
+    expectMatchesCopyingLoader(view, interdisplay_medium_14_bin);
+    mapped.close();
+    std::remove(path);
+    assert(!mapped.open(path));
+    std::cout << "[PASS] mmap-backed font reads the same glyphs as PROGMEM\n";
+#else
+    std::cout << "[PASS] mmap unavailable on this host (skipped)\n";
+#endif
+}
+
+using Cache = ms::ui::GlyphCache<4U, 16U>;
+
+void testGlyphCacheLru() {
+    Cache cache{};
+    for (uint32_t glyph = 1U; glyph <= 4U; ++glyph) {
+        assert(cache.find(Cache::key(0, glyph)) == nullptr);
+        cache.insert(Cache::key(0, glyph))[0] = static_cast<uint8_t>(glyph);
+    }
+    // Touch glyph 1 so glyph 2 becomes the eviction victim.
+    assert(cache.find(Cache::key(0, 1U))[0] == 1U);
+    cache.insert(Cache::key(0, 5U))[0] = 5U;
+    assert(cache.find(Cache::key(0, 2U)) == nullptr);
+    assert(cache.find(Cache::key(0, 1U)) != nullptr);
+    assert(cache.find(Cache::key(0, 5U))[0] == 5U);
+
+    const auto stats = cache.stats();
+    assert(stats.hits == 3U && stats.misses == 5U);
+    assert(stats.evictions == 1U && stats.liveSlots == 4U);
+    std::cout << "[PASS] glyph cache evicts the least recently used slot\n";
+}
+
+void testGlyphCacheEraseFont() {
+    Cache cache{};
+    cache.insert(Cache::key(1, 10U));
+    cache.insert(Cache::key(2, 10U));
+    cache.insert(Cache::key(1, 11U));
+    cache.eraseFont(1);
+    assert(cache.stats().liveSlots == 1U);
+    assert(cache.find(Cache::key(1, 10U)) == nullptr);
+    assert(cache.find(Cache::key(2, 10U)) != nullptr);
+    // Freed slots are reused before anything is evicted.
+    cache.insert(Cache::key(3, 1U));
+    cache.insert(Cache::key(3, 2U));
+    cache.insert(Cache::key(3, 3U));
+    assert(cache.stats().evictions == 0U);
+    cache.erase(Cache::key(3, 2U));
+    assert(cache.find(Cache::key(3, 2U)) == nullptr);
+    assert(cache.stats().liveSlots == 3U);
+    std::cout << "[PASS] unmapping a font frees only its slots\n";
+}
+
+void testWorkingSetFitsCache() {
+    // The default 208-byte slot holds every glyph of the 12-14 px fonts.
+    for (const auto& blob : FONTS) {
+        ms::ui::BinFontView view{};
+        assert(view.parse(blob.data, blob.size));
+        if (blob.fontSize <= 14U) assert(view.info().maxGlyphArea <= 208U);
+    }
+    std::cout << "[PASS] body fonts fit the default glyph slot\n";
+}
+
+void testAsciiTableMatchesView() {
+    for (const auto& blob : FONTS) {
+        ms::ui::BinFontView view{};
+        assert(view.parse(blob.data, blob.size));
+        ms::ui::AsciiGlyphTable table{};
+        assert(table.build(view));
+        for (uint32_t codepoint = 0x20U; codepoint <= 0x7EU; ++codepoint) {
+            ms::ui::BinGlyph expected{};
+            ms::ui::BinGlyph cached{};
+            const uint32_t id = view.glyphIndex(codepoint);
+            assert(view.glyph(id, expected));
+            assert(table.find(codepoint, cached) == id);
+            assert(cached.advance16 == expected.advance16);
+            assert(cached.offsetX == expected.offsetX && cached.offsetY == expected.offsetY);
+            assert(cached.width == expected.width && cached.height == expected.height);
+            assert(cached.bitmapBit == expected.bitmapBit);
+            assert(cached.bitmapBitEnd == expected.bitmapBitEnd);
+        }
+        ms::ui::BinGlyph untouched{};
+        assert(table.find(0x7FU, untouched) == 0U && table.find(0xE9U, untouched) == 0U);
+        assert(table.find(0x1FU, untouched) == 0U);
+    }
+
+    ms::ui::AsciiGlyphTable empty{};
+    ms::ui::BinGlyph glyph{};
+    assert(!empty.build(ms::ui::BinFontView{}) && !empty.built());
+    assert(empty.find('A', glyph) == 0U);
+    std::cout << "[PASS] ascii table matches cmap + glyf for every core font ("
+              << ms::ui::AsciiGlyphTable::bytes() << " B/font)\n";
+}
+
+// Row label width as lv_text_get_width sums it: rounded advance per glyph.
+int32_t widthViaView(const ms::ui::BinFontView& view, const char* text) {
+    int32_t width = 0;
+    ms::ui::BinGlyph glyph{};
+    for (const char* p = text; *p; ++p) {
+        const uint32_t id = view.glyphIndex(static_cast<uint8_t>(*p));
+        if (id != 0U && view.glyph(id, glyph)) width += static_cast<int32_t>((glyph.advance16 + 8U) >> 4);
+    }
+    return width;
+}
+
+int32_t widthViaTable(const ms::ui::AsciiGlyphTable& table, const char* text) {
+    int32_t width = 0;
+    ms::ui::BinGlyph glyph{};
+    for (const char* p = text; *p; ++p) {
+        if (table.find(static_cast<uint8_t>(*p), glyph) != 0U) {
+            width += static_cast<int32_t>((glyph.advance16 + 8U) >> 4);
+        }
+    }
+    return width;
+}
+
+void benchmarkRowTextWidth() {
+    // 48-byte list rows: label, padding, value.
+    const char* const ROWS[] = {
+        "Filter Cutoff Frequency                 12.5 kHz",
+        "Envelope 2 Release Time (Amp)            1840 ms",
+        "LFO Rate Sync Division                    1/16 T",
+        "Oscillator B Fine Tune Offset           -12 cent",
+    };
+    for (const char* row : ROWS) assert(std::strlen(row) == 48U);
+
+    ms::ui::BinFontView view{};
+    assert(view.parse(interdisplay_semibold_14_bin, interdisplay_semibold_14_bin_len));
+    ms::ui::AsciiGlyphTable table{};
+    assert(table.build(view));
+    for (const char* row : ROWS) assert(widthViaView(view, row) == widthViaTable(table, row));
+
+    constexpr int ITERATIONS = 20000;
+    using Clock = std::chrono::steady_clock;
+    volatile int32_t sink = 0;
+    auto measure = [&](auto&& width) {
+        const auto begin = Clock::now();
+        for (int i = 0; i < ITERATIONS; ++i) {
+            for (const char* row : ROWS) sink = sink + width(row);
+        }
+        const auto elapsed = std::chrono::duration<double, std::nano>(Clock::now() - begin);
+        return elapsed.count() / (ITERATIONS * 4.0);
+    };
+    const double before = measure([&](const char* row) { return widthViaView(view, row); });
+    const double after = measure([&](const char* row) { return widthViaTable(table, row); });
+    (void)sink;
+    std::cout << "[PASS] 48-byte row width: cmap+glyf " << static_cast<int>(before)
+              << " ns, ascii table " << static_cast<int>(after) << " ns\n";
+}
+
+}  // namespace
+
+int main() {
+    testEveryCoreFontMapsInPlace();
+    testCmapLookup();
+    testGlyphMetricsAndBitmap();
+    testMonospaceDefaultAdvance();
+    testInPlaceMatchesCopyingLoader();
+    testMappedFileMatchesProgmem();
+    testRejectsMalformedData();
+    testGlyphCacheLru();
+    testGlyphCacheEraseFont();
+    testWorkingSetFitsCache();
+    testAsciiTableMatchesView();
+    benchmarkRowTextWidth();
+    std::cout << "All BinFont tests passed\n";
+    return 0;
+}
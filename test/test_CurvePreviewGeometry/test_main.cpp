@@ -158,6 +158,152 @@ void testRejectedSamplingClearsGeometry() {
     std::cout << "[PASS] invalid or rejected sampling cannot leave stale geometry\n";
 }
 
+void testReducedDensityKeepsEndpoints() {
+    using ms::ui::curvePreviewSampleCountForWidth;
+    assert(curvePreviewSampleCountForWidth(320, 1U) == 161U);
+    assert(curvePreviewSampleCountForWidth(320, 2U) == 81U);
+    assert(curvePreviewSampleCountForWidth(304, 1U) == 153U);
+    assert(curvePreviewSampleCountForWidth(304, 2U) == 77U);
+    assert(curvePreviewSampleCountForWidth(320, 7U) == 81U);
+    assert(curvePreviewSampleCountForWidth(2, 1U) == 2U);
+    assert(curvePreviewSampleCountForWidth(3, 2U) == 2U);
+    assert(curvePreviewSampleCountForWidth(1, 2U) == 0U);
+
+    ms::ui::CurvePreviewGeometry geometry{};
+    SampleContext context{};
+    assert(geometry.rebuild(304, 92, sampleRamp, &context, 2U));
+    assert(geometry.sampleCount == 77U);
+    assert(context.calls == 77U);
+    assert(geometry.curve.front() == 0U);
+    assert(geometry.curve[76] == 65535U);
+    assert(geometry.discontinuities.count() == 1U);
+    // The end columns stay pinned to the surface edges.
+    assert(ms::ui::curvePreviewCoordinate(
+        ms::ui::curvePreviewPositionQ16(76U, 77U),
+        8,
+        304
+    ) == 311);
+
+    ms::ui::CurvePreviewDamage damage{};
+    SampleContext same{};
+    assert(geometry.rebuildWithDamage(
+        304, 92, sampleRamp, &same, true, damage, 2U
+    ));
+    assert(same.calls == 77U);
+    assert(damage.changedSampleCount == 0U);
+    // A density change is a full rebuild: nothing is sampled or damaged.
+    SampleContext finer{};
+    assert(!geometry.rebuildWithDamage(
+        304, 92, sampleRamp, &finer, true, damage, 1U
+    ));
+    assert(finer.calls == 0U);
+    assert(geometry.sampleCount == 77U);
+    std::cout << "[PASS] reduced density samples fewer columns and keeps both ends\n";
+}
+
+void testQualityGovernorDropsAndRestores() {
+    ms::ui::CurvePreviewQualityGovernor governor{};
+    governor.configure({.budgetUs = 8000U, .restoreAfterMs = 250U});
+    assert(governor.densityShift() == 0U);
+
+    governor.observe(6000U, 0U);
+    assert(governor.densityShift() == 0U);
+    assert(!governor.restoreDue(1000U));
+
+    // 12 ms at full density fits once halved.
+    governor.observe(12000U, 10U);
+    assert(governor.densityShift() == 1U);
+    // Far over budget: never coarser than quarter density.
+    governor.observe(100000U, 20U);
+    assert(governor.densityShift() == 2U);
+    assert(!governor.restoreDue(269U));
+    assert(governor.restoreDue(270U));
+
+    // The finer level would not fit three quarters of the budget: hold.
+    governor.observe(4000U, 100U);
+    assert(governor.densityShift() == 2U);
+    assert(!governor.restoreDue(349U));
+    assert(governor.restoreDue(350U));
+
+    // Restore steps one level at a time, each after its own quiet period.
+    governor.restore(350U);
+    assert(governor.densityShift() == 1U);
+    governor.observe(2000U, 400U);
+    assert(!governor.restoreDue(599U));
+    assert(governor.restoreDue(600U));
+    governor.restore(600U);
+    assert(governor.densityShift() == 0U);
+    assert(!governor.restoreDue(10000U));
+    governor.restore(10000U);
+    assert(governor.densityShift() == 0U);
+
+    // The quiet period survives the millisecond tick wrapping.
+    governor.observe(20000U, 0xFFFFFF00U);
+    assert(governor.densityShift() == 2U);
+    assert(!governor.restoreDue(0x00000010U - 30U));
+    assert(governor.restoreDue(0x00000010U));
+
+    governor.reset();
+    assert(governor.densityShift() == 0U);
+    std::cout << "[PASS] quality governor drops under pressure and restores progressively\n";
+}
+
+void testQualityGovernorWithoutBudget() {
+    ms::ui::CurvePreviewQualityGovernor governor{};
+    governor.observe(1000000U, 0U);
+    assert(governor.densityShift() == 0U);
+
+    governor.configure({.budgetUs = 1000U, .restoreAfterMs = 250U});
+    governor.observe(3000U, 0U);
+    assert(governor.densityShift() == 2U);
+    // Dropping the budget returns to full density at once.
+    governor.configure({.budgetUs = 0U, .restoreAfterMs = 250U});
+    assert(governor.densityShift() == 0U);
+    assert(!governor.restoreDue(1000U));
+    std::cout << "[PASS] a zero budget always samples at full density\n";
+}
+
+void testRollingTraceRecoversFullDensity() {
+    using ms::ui::CurvePreviewGeometryUpdate;
+    constexpr int32_t WIDTH = 304;
+    constexpr uint32_t COST_PER_SAMPLE_US = 50U;
+    ms::ui::CurvePreviewQualityGovernor governor{};
+    governor.configure({.budgetUs = 8000U, .restoreAfterMs = 250U});
+    ms::ui::CurvePreviewGeometry geometry{};
+    SampleContext context{};
+
+    // One slow authored rebuild drops the governor to quarter density.
+    governor.observe(20000U, 0U);
+    assert(governor.densityShift() == 2U);
+    assert(geometry.rebuild(WIDTH, 92, sampleRamp, &context, governor.densityShift()));
+    assert(geometry.sampleCount == 77U);
+    // Rolling updates ignore the level: they need one sample per pixel.
+    assert(ms::ui::curvePreviewDensityShiftFor(
+               CurvePreviewGeometryUpdate::ADVANCE, governor.densityShift()) == 0U);
+    assert(ms::ui::curvePreviewDensityShiftFor(
+               CurvePreviewGeometryUpdate::REBUILD, governor.densityShift()) == 2U);
+
+    // CurvePreviewWidget's ADVANCE path: rebuild once per pixel when the
+    // geometry is coarser, then shift and sample only the new column.
+    std::size_t rebuilds = 0U;
+    for (uint32_t now = 10U; now <= 1000U; now += 10U) {
+        context.calls = 0U;
+        if (geometry.sampleCount != ms::ui::curvePreviewSampleCountForWidth(WIDTH)) {
+            ++rebuilds;
+            assert(geometry.rebuild(WIDTH, 92, sampleRamp, &context, 0U));
+        } else {
+            assert(geometry.advance(1U, sampleRamp, &context));
+            assert(context.calls == 1U);
+        }
+        governor.observe(static_cast<uint32_t>(context.calls) * COST_PER_SAMPLE_US, now);
+        if (now % 50U == 0U && governor.restoreDue(now)) governor.restore(now);
+    }
+    assert(rebuilds == 1U);
+    assert(geometry.sampleCount == static_cast<uint16_t>(WIDTH));
+    assert(governor.densityShift() == 0U);
+    std::cout << "[PASS] a rolling trace advances at full density and the governor recovers\n";
+}
+
 void testRollingGeometryTouchesOnlyExposedColumns() {
     ms::ui::CurvePreviewGeometry geometry{};
     RollingContext context{};
@@ -428,7 +574,11 @@ int main() {
     testNormalizedMappingAndGuides();
     testGeometryAndDiscontinuity();
     testRejectedSamplingClearsGeometry();
+    testReducedDensityKeepsEndpoints();
+    testQualityGovernorDropsAndRestores();
+    testQualityGovernorWithoutBudget();
     testRollingGeometryTouchesOnlyExposedColumns();
+    testRollingTraceRecoversFullDensity();
     testAuthoredRebuildReportsBoundedDamage();
     testAmplitudeDamageDoesNotSpanUnchangedBase();
     testRejectedDamageRebuildClearsGeometry();
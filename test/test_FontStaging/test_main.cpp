@@ -0,0 +1,134 @@
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+
+#include <ms/ui/font/FontStaging.hpp>
+
+namespace {
+
+// Mirrors the core table: 0-1 splash, 2 Medium12, 3 Medium13, 4 Bold13,
+// 5 Light, 6 Regular, 7 Medium, 8 SemiBold, 9 Bold.
+constexpr std::size_t FONT_COUNT = 10U;
+enum Alias : uint8_t { PARAMETER_LABEL, PARAMETER_VALUE_LABEL, TEMPO_LABEL, LIST_ITEM_LABEL, ALIAS_COUNT };
+constexpr uint8_t ALIAS_FONTS[ALIAS_COUNT] = {6U, 7U, 8U, 8U};
+
+constexpr ms::ui::FontAliasMask bit(Alias alias) { return ms::ui::FontAliasMask{1} << alias; }
+
+void testFirstScreenFontsLoadFirst() {
+    bool loaded[FONT_COUNT] = {true, true};
+    const uint8_t wanted[] = {LIST_ITEM_LABEL, PARAMETER_LABEL, TEMPO_LABEL};
+    uint8_t order[FONT_COUNT] = {};
+    const std::size_t count =
+        ms::ui::planFontLoadOrder(ALIAS_FONTS, ALIAS_COUNT, wanted, 3U, loaded, FONT_COUNT, order);
+
+    // SemiBold once (list + tempo share it), then Regular, then table order.
+    const uint8_t expected[] = {8U, 6U, 2U, 3U, 4U, 5U, 7U, 9U};
+    assert(count == sizeof(expected));
+    for (std::size_t i = 0; i < count; ++i) assert(order[i] == expected[i]);
+    std::cout << "[PASS] first-screen aliases decide the load order\n";
+}
+
+void testLoadedFontsAreSkipped() {
+    bool loaded[FONT_COUNT] = {true, true, true, true, true, true, true, true, true, true};
+    loaded[7] = false;
+    const uint8_t wanted[] = {PARAMETER_VALUE_LABEL, 0xEEU};
+    uint8_t order[FONT_COUNT] = {};
+    assert(ms::ui::planFontLoadOrder(ALIAS_FONTS, ALIAS_COUNT, wanted, 2U, loaded, FONT_COUNT, order) == 1U);
+    assert(order[0] == 7U);
+
+    loaded[7] = true;
+    assert(ms::ui::planFontLoadOrder(ALIAS_FONTS, ALIAS_COUNT, nullptr, 0U, loaded, FONT_COUNT, order) == 0U);
+    std::cout << "[PASS] loaded fonts and unknown aliases are skipped\n";
+}
+
+void testReadyAliasesFollowBackingFonts() {
+    bool loaded[FONT_COUNT] = {};
+    assert(ms::ui::readyFontAliases(ALIAS_FONTS, ALIAS_COUNT, loaded, FONT_COUNT) == 0U);
+    loaded[8] = true;
+    assert(ms::ui::readyFontAliases(ALIAS_FONTS, ALIAS_COUNT, loaded, FONT_COUNT) ==
+           (bit(TEMPO_LABEL) | bit(LIST_ITEM_LABEL)));
+    const uint8_t unbacked[] = {ms::ui::NO_FONT_INDEX};
+    assert(ms::ui::readyFontAliases(unbacked, 1U, loaded, FONT_COUNT) == 0U);
+    std::cout << "[PASS] aliases become ready with their backing font\n";
+}
+
+struct Widget {
+    int applied = 0;
+};
+
+void onReady(void* context) { ++static_cast<Widget*>(context)->applied; }
+
+void testCallbacksFireOnceWhenSetIsComplete() {
+    ms::ui::FontReadiness<4U> readiness{};
+    Widget list{};
+    Widget editor{};
+    assert(readiness.whenReady(bit(LIST_ITEM_LABEL), onReady, &list));
+    assert(readiness.whenReady(bit(PARAMETER_LABEL) | bit(PARAMETER_VALUE_LABEL), onReady, &editor));
+    assert(readiness.waiting() == 2U);
+
+    readiness.markReady(bit(LIST_ITEM_LABEL) | bit(PARAMETER_LABEL));
+    assert(list.applied == 1 && editor.applied == 0);
+    readiness.markReady(bit(PARAMETER_VALUE_LABEL));
+    assert(editor.applied == 1);
+    readiness.markReady(bit(TEMPO_LABEL));
+    assert(list.applied == 1 && editor.applied == 1);
+    assert(readiness.waiting() == 0U);
+
+    // Already ready: runs inline, nothing is queued.
+    assert(readiness.whenReady(bit(LIST_ITEM_LABEL), onReady, &list));
+    assert(list.applied == 2 && readiness.waiting() == 0U);
+    std::cout << "[PASS] readiness callbacks fire once per complete alias set\n";
+}
+
+void testCancelAndCapacity() {
+    ms::ui::FontReadiness<2U> readiness{};
+    Widget a{};
+    Widget b{};
+    Widget c{};
+    assert(readiness.whenReady(bit(TEMPO_LABEL), onReady, &a));
+    assert(readiness.whenReady(bit(TEMPO_LABEL), onReady, &b));
+    assert(!readiness.whenReady(bit(TEMPO_LABEL), onReady, &c));
+    assert(!readiness.whenReady(bit(TEMPO_LABEL), nullptr, &c));
+
+    readiness.cancel(&a);
+    assert(readiness.whenReady(bit(TEMPO_LABEL), onReady, &c));
+    readiness.markReady(bit(TEMPO_LABEL));
+    assert(a.applied == 0 && b.applied == 1 && c.applied == 1);
+
+    readiness.reset();
+    assert(readiness.ready() == 0U);
+    std::cout << "[PASS] cancelled widgets are never called back\n";
+}
+
+ms::ui::FontReadiness<1U>* g_reentrant = nullptr;
+Widget g_second{};
+
+void registerAgain(void*) {
+    // The fired slot is free again; a dependent widget can queue itself.
+    assert(g_reentrant->whenReady(bit(PARAMETER_LABEL), onReady, &g_second));
+}
+
+void testCallbackMayRegister() {
+    ms::ui::FontReadiness<1U> readiness{};
+    g_reentrant = &readiness;
+    assert(readiness.whenReady(bit(LIST_ITEM_LABEL), registerAgain, nullptr));
+    readiness.markReady(bit(LIST_ITEM_LABEL));
+    assert(readiness.waiting() == 1U && g_second.applied == 0);
+    readiness.markReady(bit(PARAMETER_LABEL));
+    assert(g_second.applied == 1);
+    std::cout << "[PASS] callbacks may register further waiters\n";
+}
+
+}  // namespace
+
+int main() {
+    testFirstScreenFontsLoadFirst();
+    testLoadedFontsAreSkipped();
+    testReadyAliasesFollowBackingFonts();
+    testCallbacksFireOnceWhenSetIsComplete();
+    testCancelAndCapacity();
+    testCallbackMayRegister();
+    std::cout << "All FontStaging tests passed\n";
+    return 0;
+}
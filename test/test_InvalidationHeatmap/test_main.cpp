@@ -0,0 +1,134 @@
+#include <cassert>
+#include <iostream>
+
+#include <ms/ui/InvalidationHeatmap.hpp>
+
+namespace {
+
+// 320x240 screen, 32x24 cells of 10x10 px.
+using Heatmap = ms::ui::InvalidationHeatmap<32, 24, 8, 3>;
+
+Heatmap makeHeatmap() {
+    Heatmap map;
+    map.configure(320, 240);
+    return map;
+}
+
+void testDisjointRects() {
+    Heatmap map = makeHeatmap();
+    map.record(0, 0, 0, 9, 9);
+    map.record(1, 100, 100, 119, 109);
+    assert(map.endFrame());
+    const auto& frame = map.last();
+    assert(frame.rects == 2U);
+    assert(frame.requestedPx == 100U + 200U);
+    assert(frame.uniquePx == 300U);
+    assert(frame.sourcePx[0] == 100U && frame.sourcePx[1] == 200U && frame.sourcePx[2] == 0U);
+    assert(!frame.truncated);
+    std::cout << "[PASS] disjoint rects: requested equals unique\n";
+}
+
+void testOverlapCountsOnce() {
+    Heatmap map = makeHeatmap();
+    // A row invalidated whole, then its sparkline, then the row again.
+    map.record(0, 0, 0, 99, 19);
+    map.record(1, 60, 0, 99, 19);
+    map.record(0, 0, 0, 99, 19);
+    // Partly outside the row.
+    map.record(2, 90, 10, 109, 29);
+    assert(map.endFrame());
+    const auto& frame = map.last();
+    assert(frame.requestedPx == 2000U + 800U + 2000U + 400U);
+    assert(frame.uniquePx == 2000U + 300U);
+    std::cout << "[PASS] overlapping rects count once in the union\n";
+}
+
+void testClipsToScreen() {
+    Heatmap map = makeHeatmap();
+    map.record(0, -50, -50, 9, 9);
+    map.record(0, 400, 0, 500, 10);
+    assert(map.endFrame());
+    assert(map.last().rects == 1U);
+    assert(map.last().uniquePx == 100U);
+    assert(map.heat(0, 0) == Heatmap::HEAT_STEP);
+    assert(map.heat(1, 0) == 0U);
+    std::cout << "[PASS] rects are clipped to the screen, off-screen ones dropped\n";
+}
+
+void testEmptyFramesKeepLast() {
+    Heatmap map = makeHeatmap();
+    map.record(0, 0, 0, 319, 239);
+    assert(map.endFrame());
+    assert(!map.endFrame());
+    assert(!map.endFrame());
+    assert(map.frames() == 3U);
+    assert(map.last().frame == 1U);
+    assert(map.last().uniquePx == 320U * 240U);
+    assert(map.worst().uniquePx == 320U * 240U);
+    map.record(0, 0, 0, 9, 9);
+    assert(map.endFrame());
+    assert(map.last().frame == 4U && map.last().uniquePx == 100U);
+    assert(map.worst().uniquePx == 320U * 240U);
+    map.resetWorst();
+    assert(map.worst().uniquePx == 0U);
+    std::cout << "[PASS] quiet frames leave last() and worst() alone\n";
+}
+
+void testTruncatedLog() {
+    Heatmap map = makeHeatmap();
+    for (int i = 0; i < 10; ++i) map.record(0, i * 20, 0, i * 20 + 9, 9);
+    assert(map.endFrame());
+    assert(map.last().rects == 10U);
+    assert(map.last().truncated);
+    assert(map.last().requestedPx == 1000U);
+    assert(map.last().uniquePx == 800U);
+    std::cout << "[PASS] frame log overflow is flagged, totals still complete\n";
+}
+
+void testHeatSaturatesAndDecays() {
+    Heatmap map = makeHeatmap();
+    for (int i = 0; i < 8; ++i) map.record(0, 15, 15, 24, 24);
+    // 15..24 touches cells 1 and 2 in both axes.
+    assert(map.heat(1, 1) == 255U && map.heat(2, 2) == 255U);
+    assert(map.heat(0, 0) == 0U && map.heat(3, 3) == 0U);
+
+    const auto bounds = map.warmBounds();
+    assert(bounds.x1 == 10 && bounds.y1 == 10 && bounds.x2 == 29 && bounds.y2 == 29);
+
+    assert(map.decay());
+    assert(map.heat(1, 1) < 255U && map.heat(1, 1) > 128U);
+    int ticks = 1;
+    while (map.decay()) ++ticks;
+    assert(ticks < 20);
+    assert(map.heat(1, 1) == 0U);
+    assert(!map.warmBounds().valid());
+    std::cout << "[PASS] heat saturates, decays to cold within " << ticks + 1 << " ticks\n";
+}
+
+void testCellsTileTheScreen() {
+    ms::ui::InvalidationHeatmap<7, 5, 4, 1> map;
+    map.configure(100, 33);
+    int32_t covered = 0;
+    for (std::size_t row = 0; row < 5; ++row) {
+        for (std::size_t col = 0; col < 7; ++col) {
+            covered += static_cast<int32_t>(map.cell(col, row).pixels());
+        }
+    }
+    assert(covered == 100 * 33);
+    assert(map.cell(6, 4).x2 == 99 && map.cell(6, 4).y2 == 32);
+    std::cout << "[PASS] grid cells tile uneven screens exactly\n";
+}
+
+}  // namespace
+
+int main() {
+    testDisjointRects();
+    testOverlapCountsOnce();
+    testClipsToScreen();
+    testEmptyFramesKeepLast();
+    testTruncatedLog();
+    testHeatSaturatesAndDecays();
+    testCellsTileTheScreen();
+    std::cout << "All InvalidationHeatmap tests passed\n";
+    return 0;
+}
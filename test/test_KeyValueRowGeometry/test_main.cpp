@@ -0,0 +1,82 @@
+#include <cassert>
+#include <iostream>
+
+#include <ms/ui/widget/KeyValueRowGeometry.hpp>
+
+namespace {
+
+void testKeyValueRowColumnsMatchFlexRow() {
+    using namespace ms::ui;
+    constexpr KeyValueRowMetrics wide{16, 8, 16, 78, 110};
+    constexpr KeyValueRowMetrics compact{8, 4, 14, 78, 58};
+
+    // Default style: icon, growing key, value right-aligned to the padding.
+    const auto plain = keyValueRowColumns(wide, 320, false, false);
+    assert((plain[KeyValueRowColumn::Icon] == KeyValueRowSpan{16, 16}));
+    assert((plain[KeyValueRowColumn::Key] == KeyValueRowSpan{40, 146}));
+    assert(!plain[KeyValueRowColumn::Detail].visible());
+    assert((plain[KeyValueRowColumn::Value] == KeyValueRowSpan{194, 110}));
+    assert(!plain[KeyValueRowColumn::Sparkline].visible());
+    assert(plain[KeyValueRowColumn::Value].x + plain[KeyValueRowColumn::Value].width == 320 - 16);
+
+    // Compact facts: the detail column takes its width and one more gap
+    // from the key; the sparkline replaces the value in the same slot.
+    const auto facts = keyValueRowColumns(compact, 320, true, true);
+    assert((facts[KeyValueRowColumn::Icon] == KeyValueRowSpan{8, 14}));
+    assert((facts[KeyValueRowColumn::Key] == KeyValueRowSpan{26, 142}));
+    assert((facts[KeyValueRowColumn::Detail] == KeyValueRowSpan{172, 78}));
+    assert(!facts[KeyValueRowColumn::Value].visible());
+    assert((facts[KeyValueRowColumn::Sparkline] == KeyValueRowSpan{254, 58}));
+    assert(facts[KeyValueRowColumn::Sparkline].x + 58 == 320 - 8);
+
+    // Too narrow for the fixed columns: the key collapses, nothing overlaps.
+    const auto narrow = keyValueRowColumns(wide, 100, false, false);
+    assert(narrow[KeyValueRowColumn::Key].width == 0);
+    assert(narrow[KeyValueRowColumn::Value].x >= narrow[KeyValueRowColumn::Icon].x + 16);
+
+    KeyValueRowLayout layout;
+    assert(layout.configure(wide, 320));
+    assert(!layout.configure(wide, 320));
+    assert((layout.columns(true, true)[KeyValueRowColumn::Sparkline] ==
+            keyValueRowColumns(wide, 320, true, true)[KeyValueRowColumn::Sparkline]));
+    assert(layout.configure(compact, 320));
+    assert((layout.columns(true, true)[KeyValueRowColumn::Key] == facts[KeyValueRowColumn::Key]));
+    assert(layout.configure(compact, 318));
+    std::cout << "[PASS] key/value row columns match the flex row in both styles\n";
+}
+
+void testKeyValueRowDamageIsPerColumn() {
+    using namespace ms::ui;
+    constexpr KeyValueRowMetrics wide{16, 8, 16, 78, 110};
+    const auto plain = keyValueRowColumns(wide, 320, false, false);
+    const auto detailed = keyValueRowColumns(wide, 320, true, false);
+    const auto sparkline = keyValueRowColumns(wide, 320, false, true);
+
+    // Same shape: only the columns whose content changed.
+    assert(keyValueRowDamage(plain, plain, 0U) == 0U);
+    assert(keyValueRowDamage(plain, plain, keyValueRowColumnBit(KeyValueRowColumn::Value)) ==
+           keyValueRowColumnBit(KeyValueRowColumn::Value));
+    // Hidden columns never damage, even when their (empty) content changed.
+    assert(keyValueRowDamage(plain, plain, keyValueRowColumnBit(KeyValueRowColumn::Detail)) == 0U);
+
+    // Detail appearing narrows the key; icon and value stay put.
+    assert(keyValueRowDamage(plain, detailed, 0U) ==
+           (keyValueRowColumnBit(KeyValueRowColumn::Key) |
+            keyValueRowColumnBit(KeyValueRowColumn::Detail)));
+
+    // Value swapped for a sparkline: both members of the slot, key untouched.
+    assert(keyValueRowDamage(plain, sparkline, 0U) ==
+           (keyValueRowColumnBit(KeyValueRowColumn::Value) |
+            keyValueRowColumnBit(KeyValueRowColumn::Sparkline)));
+    assert((KEY_VALUE_ROW_ALL_COLUMNS & keyValueRowColumnBit(KeyValueRowColumn::Sparkline)) != 0U);
+    std::cout << "[PASS] key/value row damage is limited to changed or moved columns\n";
+}
+
+}  // namespace
+
+int main() {
+    testKeyValueRowColumnsMatchFlexRow();
+    testKeyValueRowDamageIsPerColumn();
+    std::cout << "All KeyValueRowGeometry tests passed\n";
+    return 0;
+}
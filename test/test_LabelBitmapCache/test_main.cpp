@@ -0,0 +1,204 @@
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+
+#include <ms/ui/font/LabelBitmapCache.hpp>
+#include <ms/ui/text/TextArena.hpp>
+
+namespace {
+
+using SmallCache = ms::ui::LabelBitmapCache<64U, 4U>;
+
+const int FONT_A = 0;
+const int FONT_B = 1;
+
+ms::ui::LabelBitmapKey keyFor(const char* text, const void* font = &FONT_A, int16_t width = 100) {
+    ms::ui::LabelBitmapKey key{};
+    key.textLength = static_cast<uint32_t>(std::strlen(text));
+    key.textHash = ms::ui::textHash(text, key.textLength);
+    key.font = font;
+    key.width = width;
+    key.longMode = 1U;
+    return key;
+}
+
+// Fill a bitmap with a recognizable byte so moves can be checked.
+uint8_t* render(SmallCache& cache, const ms::ui::LabelBitmapKey& key, uint16_t w, uint16_t h, uint8_t fill,
+                ms::ui::LabelBitmap& out) {
+    uint8_t* pixels = cache.insert(key, w, h, out);
+    if (pixels) std::memset(pixels, fill, static_cast<std::size_t>(w) * h);
+    return pixels;
+}
+
+bool filledWith(const ms::ui::LabelBitmap& bitmap, uint8_t fill) {
+    for (uint32_t i = 0; i < static_cast<uint32_t>(bitmap.width) * bitmap.height; ++i) {
+        if (bitmap.data[i] != fill) return false;
+    }
+    return true;
+}
+
+void testHitAfterRender() {
+    SmallCache cache{};
+    ms::ui::LabelBitmap bitmap{};
+    assert(!cache.find(keyFor("Tracks"), bitmap));
+    assert(render(cache, keyFor("Tracks"), 6U, 2U, 0xA0U, bitmap));
+    ms::ui::LabelBitmap again{};
+    assert(cache.find(keyFor("Tracks"), again));
+    assert(again.data == bitmap.data && again.serial == bitmap.serial);
+    assert(again.width == 6U && again.height == 2U && filledWith(again, 0xA0U));
+
+    const auto stats = cache.stats();
+    assert(stats.hits == 1U && stats.misses == 1U);
+    assert(stats.entries == 1U && stats.bytes == 12U && stats.capacityBytes == 64U);
+    std::cout << "[PASS] rendered bitmaps are served from the cache\n";
+}
+
+void testKeyCoversLayoutInputs() {
+    SmallCache cache{};
+    ms::ui::LabelBitmap bitmap{};
+    assert(render(cache, keyFor("Tracks"), 4U, 2U, 1U, bitmap));
+    assert(!cache.find(keyFor("Track"), bitmap));
+    assert(!cache.find(keyFor("Tracks", &FONT_B), bitmap));
+    assert(!cache.find(keyFor("Tracks", &FONT_A, 80), bitmap));
+    auto dotted = keyFor("Tracks");
+    dotted.longMode = 2U;
+    assert(!cache.find(dotted, bitmap));
+    auto spaced = keyFor("Tracks");
+    spaced.letterSpace = 1;
+    assert(!cache.find(spaced, bitmap));
+    std::cout << "[PASS] text, font, width, long mode and spacing are all keyed\n";
+}
+
+void testLeastRecentlyUsedIsEvicted() {
+    SmallCache cache{};
+    ms::ui::LabelBitmap bitmap{};
+    assert(render(cache, keyFor("a"), 5U, 4U, 1U, bitmap));  // 20
+    assert(render(cache, keyFor("b"), 5U, 4U, 2U, bitmap));  // 40
+    assert(render(cache, keyFor("c"), 5U, 4U, 3U, bitmap));  // 60
+    assert(cache.find(keyFor("a"), bitmap));                 // b is now oldest
+    assert(render(cache, keyFor("d"), 5U, 4U, 4U, bitmap));
+    assert(!cache.find(keyFor("b"), bitmap));
+    assert(cache.find(keyFor("a"), bitmap) && filledWith(bitmap, 1U));
+    assert(cache.find(keyFor("c"), bitmap) && filledWith(bitmap, 3U));
+    assert(cache.find(keyFor("d"), bitmap) && filledWith(bitmap, 4U));
+    assert(cache.stats().evictions == 1U && cache.stats().bytes == 60U);
+    std::cout << "[PASS] byte pressure evicts the least recently drawn label\n";
+}
+
+void testCompactionKeepsPixelsAndBumpsSerial() {
+    SmallCache cache{};
+    ms::ui::LabelBitmap a{};
+    ms::ui::LabelBitmap b{};
+    ms::ui::LabelBitmap c{};
+    assert(render(cache, keyFor("a"), 4U, 4U, 1U, a));  // [0,16)
+    assert(render(cache, keyFor("b"), 4U, 4U, 2U, b));  // [16,32)
+    assert(render(cache, keyFor("c"), 4U, 4U, 3U, c));  // [32,48)
+    cache.erase(keyFor("a"));                             // hole at the bottom
+
+    // 24 bytes: 16 free at the top is not enough, 32 free in total is.
+    ms::ui::LabelBitmap d{};
+    assert(render(cache, keyFor("d"), 6U, 4U, 4U, d));
+    assert(cache.stats().compactions == 1U && cache.stats().evictions == 0U);
+
+    ms::ui::LabelBitmap moved{};
+    assert(cache.find(keyFor("b"), moved));
+    assert(moved.data != b.data && moved.serial != b.serial && filledWith(moved, 2U));
+    assert(cache.find(keyFor("c"), moved) && filledWith(moved, 3U));
+    assert(cache.find(keyFor("d"), moved) && filledWith(moved, 4U));
+    assert(cache.stats().bytes == 56U);
+    std::cout << "[PASS] fragmented space is compacted without losing bitmaps\n";
+}
+
+void testOversizedBitmapsBypass() {
+    SmallCache cache{};
+    ms::ui::LabelBitmap bitmap{};
+    assert(!render(cache, keyFor("huge"), 65U, 1U, 1U, bitmap));
+    assert(!render(cache, keyFor("empty"), 0U, 12U, 1U, bitmap));
+    assert(cache.stats().bypasses == 2U && cache.stats().entries == 0U);
+    // A full-pool bitmap still fits by evicting everything else.
+    assert(render(cache, keyFor("a"), 4U, 4U, 1U, bitmap));
+    assert(render(cache, keyFor("full"), 8U, 8U, 9U, bitmap));
+    assert(cache.stats().entries == 1U && cache.stats().bytes == 64U);
+    std::cout << "[PASS] bitmaps larger than the pool are drawn uncached\n";
+}
+
+void testEntrySlotsAreBounded() {
+    SmallCache cache{};
+    ms::ui::LabelBitmap bitmap{};
+    const char* names[] = {"1", "2", "3", "4", "5", "6"};
+    for (const char* name : names) assert(render(cache, keyFor(name), 2U, 2U, 7U, bitmap));
+    const auto stats = cache.stats();
+    assert(stats.entries == 4U && stats.evictions == 2U);
+    assert(!cache.find(keyFor("1"), bitmap) && !cache.find(keyFor("2"), bitmap));
+    assert(cache.find(keyFor("6"), bitmap));
+    std::cout << "[PASS] entry table is bounded independently of bytes\n";
+}
+
+void testEraseFontAndClear() {
+    SmallCache cache{};
+    ms::ui::LabelBitmap bitmap{};
+    assert(render(cache, keyFor("icon", &FONT_B), 3U, 3U, 1U, bitmap));
+    assert(render(cache, keyFor("title"), 3U, 3U, 2U, bitmap));
+    cache.eraseFont(&FONT_B);
+    assert(!cache.find(keyFor("icon", &FONT_B), bitmap));
+    assert(cache.find(keyFor("title"), bitmap));
+    assert(cache.stats().peakBytes == 18U);
+
+    cache.clear();
+    assert(cache.stats().entries == 0U && cache.stats().bytes == 0U);
+    assert(!cache.find(keyFor("title"), bitmap));
+    const uint32_t before = bitmap.serial;
+    assert(render(cache, keyFor("title"), 3U, 3U, 2U, bitmap));
+    assert(bitmap.serial != before);
+    std::cout << "[PASS] font drops and clear() release their bytes\n";
+}
+
+void testPinnedBitmapsStayPut() {
+    SmallCache cache{};
+    ms::ui::LabelBitmap a{};
+    ms::ui::LabelBitmap b{};
+    ms::ui::LabelBitmap c{};
+    assert(render(cache, keyFor("a"), 4U, 4U, 1U, a));  // [0,16)
+    assert(render(cache, keyFor("b"), 4U, 4U, 2U, b));  // [16,32)
+    assert(render(cache, keyFor("c"), 4U, 4U, 3U, c));  // [32,48)
+    cache.pin(b);
+    cache.pin(c);
+    cache.erase(keyFor("a"));
+
+    // 24 bytes: the hole below b cannot be closed, so a is the only space
+    // compaction finds; the pinned bitmaps keep their pixels and serials.
+    ms::ui::LabelBitmap d{};
+    assert(!render(cache, keyFor("d"), 6U, 4U, 4U, d));
+    assert(cache.stats().blocked == 1U && cache.stats().evictions == 0U);
+    ms::ui::LabelBitmap still{};
+    assert(cache.find(keyFor("b"), still) && still.data == b.data && still.serial == b.serial);
+    assert(cache.find(keyFor("c"), still) && still.data == c.data && filledWith(still, 3U));
+    // An unpinned neighbour is still evicted first, past the pinned tail.
+    ms::ui::LabelBitmap e{};
+    assert(render(cache, keyFor("e"), 4U, 4U, 5U, e));  // fits at the top
+    assert(render(cache, keyFor("f"), 4U, 4U, 6U, d));  // evicts e, not b or c
+    assert(!cache.find(keyFor("e"), still) && cache.find(keyFor("b"), still));
+
+    // End of frame: everything may move or go again.
+    cache.unpinAll();
+    assert(render(cache, keyFor("g"), 8U, 8U, 7U, d));
+    assert(cache.stats().entries == 1U);
+    std::cout << "[PASS] pinned bitmaps are neither evicted nor moved\n";
+}
+
+}  // namespace
+
+int main() {
+    testHitAfterRender();
+    testKeyCoversLayoutInputs();
+    testLeastRecentlyUsedIsEvicted();
+    testCompactionKeepsPixelsAndBumpsSerial();
+    testOversizedBitmapsBypass();
+    testEntrySlotsAreBounded();
+    testEraseFontAndClear();
+    testPinnedBitmapsStayPut();
+    std::cout << "All LabelBitmapCache tests passed\n";
+    return 0;
+}
@@ -0,0 +1,87 @@
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <iostream>
+
+#include <ms/ui/component/LayoutPassModel.hpp>
+
+namespace {
+
+using ms::ui::LayoutPassModel;
+using ms::ui::LayoutPassNode;
+using ms::ui::LayoutSizing;
+
+// ViewContainer with a LayoutView in the main zone and the TransportBar below.
+// Pass counts are what LayoutPassModel predicts for this tree, not LVGL
+// measurements.
+enum Node : std::size_t {
+    CONTAINER = 0,
+    MAIN_ZONE,
+    VIEW,
+    VIEW_HEADER,
+    VIEW_TITLE,
+    VIEW_CONTENT,
+    VIEW_LIST,
+    VIEW_ROW_A,
+    VIEW_ROW_B,
+    BOTTOM_ZONE,
+    TRANSPORT_BAR,
+    TEMPO_LABEL,
+    POSITION_LABEL,
+    NODE_COUNT,
+};
+
+LayoutPassModel<NODE_COUNT> unsealedTree() {
+    std::array<LayoutPassNode, NODE_COUNT> nodes{};
+    nodes[CONTAINER] = {-1, LayoutSizing::Fixed};
+    // Before sealing: the bottom zone and the view header follow their content.
+    nodes[MAIN_ZONE] = {CONTAINER, LayoutSizing::Grow};
+    nodes[VIEW] = {MAIN_ZONE, LayoutSizing::Fixed};
+    nodes[VIEW_HEADER] = {VIEW, LayoutSizing::Content};
+    nodes[VIEW_TITLE] = {VIEW_HEADER, LayoutSizing::Content};
+    nodes[VIEW_CONTENT] = {VIEW, LayoutSizing::Grow};
+    nodes[VIEW_LIST] = {VIEW_CONTENT, LayoutSizing::Fixed};
+    nodes[VIEW_ROW_A] = {VIEW_LIST, LayoutSizing::Fixed};
+    nodes[VIEW_ROW_B] = {VIEW_LIST, LayoutSizing::Fixed};
+    nodes[BOTTOM_ZONE] = {CONTAINER, LayoutSizing::Content};
+    nodes[TRANSPORT_BAR] = {BOTTOM_ZONE, LayoutSizing::Content};
+    nodes[TEMPO_LABEL] = {TRANSPORT_BAR, LayoutSizing::Content};
+    nodes[POSITION_LABEL] = {TRANSPORT_BAR, LayoutSizing::Content};
+    return LayoutPassModel<NODE_COUNT>(nodes);
+}
+
+void testTransportTextRelaysMainZoneWithoutBoundary() {
+    const auto model = unsealedTree();
+    // Label, bar, bottom zone, container, plus the whole main zone subtree.
+    assert(model.passesForContentChange(TEMPO_LABEL) == 4U + 8U);
+    std::cout << "[PASS] unsealed bottom zone relays the main zone on tempo text\n";
+}
+
+void testSealedBottomZoneStopsAtItself() {
+    auto model = unsealedTree();
+    model.setSizing(BOTTOM_ZONE, LayoutSizing::Fixed);
+    assert(model.passesForContentChange(TEMPO_LABEL) == 3U);
+    assert(model.passesForContentChange(POSITION_LABEL) == 3U);
+    std::cout << "[PASS] sealed bottom zone keeps transport updates inside it\n";
+}
+
+void testLayoutViewHeaderBoundary() {
+    auto model = unsealedTree();
+    // Title change grows the header: view pass plus the content subtree.
+    assert(model.passesForContentChange(VIEW_TITLE) == 3U + 4U);
+    model.setSizing(VIEW_HEADER, LayoutSizing::Fixed);
+    assert(model.passesForContentChange(VIEW_TITLE) == 2U);
+    // Rows inside the grown content slot never leave it.
+    assert(model.passesForContentChange(VIEW_ROW_A) == 1U);
+    std::cout << "[PASS] sealed view header keeps title updates inside it\n";
+}
+
+}  // namespace
+
+int main() {
+    testTransportTextRelaysMainZoneWithoutBoundary();
+    testSealedBottomZoneStopsAtItself();
+    testLayoutViewHeaderBoundary();
+    std::cout << "All LayoutPassModel tests passed\n";
+    return 0;
+}
@@ -0,0 +1,99 @@
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+
+#include <ms/ui/widget/MenuNavigation.hpp>
+
+namespace {
+
+using Navigation = ms::ui::MenuNavigation<3>;
+
+// Levels of a small settings tree: 0 root, 1 MIDI, 2 Display, 3 MIDI > Channels.
+constexpr int16_t ROOT = 0;
+constexpr int16_t MIDI = 1;
+constexpr int16_t DISPLAY = 2;
+constexpr int16_t CHANNELS = 3;
+
+void testEnterAndBackRestoreSelection() {
+    Navigation nav;
+    nav.reset(ROOT);
+    assert(nav.depth() == 1U);
+    assert(nav.current().level == ROOT);
+    assert(!nav.cached());
+    nav.markCached();
+    nav.current().selectedIndex = 4;
+
+    assert(nav.enter(MIDI));
+    assert(nav.depth() == 2U);
+    assert(nav.slot() == 1U);
+    assert(nav.current().level == MIDI);
+    assert(nav.current().selectedIndex == 0);
+    nav.markCached();
+    nav.current().selectedIndex = 2;
+
+    assert(nav.back());
+    assert(nav.current().level == ROOT);
+    assert(nav.current().selectedIndex == 4);
+    // Parent rows were never touched: swap back in without a re-fill.
+    assert(nav.cached());
+    assert(!nav.back());
+    std::cout << "[PASS] back restores the parent's selection and cached rows\n";
+}
+
+void testReenteringKeepsCacheOtherFolderRefills() {
+    Navigation nav;
+    nav.reset(ROOT);
+    nav.markCached();
+
+    assert(nav.enter(MIDI));
+    assert(!nav.cached());
+    nav.markCached();
+    assert(nav.back());
+
+    // Same folder again: slot 1 still holds MIDI.
+    assert(nav.enter(MIDI));
+    assert(nav.cached());
+    assert(nav.current().selectedIndex == 0);
+    assert(nav.back());
+
+    // Another folder reuses slot 1 and must refill it.
+    assert(nav.enter(DISPLAY));
+    assert(!nav.cached());
+    nav.markCached();
+    assert(nav.back());
+    assert(nav.enter(MIDI));
+    assert(!nav.cached());
+    std::cout << "[PASS] slots stay cached until another level claims them\n";
+}
+
+void testDepthLimitAndReset() {
+    Navigation nav;
+    nav.reset(ROOT);
+    assert(nav.enter(MIDI));
+    assert(nav.enter(CHANNELS));
+    assert(nav.depth() == Navigation::capacity());
+    assert(!nav.enter(DISPLAY));
+    assert(nav.current().level == CHANNELS);
+    nav.markCached();
+
+    nav.forgetCaches();
+    assert(!nav.cached());
+    nav.markCached();
+
+    nav.reset(DISPLAY);
+    assert(nav.depth() == 1U);
+    assert(nav.current().level == DISPLAY);
+    assert(!nav.cached());
+    std::cout << "[PASS] full paths refuse to grow and reset forgets every slot\n";
+}
+
+}  // namespace
+
+int main() {
+    testEnterAndBackRestoreSelection();
+    testReenteringKeepsCacheOtherFolderRefills();
+    testDepthLimitAndReset();
+    std::cout << "All MenuNavigation tests passed\n";
+    return 0;
+}
@@ -0,0 +1,128 @@
+#include <cassert>
+#include <iostream>
+
+#include <ms/ui/component/OcclusionRegistry.hpp>
+
+namespace {
+
+struct Node {
+    const Node* parent = nullptr;
+};
+
+bool within(const Node* node, const Node* ancestor) {
+    for (const Node* walk = node; walk; walk = walk->parent) {
+        if (walk == ancestor) return true;
+    }
+    return false;
+}
+
+struct Widget {
+    int covered = 0;
+    int uncovered = 0;
+    bool occluded = false;
+};
+
+void onOcclusion(void* context, bool occluded) {
+    auto* widget = static_cast<Widget*>(context);
+    widget->occluded = occluded;
+    if (occluded) {
+        ++widget->covered;
+    } else {
+        ++widget->uncovered;
+    }
+}
+
+using Registry = ms::ui::OcclusionRegistry<Node, 4>;
+
+// screen > { mainZone > curve, bottomZone > transport, overlay > marker }
+Node screen;
+Node mainZone{&screen};
+Node curve{&mainZone};
+Node bottomZone{&screen};
+Node transport{&bottomZone};
+Node overlay{&screen};
+Node overlayMarker{&overlay};
+
+void testOverlayCoversSiblingsNotItself() {
+    Registry registry(within);
+    Widget curveWidget;
+    Widget transportWidget;
+    Widget overlayWidget;
+    assert(registry.add(&curve, onOcclusion, &curveWidget));
+    assert(registry.add(&transport, onOcclusion, &transportWidget));
+    assert(registry.add(&overlayMarker, onOcclusion, &overlayWidget));
+
+    assert(registry.occlude(&screen, &overlay));
+    assert(curveWidget.occluded && transportWidget.occluded);
+    assert(!overlayWidget.occluded && overlayWidget.covered == 0);
+    assert(!registry.occlude(&screen, &overlay));
+
+    assert(registry.reveal(&screen, &overlay));
+    assert(curveWidget.covered == 1 && curveWidget.uncovered == 1);
+    assert(!registry.occluded(&curveWidget));
+    assert(!registry.reveal(&screen, &overlay));
+    std::cout << "[PASS] an overlay covers its scope but not its own subtree\n";
+}
+
+void testNestedScopesResyncOnce() {
+    Registry registry(within);
+    Widget curveWidget;
+    registry.add(&curve, onOcclusion, &curveWidget);
+
+    registry.occlude(&mainZone);
+    registry.occlude(&screen, &overlay);
+    assert(curveWidget.covered == 1);
+    registry.reveal(&mainZone);
+    assert(curveWidget.uncovered == 0 && registry.occluded(&curveWidget));
+    registry.reveal(&screen, &overlay);
+    assert(curveWidget.covered == 1 && curveWidget.uncovered == 1);
+    std::cout << "[PASS] stacked scopes pause once and resync once\n";
+}
+
+void testLateListenersAndRemoval() {
+    Registry registry(within);
+    registry.occlude(&bottomZone);
+    Widget transportWidget;
+    Widget curveWidget;
+    registry.add(&transport, onOcclusion, &transportWidget);
+    registry.add(&curve, onOcclusion, &curveWidget);
+    assert(transportWidget.occluded && transportWidget.covered == 1);
+    assert(!curveWidget.occluded);
+
+    registry.remove(&transportWidget);
+    registry.reveal(&bottomZone);
+    assert(transportWidget.uncovered == 0);
+
+    Widget extra[3];
+    for (auto& widget : extra) assert(registry.add(&curve, onOcclusion, &widget));
+    Widget overflow;
+    assert(!registry.add(&curve, onOcclusion, &overflow));
+    std::cout << "[PASS] late listeners start covered and removed ones stay quiet\n";
+}
+
+void testFullScopeTableIsCounted() {
+    Registry registry(within);
+    Widget curveWidget;
+    registry.add(&curve, onOcclusion, &curveWidget);
+    assert(registry.occlude(&bottomZone) && registry.occlude(&transport));
+    assert(registry.occlude(&overlay) && registry.occlude(&overlayMarker));
+    // Covering a scope twice is not an overflow; a fifth scope is.
+    assert(!registry.occlude(&overlay) && registry.overflows() == 0U);
+    assert(!registry.occlude(&screen, &overlay) && registry.overflows() == 1U);
+    assert(!curveWidget.occluded);
+
+    registry.reveal(&transport);
+    assert(registry.occlude(&screen, &overlay) && curveWidget.occluded);
+    std::cout << "[PASS] a full scope table is counted, not silently dropped\n";
+}
+
+}  // namespace
+
+int main() {
+    testOverlayCoversSiblingsNotItself();
+    testNestedScopesResyncOnce();
+    testLateListenersAndRemoval();
+    testFullScopeTableIsCounted();
+    std::cout << "All OcclusionRegistry tests passed\n";
+    return 0;
+}
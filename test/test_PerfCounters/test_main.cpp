@@ -0,0 +1,86 @@
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+
+#include <ms/ui/PerfCounterTable.hpp>
+
+namespace {
+
+using ms::ui::PerfCounter;
+using ms::ui::PerfCounterTable;
+using ms::ui::PerfWidget;
+
+void testCountersArePerWidget() {
+    PerfCounterTable table;
+    table.add(PerfWidget::MenuList, PerfCounter::Renders);
+    table.add(PerfWidget::MenuList, PerfCounter::Renders);
+    table.add(PerfWidget::MenuList, PerfCounter::RowsBound, 5U);
+    table.add(PerfWidget::KeyValueOverlay, PerfCounter::Renders);
+
+    assert(table.get(PerfWidget::MenuList)[PerfCounter::Renders] == 2U);
+    assert(table.get(PerfWidget::MenuList)[PerfCounter::RowsBound] == 5U);
+    assert(table.get(PerfWidget::KeyValueOverlay)[PerfCounter::Renders] == 1U);
+    assert(table.get(PerfWidget::KeyValueOverlay)[PerfCounter::RowsBound] == 0U);
+    assert(table.get(PerfWidget::CurvePreview)[PerfCounter::Renders] == 0U);
+    assert(table.total(PerfCounter::Renders) == 3U);
+    std::cout << "[PASS] counters accumulate per widget and total across widgets\n";
+}
+
+void testConstructTiming() {
+    PerfCounterTable table;
+    table.addConstruct(PerfWidget::ListOverlay, 1200U);
+    table.addConstruct(PerfWidget::ListOverlay, 300U);
+    const auto& entry = table.get(PerfWidget::ListOverlay);
+    assert(entry.constructions == 2U);
+    assert(entry.constructUs == 1500U);
+    assert(entry.maxConstructUs == 1200U);
+    std::cout << "[PASS] constructor time sums and keeps the slowest\n";
+}
+
+void testSaturates() {
+    PerfCounterTable table;
+    table.add(PerfWidget::Marquee, PerfCounter::InvalidatedPixels, UINT32_MAX - 10U);
+    table.add(PerfWidget::Marquee, PerfCounter::InvalidatedPixels, 320U * 240U);
+    assert(table.get(PerfWidget::Marquee)[PerfCounter::InvalidatedPixels] == UINT32_MAX);
+    table.add(PerfWidget::Fonts, PerfCounter::InvalidatedPixels, 5U);
+    assert(table.total(PerfCounter::InvalidatedPixels) == UINT32_MAX);
+    std::cout << "[PASS] counters saturate instead of wrapping\n";
+}
+
+void testResetAndInvalidIds() {
+    PerfCounterTable table;
+    table.add(PerfWidget::LayoutView, PerfCounter::ObjectsCreated, 3U);
+    table.add(PerfWidget::Count, PerfCounter::Renders);
+    table.add(PerfWidget::LayoutView, PerfCounter::Count);
+    table.addConstruct(PerfWidget::Count, 10U);
+    assert(table.get(PerfWidget::Count)[PerfCounter::Renders] == 0U);
+    assert(table.get(PerfWidget::LayoutView)[PerfCounter::ObjectsCreated] == 3U);
+    table.reset();
+    assert(table.get(PerfWidget::LayoutView)[PerfCounter::ObjectsCreated] == 0U);
+    assert(table.total(PerfCounter::ObjectsCreated) == 0U);
+    std::cout << "[PASS] reset clears the table and out-of-range ids are ignored\n";
+}
+
+void testNames() {
+    for (std::size_t w = 0; w < ms::ui::PERF_WIDGETS; ++w) {
+        assert(std::strcmp(ms::ui::perfWidgetName(static_cast<PerfWidget>(w)), "?") != 0);
+    }
+    for (std::size_t c = 0; c < ms::ui::PERF_COUNTERS; ++c) {
+        assert(std::strcmp(ms::ui::perfCounterName(static_cast<PerfCounter>(c)), "?") != 0);
+    }
+    static_assert(ms::ui::perfWidgetName(PerfWidget::MenuList)[0] == 'm', "constexpr names");
+    std::cout << "[PASS] every widget and counter has a name\n";
+}
+
+}  // namespace
+
+int main() {
+    testCountersArePerWidget();
+    testConstructTiming();
+    testSaturates();
+    testResetAndInvalidIds();
+    testNames();
+    std::cout << "All PerfCounters tests passed\n";
+    return 0;
+}
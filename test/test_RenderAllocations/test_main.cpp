@@ -0,0 +1,189 @@
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+
+#include <ms/ui/text/FixedText.hpp>
+#include <ms/ui/text/TextCache.hpp>
+#include <ms/ui/widget/CurvePreviewGeometry.hpp>
+#include <ms/ui/widget/ListItemStore.hpp>
+#include <ms/ui/widget/VirtualListPrefetch.hpp>
+#include <ms/ui/widget/VirtualSlotRing.hpp>
+
+// Every global allocation in this binary goes through these hooks.
+namespace {
+std::size_t g_allocations = 0U;
+}  // namespace
+
+void* operator new(std::size_t size) {
+    ++g_allocations;
+    if (void* memory = std::malloc(size == 0U ? 1U : size)) return memory;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) { return operator new(size); }
+
+// Out of line so GCC does not pair the inlined free() with a new-expression
+// and report -Wmismatched-new-delete: both sides are malloc/free here.
+[[gnu::noinline]] void operator delete(void* memory) noexcept { std::free(memory); }
+void operator delete[](void* memory) noexcept { operator delete(memory); }
+void operator delete(void* memory, std::size_t) noexcept { operator delete(memory); }
+void operator delete[](void* memory, std::size_t) noexcept { operator delete(memory); }
+
+namespace {
+
+constexpr int WARM_UP_FRAMES = 4;
+constexpr int STEADY_FRAMES = 256;
+
+/**
+ * Run one warm-up pass, then assert the steady-state frames never reach
+ * operator new. Frame numbers let each pass vary its input like a real
+ * render(props) stream would.
+ */
+template <typename Frame>
+void expectNoSteadyStateAllocations(const char* name, Frame frame) {
+    for (int index = 0; index < WARM_UP_FRAMES; ++index) frame(index);
+    const std::size_t before = g_allocations;
+    for (int index = 0; index < STEADY_FRAMES; ++index) frame(index);
+    assert(g_allocations == before);
+    std::cout << "[PASS] " << name << " renders without heap allocations\n";
+}
+
+void testHooksCountAllocations() {
+    const std::size_t before = g_allocations;
+    delete new int(7);
+    assert(g_allocations == before + 1U);
+    std::cout << "[PASS] allocation hooks observe operator new\n";
+}
+
+void testFixedTextHeader() {
+    static const char* const TITLES[] = {"Macro", "Macro", "Track 12", "Scene"};
+    ms::ui::FixedText<64> title{};
+    expectNoSteadyStateAllocations("header title cache", [&](int frame) {
+        (void)title.assign(TITLES[frame % 4]);
+    });
+    assert(!title.assign(title.c_str()));
+    assert(title.assign(nullptr) && title.empty());
+}
+
+void testRowTextCache() {
+    static const char* const VALUES[] = {"12%", "13%", "Off", "-6.0 dB", "On"};
+    ms::ui::TextArena<128U, 8U> arena{};
+    ms::ui::TextCache rows[4] = {};
+    ms::ui::TextStamp labels[4] = {};
+    expectNoSteadyStateAllocations("row text cache", [&](int frame) {
+        for (int index = 0; index < 4; ++index) {
+            (void)rows[index].assign(arena, VALUES[(frame + index) % 5]);
+            (void)labels[index].update(rows[index].c_str(arena));
+        }
+    });
+    assert(arena.stats().failures == 0U);
+}
+
+void testFixedTextTruncatesOnGlyphBoundary() {
+    ms::ui::FixedText<6> text{};
+    // "abc" + U+00E9 fills all 5 bytes; the trailing "d" is cut cleanly.
+    assert(text.assign("abc\xC3\xA9" "d") && text.size() == 5U);
+    // "abcd" + U+00E9: the 2-byte glyph does not fit and is dropped whole.
+    assert(text.assign("abcd\xC3\xA9") && text.size() == 4U);
+    assert(!text.assign("abcd\xC3\xA9"));
+    std::cout << "[PASS] fixed text never stores a split UTF-8 sequence\n";
+}
+
+void testSlotRingScroll() {
+    ms::ui::VirtualSlotRing<5U> ring{};
+    expectNoSteadyStateAllocations("slot ring window shift", [&](int frame) {
+        const int start = frame % 40;
+        for (int index = start; index < start + 5; ++index) (void)ring.claim(index);
+        if ((frame & 7) == 0) ring.invalidate(start + 2);
+        if ((frame & 31) == 0) ring.trim(30);
+    });
+}
+
+struct FakeRow {
+    int value = 0;
+};
+
+void testPrefetchRing() {
+    ms::ui::VirtualListPrefetchRing<FakeRow, 16U> ring{};
+    expectNoSteadyStateAllocations("prefetch ring", [&](int frame) {
+        const int start = frame % 60;
+        const int next = ring.nextMissing(start, 5, 1, 4, 4, 64);
+        if (next >= 0) ring.claim(next).value = next;
+        if ((frame & 63) == 0) ring.reset();
+    });
+}
+
+struct FakeStyle {
+    const void* font = nullptr;
+    bool labelHidden = false;
+};
+
+const char* labelAt(const void* source, std::size_t index) {
+    return static_cast<const char* const*>(source)[index];
+}
+
+// ListOverlay's item model: the same store and reconcile call its
+// updateItems()/setItems() run, minus the LVGL rows.
+void testListItemStore() {
+    static const char* const LABELS[] = {"Kick", "Snare", "Hat", "Clap", "Tom", "Ride"};
+    static const uint32_t KEYS[] = {1, 2, 3, 4, 5, 6};
+    static ms::ui::ListItemStore<FakeStyle> store{};
+    int selected = 0;
+    expectNoSteadyStateAllocations("list item store", [&](int frame) {
+        const std::size_t shift = static_cast<std::size_t>(frame % 3);
+        const std::size_t count = 6U - shift;
+        const bool keyed = (frame & 1) != 0;
+        const auto update = store.reconcile(
+            LABELS + shift, labelAt, count, keyed ? KEYS + shift : nullptr, selected,
+            [](std::size_t) {});
+        if (update.selected >= 0) selected = update.selected;
+        if (auto* style = store.style(0)) style->labelHidden = !style->labelHidden;
+        if ((frame & 15) == 0) store.resetExternal(6U);
+    });
+}
+
+struct WaveContext {
+    uint16_t phase = 0U;
+};
+
+bool sampleWave(void* rawContext, uint16_t positionQ16, ms::ui::CurvePreviewSample& out) {
+    const auto& context = *static_cast<const WaveContext*>(rawContext);
+    const auto value = static_cast<uint16_t>(positionQ16 + context.phase);
+    out.curve = value;
+    out.base = positionQ16;
+    out.impact = static_cast<uint16_t>(value / 2U);
+    return true;
+}
+
+void testCurvePreviewGeometry() {
+    static ms::ui::CurvePreviewGeometry geometry{};
+    static ms::ui::CurvePreviewDamage damage{};
+    WaveContext context{};
+    expectNoSteadyStateAllocations("curve preview geometry", [&](int frame) {
+        context.phase = static_cast<uint16_t>(frame * 97);
+        if ((frame & 15) == 0) {
+            assert(geometry.rebuild(304, 92, sampleWave, &context));
+        } else {
+            assert(geometry.rebuildWithDamage(
+                304, 92, sampleWave, &context, true, damage));
+        }
+    });
+}
+
+}  // namespace
+
+int main() {
+    testHooksCountAllocations();
+    testFixedTextHeader();
+    testFixedTextTruncatesOnGlyphBoundary();
+    testRowTextCache();
+    testSlotRingScroll();
+    testPrefetchRing();
+    testListItemStore();
+    testCurvePreviewGeometry();
+    std::cout << "All RenderAllocations tests passed\n";
+    return 0;
+}
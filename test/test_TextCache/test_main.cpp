@@ -0,0 +1,210 @@
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <iostream>
+
+#include <ms/ui/text/TextArena.hpp>
+#include <ms/ui/text/TextCache.hpp>
+
+namespace {
+
+using SmallArena = ms::ui::TextArena<32U, 4U>;
+
+void testStampDetectsChanges() {
+    ms::ui::TextStamp stamp{};
+    // A fresh stamp matches the empty string, like a zeroed label cache.
+    assert(!stamp.update(""));
+    assert(!stamp.update(nullptr));
+    assert(stamp.update("Cutoff"));
+    assert(!stamp.update("Cutoff"));
+    assert(stamp.update("Cutof"));
+    assert(stamp.update("Cutoff"));
+    std::cout << "[PASS] text stamp reports only real changes\n";
+}
+
+void testIdenticalStringsShareStorage() {
+    SmallArena arena{};
+    ms::ui::TextCache row{};
+    ms::ui::TextCache slot{};
+    assert(row.assign(arena, "Filter"));
+    assert(slot.assign(arena, "Filter"));
+    assert(row.handle == slot.handle);
+    assert(arena.stats().liveEntries == 1U);
+    assert(arena.stats().liveBytes == 7U);
+    assert(std::strcmp(slot.c_str(arena), "Filter") == 0);
+
+    // The shared copy lives until the last reference goes.
+    row.release(arena);
+    assert(std::strcmp(slot.c_str(arena), "Filter") == 0);
+    slot.release(arena);
+    assert(arena.stats().liveEntries == 0U);
+    std::cout << "[PASS] identical strings are interned once\n";
+}
+
+void testEmptyTextIsNotStored() {
+    SmallArena arena{};
+    ms::ui::TextCache cache{};
+    assert(!cache.assign(arena, ""));
+    assert(cache.assign(arena, "A"));
+    assert(cache.assign(arena, nullptr));
+    assert(cache.empty() && cache.c_str(arena)[0] == '\0');
+    assert(arena.stats().liveEntries == 0U);
+    std::cout << "[PASS] empty text costs no arena storage\n";
+}
+
+void testCompactionReusesHoles() {
+    SmallArena arena{};
+    ms::ui::TextCache a{};
+    ms::ui::TextCache b{};
+    ms::ui::TextCache c{};
+    assert(a.assign(arena, "0123456789"));  // 11 bytes
+    assert(b.assign(arena, "abcdefghij"));  // 11 bytes
+    assert(c.assign(arena, "ABCDEFGH"));    // 9 bytes, 31 used
+    // Freeing a middle string leaves a hole; the next insert compacts.
+    a.release(arena);
+    assert(a.assign(arena, "klmnopqrst"));
+    assert(std::strcmp(b.c_str(arena), "abcdefghij") == 0);
+    assert(std::strcmp(c.c_str(arena), "ABCDEFGH") == 0);
+    assert(std::strcmp(a.c_str(arena), "klmnopqrst") == 0);
+    assert(arena.stats().failures == 0U);
+    std::cout << "[PASS] released holes are compacted without moving handles\n";
+}
+
+void testExhaustedArenaRetries() {
+    SmallArena arena{};
+    ms::ui::TextCache a{};
+    ms::ui::TextCache b{};
+    assert(a.assign(arena, "0123456789012345678901234"));
+    // Does not fit: reads empty and keeps reporting a change.
+    assert(b.assign(arena, "abcdefghij"));
+    assert(b.c_str(arena)[0] == '\0' && b.empty());
+    assert(b.assign(arena, "abcdefghij"));
+    assert(arena.stats().failures == 2U);
+    // Space frees up: the same text lands on the next assign.
+    a.release(arena);
+    assert(b.assign(arena, "abcdefghij"));
+    assert(std::strcmp(b.c_str(arena), "abcdefghij") == 0 && !b.empty());
+    assert(!b.assign(arena, "abcdefghij"));
+    std::cout << "[PASS] exhausted arena degrades to retry, not stale text\n";
+}
+
+void testLongTextCutOnGlyphBoundary() {
+    ms::ui::TextArena<256U, 4U> arena{};
+    ms::ui::TextCache cache{};
+    char text[64] = {};
+    std::memset(text, 'x', 46U);
+    // Two-byte glyph straddling the 47-byte cap is dropped whole.
+    text[46] = '\xC3';
+    text[47] = '\xA9';
+    assert(cache.assign(arena, text));
+    assert(std::strlen(cache.c_str(arena)) == 46U);
+    // Text differing only past the cap is the same cached value.
+    text[48] = 'y';
+    assert(!cache.assign(arena, text));
+    std::cout << "[PASS] cached text is capped on a UTF-8 boundary\n";
+}
+
+/** 47 bytes, distinct per (pass, field): digits up front, filler after. */
+void fillField(char (&text)[48], int pass, std::size_t field) {
+    std::memset(text, 'a' + pass, ms::ui::TEXT_CACHE_MAX_LENGTH);
+    text[0] = static_cast<char>('0' + field / 100U);
+    text[1] = static_cast<char>('0' + field / 10U % 10U);
+    text[2] = static_cast<char>('0' + field % 10U);
+    text[ms::ui::TEXT_CACHE_MAX_LENGTH] = '\0';
+}
+
+/**
+ * Every cache of a widget holding distinct 47-byte text at once, twice over
+ * so the second pass churns through release and compaction. The arena is
+ * sized for typical text, so some fields are cut, but none to less than the
+ * reserve and none blank.
+ */
+template <std::size_t Caches>
+void expectFullWindowNeverBlank() {
+    static ms::ui::TextCacheArena<Caches> arena{};
+    static ms::ui::TextCache caches[Caches] = {};
+    char text[48] = {};
+    for (int pass = 0; pass < 2; ++pass) {
+        for (std::size_t field = 0; field < Caches; ++field) {
+            fillField(text, pass, field);
+            assert(caches[field].assign(arena, text));
+        }
+        for (std::size_t field = 0; field < Caches; ++field) {
+            fillField(text, pass, field);
+            const char* shown = caches[field].c_str(arena);
+            const std::size_t length = std::strlen(shown);
+            assert(length + 1U >= ms::ui::TEXT_CACHE_RESERVED_BYTES);
+            assert(std::strncmp(shown, text, length) == 0);
+        }
+    }
+    assert(arena.stats().failures == 0U);
+    assert(arena.stats().truncations > 0U);
+}
+
+/** Every cache of a widget holding distinct text of the typical length. */
+template <std::size_t Caches>
+void expectTypicalWindowFitsWhole() {
+    static ms::ui::TextCacheArena<Caches> arena{};
+    static ms::ui::TextCache caches[Caches] = {};
+    char text[48] = {};
+    for (int pass = 0; pass < 2; ++pass) {
+        for (std::size_t field = 0; field < Caches; ++field) {
+            fillField(text, pass, field);
+            text[ms::ui::TEXT_CACHE_TYPICAL_BYTES - 1U] = '\0';
+            assert(caches[field].assign(arena, text));
+            assert(std::strcmp(caches[field].c_str(arena), text) == 0);
+        }
+    }
+    assert(arena.stats().failures == 0U);
+    assert(arena.stats().truncations == 0U);
+}
+
+void testWorstCaseWindowNeverRendersBlank() {
+    // VirtualListKeyValueOverlay: 16 rows plus the provider row, 4 fields.
+    expectFullWindowNeverBlank<(16U + 1U) * 4U>();
+    expectTypicalWindowFitsWhole<(16U + 1U) * 4U>();
+    // MenuListView at the default depth: label and value of 16 rows per
+    // level, plus the 5 docked provider rows.
+    expectFullWindowNeverBlank<(16U * 4U + 5U) * 2U>();
+    expectTypicalWindowFitsWhole<(16U * 4U + 5U) * 2U>();
+    std::cout << "[PASS] widget arenas never render a field blank\n";
+}
+
+void testReserveKeepsRoomForEveryCache() {
+    // 16 bytes past the four 8-byte reserves.
+    ms::ui::TextArena<48U, 4U, 8U> arena{};
+    ms::ui::TextCache caches[4] = {};
+    // Long text may use the slack...
+    assert(caches[0].assign(arena, "Cut"));
+    assert(caches[1].assign(arena, "0123456789abcdefghijklmnopqrst"));
+    assert(std::strcmp(caches[1].c_str(arena), "0123456789abcdefghijklm") == 0);
+    // ...but never the bytes the remaining caches are guaranteed.
+    assert(caches[2].assign(arena, "ABCDEFGHIJKL"));
+    assert(std::strcmp(caches[2].c_str(arena), "ABCDEFG") == 0);
+    assert(caches[3].assign(arena, "Resonance"));
+    assert(std::strcmp(caches[3].c_str(arena), "Resonan") == 0);
+    assert(arena.stats().truncations == 3U);
+    // Cut text stays cut while the source is unchanged.
+    assert(!caches[1].assign(arena, "0123456789abcdefghijklmnopqrst"));
+    // Released space goes to the next text, whole when it fits.
+    caches[1].release(arena);
+    assert(caches[1].assign(arena, "Envelope"));
+    assert(std::strcmp(caches[1].c_str(arena), "Envelope") == 0);
+    assert(arena.stats().failures == 0U);
+    std::cout << "[PASS] arena reserve cuts long text instead of starving caches\n";
+}
+
+}  // namespace
+
+int main() {
+    testStampDetectsChanges();
+    testIdenticalStringsShareStorage();
+    testEmptyTextIsNotStored();
+    testCompactionReusesHoles();
+    testExhaustedArenaRetries();
+    testLongTextCutOnGlyphBoundary();
+    testWorstCaseWindowNeverRendersBlank();
+    testReserveKeepsRoomForEveryCache();
+    std::cout << "All TextCache tests passed\n";
+    return 0;
+}
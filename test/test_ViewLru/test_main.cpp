@@ -0,0 +1,71 @@
+#include <cassert>
+#include <iostream>
+
+#include <ms/ui/ViewLru.hpp>
+
+namespace {
+
+using Lru = ms::ui::ViewLru<6>;
+
+// Activation order as ViewRegistry drives it: build, touch, then trim.
+void activate(Lru& lru, int id, uint32_t bytes) {
+    if (!lru.built(static_cast<std::size_t>(id))) lru.markBuilt(static_cast<std::size_t>(id), bytes);
+    lru.touch(static_cast<std::size_t>(id));
+    for (int cold = lru.nextEviction(id); cold != Lru::NONE; cold = lru.nextEviction(id)) {
+        lru.markDestroyed(static_cast<std::size_t>(cold));
+    }
+}
+
+void testKeepsMostRecentlyUsed() {
+    Lru lru;
+    lru.setLimits(2U, 0U);
+    activate(lru, 0, 100U);
+    activate(lru, 1, 100U);
+    activate(lru, 0, 100U);
+    activate(lru, 2, 100U);
+    // 1 was the coldest when 2 arrived.
+    assert(lru.built(0) && !lru.built(1) && lru.built(2));
+    assert(lru.builtCount() == 2U);
+    assert(lru.builtBytes() == 200U);
+    std::cout << "[PASS] count limit evicts the least recently used view\n";
+}
+
+void testBudgetAndPinning() {
+    Lru lru;
+    lru.setLimits(0U, 1000U);
+    lru.pin(0, true);
+    activate(lru, 0, 600U);
+    activate(lru, 1, 300U);
+    activate(lru, 2, 300U);
+    // Over budget: pinned 0 stays, 1 goes, active 2 stays.
+    assert(lru.built(0) && !lru.built(1) && lru.built(2));
+    assert(lru.builtBytes() == 900U);
+
+    // The active view alone may exceed the budget; nothing else can go.
+    activate(lru, 3, 2000U);
+    assert(lru.built(0) && !lru.built(2) && lru.built(3));
+    assert(lru.nextEviction(3) == Lru::NONE);
+    std::cout << "[PASS] byte budget spares pinned and active views\n";
+}
+
+void testRebuildReplacesCost() {
+    Lru lru;
+    lru.markBuilt(4, 250U);
+    lru.markBuilt(4, 400U);
+    assert(lru.builtCount() == 1U && lru.builtBytes() == 400U);
+    lru.markDestroyed(4);
+    lru.markDestroyed(4);
+    assert(lru.builtCount() == 0U && lru.builtBytes() == 0U);
+    assert(lru.nextEviction(Lru::NONE) == Lru::NONE);
+    std::cout << "[PASS] re-measured and repeated destroys keep totals exact\n";
+}
+
+}  // namespace
+
+int main() {
+    testKeepsMostRecentlyUsed();
+    testBudgetAndPinning();
+    testRebuildReplacesCost();
+    std::cout << "All ViewLru tests passed\n";
+    return 0;
+}
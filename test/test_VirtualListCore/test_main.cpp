@@ -0,0 +1,293 @@
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <ms/ui/widget/ListItemStore.hpp>
+#include <ms/ui/widget/VirtualListPrefetch.hpp>
+#include <ms/ui/widget/VirtualSlotRing.hpp>
+
+namespace {
+
+struct FakeRow {
+    int value = 0;
+};
+
+using Ring = ms::ui::VirtualListPrefetchRing<FakeRow, 16U>;
+
+void fill(Ring& ring, int index) { ring.claim(index).value = index * 10; }
+
+void testPrefetchFollowsScrollDirection() {
+    Ring ring{};
+    // Window [10, 15) scrolling down: rows below come first, nearest first.
+    assert(ring.nextMissing(10, 5, 1, 4, 4, 100) == 15);
+    fill(ring, 15);
+    assert(ring.nextMissing(10, 5, 1, 4, 4, 100) == 16);
+    for (int index = 16; index < 19; ++index) fill(ring, index);
+    // Look-ahead complete: the span behind the window is next.
+    assert(ring.nextMissing(10, 5, 1, 4, 4, 100) == 9);
+
+    Ring upward{};
+    assert(upward.nextMissing(10, 5, -1, 4, 4, 100) == 9);
+    fill(upward, 9);
+    assert(upward.nextMissing(10, 5, -1, 4, 4, 100) == 8);
+    std::cout << "[PASS] prefetch prepares rows in the scroll direction first\n";
+}
+
+void testPrefetchStaysInsideList() {
+    Ring ring{};
+    // Top of the list: nothing exists above row 0.
+    for (int index = 5; index < 9; ++index) fill(ring, index);
+    assert(ring.nextMissing(0, 5, -1, 4, 4, 100) == -1);
+    // Bottom of a 12-row list: only rows 10 and 11 exist below the window.
+    Ring bottom{};
+    assert(bottom.nextMissing(5, 5, 1, 4, 0, 12) == 10);
+    fill(bottom, 10);
+    assert(bottom.nextMissing(5, 5, 1, 4, 0, 12) == 11);
+    fill(bottom, 11);
+    assert(bottom.nextMissing(5, 5, 1, 4, 0, 12) == -1);
+    std::cout << "[PASS] prefetch never requests rows outside the list\n";
+}
+
+void testPreparedRowsSurviveWindowMoves() {
+    Ring ring{};
+    for (int index = 0; index < 13; ++index) fill(ring, index);
+    // A one-row move only exposes one new look-ahead row.
+    assert(ring.nextMissing(5, 5, 1, 4, 4, 100) == 13);
+    fill(ring, 13);
+    assert(ring.find(13) != nullptr && ring.find(13)->value == 130);
+    assert(ring.find(7) != nullptr && ring.find(7)->value == 70);
+    // Direct mapping: row 16 evicts row 0, never a row inside the span.
+    fill(ring, 16);
+    assert(!ring.contains(0));
+    assert(ring.contains(16));
+    assert(ring.find(-1) == nullptr);
+    std::cout << "[PASS] prepared rows are reused across single-step moves\n";
+}
+
+void testExactFitRingHoldsWholeSpan() {
+    // The overlay sizes its ring to window + both look-ahead spans.
+    ms::ui::VirtualListPrefetchRing<FakeRow, 13U> ring{};
+    for (int index = 36; index < 49; ++index) ring.claim(index).value = index;
+    assert(ring.nextMissing(40, 5, 1, 4, 4, 100) == -1);
+    for (int index = 36; index < 49; ++index) {
+        assert(ring.find(index) != nullptr && ring.find(index)->value == index);
+    }
+    // One step down evicts only the row that left the span behind.
+    assert(ring.nextMissing(41, 5, 1, 4, 4, 100) == 49);
+    ring.claim(49).value = 49;
+    assert(!ring.contains(36));
+    assert(ring.nextMissing(41, 5, 1, 4, 4, 100) == -1);
+    std::cout << "[PASS] an exact-fit ring holds the window and both spans\n";
+}
+
+void testResetDropsEveryRow() {
+    Ring ring{};
+    for (int index = 0; index < 16; ++index) fill(ring, index);
+    ring.reset();
+    for (int index = 0; index < 16; ++index) assert(!ring.contains(index));
+    // A reclaimed entry never leaks the previous provider output.
+    assert(ring.claim(3).value == 0);
+    std::cout << "[PASS] revision reset invalidates the prefetch ring\n";
+}
+
+using SlotRing = ms::ui::VirtualSlotRing<5U>;
+
+int bindWindow(SlotRing& ring, int windowStart, int count) {
+    int rebinds = 0;
+    for (int index = windowStart; index < windowStart + count; ++index) {
+        if (ring.claim(index)) ++rebinds;
+    }
+    return rebinds;
+}
+
+void testSingleStepShiftRebindsOneRow() {
+    SlotRing ring{};
+    assert(bindWindow(ring, 0, 5) == 5);
+    assert(bindWindow(ring, 0, 5) == 0);
+    // Window [0, 5) -> [1, 6): only row 5 is new, it reuses row 0's slot.
+    assert(bindWindow(ring, 1, 5) == 1);
+    assert(SlotRing::rowFor(5) == SlotRing::rowFor(0));
+    assert(!ring.holds(0));
+    // And back up again.
+    assert(bindWindow(ring, 0, 5) == 1);
+    // A page jump exposes a whole new window.
+    assert(bindWindow(ring, 5, 5) == 5);
+    std::cout << "[PASS] single-step shift rebinds exactly one row\n";
+}
+
+void testRingInvalidation() {
+    SlotRing ring{};
+    bindWindow(ring, 10, 5);
+    ring.invalidate(12);
+    ring.invalidate(40);  // not held: no effect
+    assert(bindWindow(ring, 10, 5) == 1);
+
+    ring.trim(13);
+    assert(ring.holds(12) && !ring.holds(13) && !ring.holds(14));
+    assert(bindWindow(ring, 10, 5) == 2);
+
+    ring.reset();
+    assert(bindWindow(ring, 10, 5) == 5);
+    assert(!ring.claim(-1));
+    std::cout << "[PASS] invalidated rows rebind on the next claim\n";
+}
+
+}  // namespace
+
+struct FakeStyle {
+    int tag = 0;
+};
+
+using Store = ms::ui::ListItemStore<FakeStyle>;
+
+const char* labelAt(const void* source, std::size_t index) {
+    return static_cast<const char* const*>(source)[index];
+}
+
+/** Reconcile and return the indices reported as written. */
+std::vector<std::size_t> apply(
+    Store& store, const char* const* labels, std::size_t count,
+    const uint32_t* keys, int selected, Store::Update* update = nullptr
+) {
+    std::vector<std::size_t> written;
+    const auto result = store.reconcile(
+        labels, labelAt, count, keys, selected,
+        [&](std::size_t index) { written.push_back(index); });
+    if (update) *update = result;
+    return written;
+}
+
+void testStoreCopiesOnlyChangedText() {
+    static Store store{};
+    const char* before[] = {"Kick", "Snare", "Hat"};
+    assert(apply(store, before, 3, nullptr, 0).size() == 3U);
+
+    const char* after[] = {"Kick", "Clap", "Hat", "Tom"};
+    Store::Update update{};
+    const auto written = apply(store, after, 4, nullptr, 1, &update);
+    assert(written.size() == 2U && written[0] == 1U && written[1] == 3U);
+    assert(update.rewritten == 1U && update.selected == 1);
+    assert(std::strcmp(store.text(1), "Clap") == 0);
+    assert(std::strcmp(store.text(5), "") == 0);
+    std::cout << "[PASS] item store copies only changed text\n";
+}
+
+void testStoreKeepsLongLists() {
+    static Store store{};
+    // Well past the 128 items ListOverlay once capped at, with long names.
+    constexpr std::size_t COUNT = 300U;
+    static std::string names[COUNT];
+    static const char* labels[COUNT];
+    static uint32_t keys[COUNT];
+    for (std::size_t i = 0; i < COUNT; ++i) {
+        names[i] = "Track " + std::to_string(i) + " - a name longer than any row shows";
+        labels[i] = names[i].c_str();
+        keys[i] = static_cast<uint32_t>(1000U + i);
+    }
+    Store::Update update{};
+    assert(apply(store, labels, COUNT, keys, 0, &update).size() == COUNT);
+    assert(store.size() == COUNT && update.copied == COUNT);
+    assert(names[COUNT - 1U] == store.text(COUNT - 1U));
+    assert(store.style(COUNT - 1U) != nullptr);
+
+    // The selection past 128 follows its key when a row is removed above.
+    (void)apply(store, labels + 1, COUNT - 1U, keys + 1, 250, &update);
+    assert(update.selected == 249 && update.copied == 0U);
+    assert(store.size() == COUNT - 1U && names[250] == store.text(249));
+    std::cout << "[PASS] item store keeps every item and its full text\n";
+}
+
+void testStoreStylesFollowKeys() {
+    static Store store{};
+    const char* labels[] = {"A", "B", "C", "D"};
+    const uint32_t keys[] = {10, 20, 30, 40};
+    (void)apply(store, labels, 4, keys, 0);
+    store.style(1)->tag = 2;
+    store.style(3)->tag = 4;
+
+    // 10 removed, 5 inserted, 40 moved to the front.
+    const char* moved[] = {"D", "E", "B", "C"};
+    const uint32_t movedKeys[] = {40, 5, 20, 30};
+    Store::Update update{};
+    (void)apply(store, moved, 4, movedKeys, 1, &update);
+    assert(update.selected == 2);
+    assert(store.style(0)->tag == 4 && store.style(1)->tag == 0);
+    assert(store.style(2)->tag == 2 && store.style(3)->tag == 0);
+
+    // Unkeyed: styles stay on their index; shrinking drops the tail.
+    (void)apply(store, moved, 3, nullptr, 0, &update);
+    assert(store.style(0)->tag == 4 && store.style(3) == nullptr);
+    (void)apply(store, moved, 4, nullptr, 0, &update);
+    assert(store.style(3)->tag == 0);
+
+    store.resetExternal(20);
+    assert(store.size() == 20U && store.style(19)->tag == 0);
+    assert(std::as_const(store).style(0)->tag == 0 && store.style(20) == nullptr);
+    assert(std::strcmp(store.text(0), "") == 0);
+    std::cout << "[PASS] item styles follow their key\n";
+}
+
+void testKeyedHeadInsertCopiesOneText() {
+    static Store store{};
+    const char* labels[] = {"A", "B", "C", "D"};
+    const uint32_t keys[] = {10, 20, 30, 40};
+    (void)apply(store, labels, 4, keys, 2);
+    store.style(2)->tag = 3;
+
+    const char* inserted[] = {"New", "A", "B", "C", "D"};
+    const uint32_t insertedKeys[] = {5, 10, 20, 30, 40};
+    Store::Update update{};
+    const auto written = apply(store, inserted, 5, insertedKeys, 2, &update);
+    // Only "New" is copied; every index shows another key, so all rebind.
+    assert(update.copied == 1U && update.rewritten == 0U);
+    assert(written.size() == 5U && update.selected == 3);
+    for (std::size_t i = 0; i < 5; ++i) assert(std::strcmp(store.text(i), inserted[i]) == 0);
+    assert(store.style(3)->tag == 3 && store.style(0)->tag == 0);
+    std::cout << "[PASS] keyed head insert copies one text\n";
+}
+
+void testKeyedMiddleInsertRebindsTail() {
+    static Store store{};
+    const char* labels[] = {"A", "B", "C", "D", "E"};
+    const uint32_t keys[] = {10, 20, 30, 40, 50};
+    (void)apply(store, labels, 5, keys, 0);
+
+    const char* inserted[] = {"A", "B", "New", "C", "D!", "E"};
+    const uint32_t insertedKeys[] = {10, 20, 25, 30, 40, 50};
+    Store::Update update{};
+    const auto written = apply(store, inserted, 6, insertedKeys, 0, &update);
+    // Rows above the insert keep their binding; "D" also changed text.
+    assert(written.size() == 4U && written.front() == 2U && written.back() == 5U);
+    assert(update.copied == 2U && update.rewritten == 1U && update.selected == 0);
+    for (std::size_t i = 0; i < 6; ++i) assert(std::strcmp(store.text(i), inserted[i]) == 0);
+
+    // Removing it again shifts the tail back; nothing is copied.
+    const char* removed[] = {"A", "B", "C", "D!", "E"};
+    const uint32_t removedKeys[] = {10, 20, 30, 40, 50};
+    const auto shifted = apply(store, removed, 5, removedKeys, 0, &update);
+    assert(shifted.size() == 3U && shifted.front() == 2U && update.copied == 0U);
+    for (std::size_t i = 0; i < 5; ++i) assert(std::strcmp(store.text(i), removed[i]) == 0);
+    std::cout << "[PASS] keyed middle insert rebinds only the tail\n";
+}
+
+int main() {
+    testPrefetchFollowsScrollDirection();
+    testPrefetchStaysInsideList();
+    testPreparedRowsSurviveWindowMoves();
+    testExactFitRingHoldsWholeSpan();
+    testResetDropsEveryRow();
+    testSingleStepShiftRebindsOneRow();
+    testRingInvalidation();
+    testStoreCopiesOnlyChangedText();
+    testStoreKeepsLongLists();
+    testStoreStylesFollowKeys();
+    testKeyedHeadInsertCopiesOneText();
+    testKeyedMiddleInsertRebindsTail();
+    std::cout << "All VirtualListCore tests passed\n";
+    return 0;
+}